@@ -51,8 +51,6 @@ s32 benchmark(Bitboard *board, bool stm, s32 depth)
   srand((unsigned int)start);
   for(u64 i=0;i<totalWorkUnits;i++)
   {
-    // prepare hash history
-    memcpy(&GLOBAL_HASHHISTORY[i*MAXGAMEPLY], HashHistory, MAXGAMEPLY * sizeof(Hash));
     // set random numbers
     for(u64 j=0;j<64;j++)
       RNUMBERS[i*64+j] = (u32)rand();
@@ -62,7 +60,10 @@ s32 benchmark(Bitboard *board, bool stm, s32 depth)
   if (!cl_write_objects())
     return -1;
   // run  benchmark
-  if (!cl_run_alphabeta(stm, depth, MaxNodes))
+  if (!cl_run_alphabeta(stm, depth, MaxNodes, -INF, INF, false))
+    return -1;
+  // wait for all time slices, no deadline
+  if (!cl_wait_alphabeta(0))
     return -1;
   // copy results
   if (!cl_read_memory())
@@ -105,19 +106,13 @@ s32 benchmark(Bitboard *board, bool stm, s32 depth)
 
   return 0;
 }
-// get nodes per second for temp config and specified position
-s64 benchmarkWrapper(s32 benchsec)
+// get nodes per second for current config and build options
+static s64 benchmarkBuild(s32 benchsec)
 {
   bool state;
   s32 sd = 1; 
   s32 bench = 0;
 
-  // inits
-  state = read_and_init_config("config.tmp");
-  if (!state)
-  {
-    return -1;
-  }
   state = gameinits();
   if (!state)
   {
@@ -157,4 +152,36 @@ s64 benchmarkWrapper(s32 benchsec)
 
   return (s64)((double)ABNODECOUNT/elapsed);
 }
+// get nodes per second for temp config and specified position
+s64 benchmarkWrapper(s32 benchsec)
+{
+  bool state;
+  s64 nps = 0;
+  s64 npsgeneric = 0;
+
+  // inits
+  state = read_and_init_config("config.tmp");
+  if (!state)
+  {
+    return -1;
+  }
+  // generic kernel, session constants as kernel arguments
+  opencl_specialize = false;
+  npsgeneric = benchmarkBuild(benchsec);
+  // specialized kernel, session constants as build options
+  opencl_specialize = true;
+  nps = benchmarkBuild(benchsec);
+
+  if (nps>0&&npsgeneric>0)
+  {
+    fprintf(stdout, "#> generic build nps: %" PRIi64 ", specialized build nps: %" PRIi64 ", delta: %+lf%%\n", npsgeneric, nps, (double)(nps-npsgeneric)*100/(double)npsgeneric);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile, "#> generic build nps: %" PRIi64 ", specialized build nps: %" PRIi64 ", delta: %+lf%%\n", npsgeneric, nps, (double)(nps-npsgeneric)*100/(double)npsgeneric);
+    }
+  }
+
+  return nps;
+}
 
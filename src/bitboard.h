@@ -24,9 +24,17 @@
 
 #include "types.h"
 
+// precomputed attack tables, pawn attacks per color, knight, king
+extern const Bitboard AttackTablesPawnPushes[2*64];
+extern const Bitboard AttackTables[7*64];
+
+Bitboard rook_attacks(Bitboard bbBlockers, Square sq);
+Bitboard bishop_attacks(Bitboard bbBlockers, Square sq);
 bool squareunderattack(Bitboard *board, bool stm, Square sq);
 Square getkingpos(Bitboard *board, bool side);
 bool isvalid(Bitboard *board);
+void domovequick(Bitboard *board, Move move);
+void undomovequick(Bitboard *board, Move move);
 void domove(Bitboard *board, Move move);
 void undomove(Bitboard *board, Move move, Cr cr, Hash hash, u64 hmc);
 Hash computehash(Bitboard *board, bool stm);
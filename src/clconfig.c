@@ -806,7 +806,7 @@ bool cl_guess_config(bool extreme)
 
         fprintf(stdout, "#\n");
         fprintf(stdout, "#> ### Running NPS-Benchmark for minimal config on device,\n");
-        fprintf(stdout, "#> ### this can last about %i seconds... \n", benchsec);
+        fprintf(stdout, "#> ### this can last about %i seconds... \n", benchsec*2); // generic and specialized build
         fprintf(stdout, "#> ### threadsX: %i \n", 1);
         fprintf(stdout, "#> ### threadsY: %i \n", 1);
         fprintf(stdout, "#> ### total work-groups: %i \n", 1*1);
@@ -819,7 +819,7 @@ bool cl_guess_config(bool extreme)
           fprintdate(LogFile);
           fprintf(LogFile, "#> ### Running NPS-Benchmark for minimal config on device,\n");
           fprintdate(LogFile);
-          fprintf(LogFile, "#> ### this can last about %i seconds... \n", benchsec);
+          fprintf(LogFile, "#> ### this can last about %i seconds... \n", benchsec*2); // generic and specialized build
           fprintdate(LogFile);
           fprintf(LogFile, "#> ### threadsX: %i \n", 1);
           fprintdate(LogFile);
@@ -903,7 +903,7 @@ bool cl_guess_config(bool extreme)
 
             fprintf(stdout, "#\n");
             fprintf(stdout, "#> ### Running NPS-Benchmark for threadsY on device,\n");
-            fprintf(stdout, "#> ### this can last about %i seconds... \n", benchsec);
+            fprintf(stdout, "#> ### this can last about %i seconds... \n", benchsec*2); // generic and specialized build
             fprintf(stdout, "#> ### threadsX: %i \n", deviceunits);
             fprintf(stdout, "#> ### threadsY: %i \n", warpmulti);
             fprintf(stdout, "#> ### total work-groups: %i \n", deviceunits*warpmulti);
@@ -916,7 +916,7 @@ bool cl_guess_config(bool extreme)
               fprintdate(LogFile);
               fprintf(LogFile, "#> ### Running NPS-Benchmark for threadsY on device,\n");
               fprintdate(LogFile);
-              fprintf(LogFile, "#> ### this can last about %i seconds... \n", benchsec);
+              fprintf(LogFile, "#> ### this can last about %i seconds... \n", benchsec*2); // generic and specialized build
               fprintdate(LogFile);
               fprintf(LogFile, "#> ### threadsX: %i \n", deviceunits);
               fprintdate(LogFile);
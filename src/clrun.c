@@ -21,10 +21,13 @@
 
 #include <stdio.h>      // for file io
 #include <stdlib.h>     // for alloc
+#include <string.h>     // for strlen and memset
 
 #include "timer.h"
 #include "types.h"      // types and defaults and macros 
 #include "zeta.h"       // for global vars
+#include "clrun.h"      // OpenCL run functions
+#include "cpu.h"        // native CPU search
 
 static cl_int status = 0;
 
@@ -38,20 +41,95 @@ u64 ttbits1 = 0x1;
 u64 mem1 = 1;
 u64 ttbits2 = 0x1;
 u64 mem2 = 1;
+// bytes per TT2 entry, packed ABDADA entries with 64 bit atomics
+static u64 tt2entry = sizeof(ABDADATTE);
+// abdada lock inside TT1 entries, TT2 memory added to TT1
+static bool ttunified = false;
 //u64 ttbits3 = 0x1;
 //u64 mem3 = 1;
 
-char *coptions = "";
-//char *coptions = "-cl-strict-aliasing";
-//char *coptions = "-cl-opt-disable";
+// program binary cache file, kernelname and key as suffix
+#define CLBINCACHE "zeta_%s_%016" PRIx64 ".bin"
+// max work-items per clear kernel launch
+#define CLEARCHUNK (1ULL<<24)
+// index of first per launch kernel argument, stm, followed by ply, depth, nodes
+#define ABARGSTM    13
+// index of time slice kernel arguments, slice_nodes followed by resume
+#define ABARGSLICE  23
+// index of persistent search flag, follows progress buffer
+#define ABARGPERSISTENT 26
+// index of root aspiration window, alpha followed by beta
+#define ABARGWINDOW 27
+// index of multipv root move exclusion buffer, follows window
+#define ABARGEXCLUDE 29
+// index of root split work queue, followed by root split flag
+#define ABARGSPLIT  30
+// index of abdada generation base of search, follows root split flag
+#define ABARGTTGEN  32
+#define PERFTARGSTM 6
+
+// events to chain memory writes, kernel run and memory reads
+static cl_event writeevents[16];
+static cl_uint numwriteevents = 0;
+static cl_event kernelevent = NULL;
+// node budget per work-group and kernel launch, time sliced search
+static u64 slicenodes = 0;
+// events retained for profiling, evaluated after the memory reads
+static cl_event profevents[MAXPROFEVENTS];
+static s32 proftypes[MAXPROFEVENTS];
+static cl_uint numprofevents = 0;
+// source of non-blocking finito reset, has to outlive the write call
+static const u32 finitozero = 0x0;
+// host helper TT entries staged for merge kernel, outlive the write call
+static TTE *mergeentries = NULL;
+static u64 mergecount = 0;
+// source of blocking stop flag write, second queue path
+static const u32 stopone = 0x1;
+// opencl_zerocopy, stop flag and persistent search progress as host pinned
+// buffers mapped once, accessed by host while the kernel runs, undefined by
+// OpenCL 1.1, needs a device with coherent access to host allocated memory,
+// else stop flag write and progress reads via blocking second queue
+static bool zerocopy = false;
+static cl_command_queue stopQueue = NULL;
+static volatile u32 *stopmap = NULL;
+static volatile u32 *progressmap = NULL;
+// abdada lock generation, one per searched depth, wraps, generations
+// used by last launch, max depth of launch, and game ply of each 8 bit
+// generation for TT2 age samples
+static u32 ttgeneration = 0;
+static u32 ttgenused = 0;
+static u32 ttgenmax = 0;
+static s32 ttgenply[256];
+
+// build options, generated per session by cl_build_options,
+// further options like "-cl-opt-disable" via opencl_options in config
+char coptions[1024] = "";
 
 void print_debug(char *debug);
+static void cl_build_options(char *kernelname);
+static bool cl_build_program(char *kernelname, const char *content, size_t len);
+static bool cl_bind_alphabeta(void);
+static bool cl_bind_perft(void);
+static bool cl_enqueue_alphabeta(bool resume);
+static bool cl_clear_buffer(cl_mem buffer, u64 size);
+static void *cl_map_buffer(cl_mem buffer, size_t size);
+static bool cl_unmap_buffer(cl_mem buffer, void *ptr);
+static bool cl_merge_helpers(void);
+static bool cl_stream_tt(cl_mem buffer, u64 size, FILE *fd, bool load);
+static u32 cl_tt_layout(void);
+static bool cl_device_extension(const char *name);
+static bool cl_profile_events(cl_event *events, cl_uint count, s32 type);
+static bool cl_profile_collect(void);
 
 // initialize OpenCL device, called once per game
 bool cl_init_device(char *kernelname)
 {
   cl_uint deviceListSize;
 
+  // native CPU search instead of OpenCL device
+  if (cpu_threads>0)
+    return cpu_init_device();
+
   status = clGetPlatformIDs(256, NULL, &numPlatforms);
   if(status!=CL_SUCCESS)
   {
@@ -120,139 +198,73 @@ bool cl_init_device(char *kernelname)
     print_debug((char *)"Error: Creating Context Info (cps, clCreateContext)\n");
     return false;
   }
-  // build OpenCL program object
-  if (strstr(kernelname, "perft_gpu"))
+  // unified TT1 entries, lock holds generation and gid+1 in 16 bits each
+  ttunified = (tt_unified
+               &&totalWorkUnits<0xFFFF
+               &&strstr(kernelname, "alphabeta_gpu"))?true:false;
+
+  // size transposition table TT1, for classic hash, before build options,
+  // unified entries have same size as TTE, buffers sized via TTE
+  ttbits1 = 0;
+  if (tt1_memory>0)
   {
-    const char *content = zetaperft_cl;
-    const size_t len = zetaperft_cl_len;
+    mem1 = ((tt1_memory+(ttunified?tt2_memory:0))*1024*1024)
+           /(ttunified?sizeof(TTEUNIFIED):sizeof(TTE));
 
-    program = clCreateProgramWithSource(
-                            	          context, 
-                                        1, 
-                                        &content,
-                              		      &len,
-                                        &status);
-    if(status!=CL_SUCCESS) 
-    { 
-      print_debug((char *)"Error: Loading Binary into cl_program (clCreateProgramWithBinary)\n");
-      return false;
-    }   
-    // create program for all the devices specified */
-    status = clBuildProgram(program, 
-                            1, 
-                            &devices[opencl_device_id], 
-                            coptions, 
-                            NULL, 
-                            NULL
-                            );
-    // get build log and print
-    if(status!=CL_SUCCESS) 
-    { 
-      char* build_log=0;
-      size_t log_size=0;
-      FILE 	*temp=0;
-
-	    print_debug((char *)"Error: Building Program (clBuildProgram)\n");
-      // shows the log
-      // first call to know the proper size
-      clGetProgramBuildInfo(program, 
-                            devices[opencl_device_id], 
-                            CL_PROGRAM_BUILD_LOG, 
-                            0, 
-                            NULL, 
-                            &log_size
-                           );
-      build_log = (char *) malloc(log_size+1);
-      // second call to get the log
-      status = clGetProgramBuildInfo(program, 
-                                     devices[opencl_device_id], 
-                                     CL_PROGRAM_BUILD_LOG, 
-                                     log_size, 
-                                     build_log, 
-                                     NULL
-                                    );
-      //build_log[log_size] = '\0';
-      temp = fopen(LOGFILE, "a");
-      fprintdate(temp);
-      fprintf(temp, "buildlog: %s \n", build_log);
-      fclose(temp);
-      if(status!=CL_SUCCESS) 
-      { 
-        print_debug((char *)"Error: Building Log (clGetProgramBuildInfo)\n");
-      }
-      free(build_log);
+    while ( mem1 >>= 1)   // get msb
+      ttbits1++;
+    mem1 = 1ULL<<ttbits1;   // get number of tt entries
+    ttbits1=mem1;
+  }
+  else
+  {
+    mem1 = 1;
+    ttbits1 = 0x1;
+  }
+
+  // packed TT2 entries, one 64 bit atomic per update, lock holds gid+1
+  tt2entry = (tt2_compact
+              &&totalWorkUnits<0xFFFF
+              &&strstr(kernelname, "alphabeta_gpu")
+              &&cl_device_extension("cl_khr_int64_base_atomics"))?
+              sizeof(ABDADATTEPACKED):sizeof(ABDADATTE);
+
+  // size transposition table TT2, for ABDADA parallel search
+  ttbits2 = 0;
+  if (tt2_memory>0&&!ttunified)
+  {
+    mem2 = (tt2_memory*1024*1024)/tt2entry;
+
+    while ( mem2 >>= 1)   // get msb
+      ttbits2++;
+    mem2 = 1ULL<<ttbits2;   // get number of tt entries
+    ttbits2=mem2;
+  }
+  else
+  {
+    mem2 = 1;
+    ttbits2 = 0x1;
+  }
+
+  // session constants as build options
+  cl_build_options(kernelname);
+
+  // build OpenCL program object, from binary cache if possible
+  if (strstr(kernelname, "perft_gpu"))
+  {
+    if (!cl_build_program(kernelname, zetaperft_cl, zetaperft_cl_len))
       return false;
-    }
   }
-  // build OpenCL program object
+  // build OpenCL program object, from binary cache if possible
   if (strstr(kernelname, "alphabeta_gpu"))
   {
-
 // gpugen deprecated, now inlined preprocessor directives in zeta.cl
 /*
     const char *content = (opencl_gpugen==3)?zeta3rdgen_cl:(opencl_gpugen==2)?zeta2ndgen_cl:zeta1stgen_cl;
     const size_t len = (opencl_gpugen==3)?zeta3rdgen_cl_len:(opencl_gpugen==2)?zeta2ndgen_cl_len:zeta1stgen_cl_len;
 */
-    const char *content = zeta_cl;
-    const size_t len = zeta_cl_len;
-
-    program = clCreateProgramWithSource(
-                            	          context, 
-                                        1, 
-                                        &content,
-                              		      &len,
-                                        &status);
-    if(status!=CL_SUCCESS) 
-    { 
-      print_debug((char *)"Error: Loading Binary into cl_program (clCreateProgramWithBinary)\n");
-      return false;
-    }   
-    // create program for all the devices specified */
-    status = clBuildProgram(program, 
-                            1, 
-                            &devices[opencl_device_id], 
-                            coptions, 
-                            NULL, 
-                            NULL
-                           );
-    // get build log and print
-    if(status!=CL_SUCCESS) 
-    { 
-      char* build_log=0;
-      size_t log_size=0;
-      FILE 	*temp=0;
-
-	    print_debug((char *)"Error: Building Program (clBuildProgram)\n");
-      // shows the log
-      // first call to know the proper size
-      clGetProgramBuildInfo(program, 
-                            devices[opencl_device_id], 
-                            CL_PROGRAM_BUILD_LOG, 
-                            0, 
-                            NULL, 
-                            &log_size
-                           );
-      build_log = (char *) malloc(log_size+1);
-      // second call to get the log
-      status = clGetProgramBuildInfo(program, 
-                                     devices[opencl_device_id], 
-                                     CL_PROGRAM_BUILD_LOG, 
-                                     log_size, 
-                                     build_log, 
-                                     NULL
-                                    );
-      //build_log[log_size] = '\0';
-      temp = fopen(LOGFILE, "a");
-      fprintdate(temp);
-      fprintf(temp, "buildlog: %s \n", build_log);
-      fclose(temp);
-      if(status!=CL_SUCCESS) 
-      { 
-        print_debug((char *)"Error: Building Log (clGetProgramBuildInfo)\n");
-      }
-      free(build_log);
+    if (!cl_build_program(kernelname, zeta_cl, zeta_cl_len))
       return false;
-    }
   }
 
   // create kernel
@@ -262,18 +274,62 @@ bool cl_init_device(char *kernelname)
     print_debug((char *)"Error: Creating Kernel for gpu. (clCreateKernel)\n");
     return false;
   }
+  // create clear kernel, used to reset device tables per game
+  if (strstr(kernelname, "alphabeta_gpu"))
+  {
+    clearkernel = clCreateKernel(program, "clear_buffer", &status);
+    if(status!=CL_SUCCESS) 
+    {  
+      print_debug((char *)"Error: Creating Kernel for gpu. (clCreateKernel clear_buffer)\n");
+      return false;
+    }
+    // sample kernel, TT occupancy statistics after search
+    samplekernel = clCreateKernel(program, "sample_tt", &status);
+    if(status!=CL_SUCCESS) 
+    {  
+      print_debug((char *)"Error: Creating Kernel for gpu. (clCreateKernel sample_tt)\n");
+      return false;
+    }
+    // merge kernel, deep host helper TT entries into TT1 per kernel launch
+    if (cpu_helpers>0)
+    {
+      mergekernel = clCreateKernel(program, "merge_tt", &status);
+      if(status!=CL_SUCCESS) 
+      {  
+        print_debug((char *)"Error: Creating Kernel for gpu. (clCreateKernel merge_tt)\n");
+        return false;
+      }
+    }
+  }
 
   // create command queue
   commandQueue = clCreateCommandQueue(
 		                                   context, 
                                        devices[opencl_device_id], 
-                                       0, 
+                                       (opencl_profiling)?
+                                         CL_QUEUE_PROFILING_ENABLE:0, 
                                        &status);
   if(status!=CL_SUCCESS) 
 	{ 
 	  print_debug((char *)"Creating Command Queue. (clCreateCommandQueue)\n");
 	  return false;
 	}
+  // second command queue, to set the stop flag and read progress while
+  // kernel is running, not needed with mapped zero-copy buffers
+  zerocopy = (opencl_zerocopy>0)?true:false;
+  if (!zerocopy)
+  {
+    stopQueue = clCreateCommandQueue(
+                                       context, 
+                                       devices[opencl_device_id], 
+                                       0, 
+                                       &status);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Creating Command Queue. (clCreateCommandQueue stopQueue)\n");
+      return false;
+    }
+  }
 
   // create memory buffers
   GLOBAL_BOARD_Buffer = clCreateBuffer(
@@ -350,9 +406,9 @@ bool cl_init_device(char *kernelname)
 
   GLOBAL_HASHHISTORY_Buffer = clCreateBuffer(
                             			     context, 
-                                       CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
-                                       sizeof(Hash)*totalWorkUnits*MAXGAMEPLY,
-                                       GLOBAL_HASHHISTORY, 
+                                       CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,
+                                       sizeof(Hash)*MAXGAMEPLY,
+                                       HashHistory, 
                                        &status);
   if(status!=CL_SUCCESS) 
   { 
@@ -384,28 +440,12 @@ bool cl_init_device(char *kernelname)
     return false;
   }
 
-  // initialize transposition table TT1, for classic hash
-  ttbits1 = 0;
-  if (tt1_memory>0)
-  {
-    mem1 = (tt1_memory*1024*1024)/(sizeof(TTE));
-
-    while ( mem1 >>= 1)   // get msb
-      ttbits1++;
-    mem1 = 1ULL<<ttbits1;   // get number of tt entries
-    ttbits1=mem1;
-  }
-  else
-  {
-    mem1 = 1;
-    ttbits1 = 0x1;
-  }
-
+  // transposition table TT1, for classic hash
   GLOBAL_TT1_Buffer = clCreateBuffer(
                         		        context, 
-                                    CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                                    CL_MEM_READ_WRITE,
                                     sizeof(TTE) * mem1,
-                                    TT1ZEROED, 
+                                    NULL, 
                                     &status);
   if(status!=CL_SUCCESS) 
   { 
@@ -413,28 +453,12 @@ bool cl_init_device(char *kernelname)
     return false;
   }
 
-  // initialize transposition table TT2, for ABDADA parallel search
-  ttbits2 = 0;
-  if (tt2_memory>0)
-  {
-    mem2 = (tt2_memory*1024*1024)/(sizeof(ABDADATTE));
-
-    while ( mem2 >>= 1)   // get msb
-      ttbits2++;
-    mem2 = 1ULL<<ttbits2;   // get number of tt entries
-    ttbits2=mem2;
-  }
-  else
-  {
-    mem2 = 1;
-    ttbits2 = 0x1;
-  }
-
+  // transposition table TT2, for ABDADA parallel search
   GLOBAL_TT2_Buffer = clCreateBuffer(
                         		        context, 
-                                    CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
-                                    sizeof(ABDADATTE) * mem2,
-                                    TT2ZEROED, 
+                                    CL_MEM_READ_WRITE,
+                                    tt2entry * mem2,
+                                    NULL, 
                                     &status);
   if(status!=CL_SUCCESS) 
   { 
@@ -475,9 +499,9 @@ bool cl_init_device(char *kernelname)
 
   GLOBAL_Killer_Buffer = clCreateBuffer(
                         		        context, 
-                                    CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                                    CL_MEM_READ_WRITE,
                                     sizeof(TTMove) * totalWorkUnits * MAXPLY,
-                                    KILLERZEROED, 
+                                    NULL, 
                                     &status);
   if(status!=CL_SUCCESS) 
   { 
@@ -487,9 +511,9 @@ bool cl_init_device(char *kernelname)
 
   GLOBAL_Counter_Buffer = clCreateBuffer(
                         		        context, 
-                                    CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                                    CL_MEM_READ_WRITE,
                                     sizeof(TTMove) * totalWorkUnits * 64 * 64,
-                                    COUNTERZEROED, 
+                                    NULL, 
                                     &status);
   if(status!=CL_SUCCESS) 
   { 
@@ -497,35 +521,204 @@ bool cl_init_device(char *kernelname)
     return false;
   }
 
-  u32 finito = 0x0;
+  // first finished work-group, per depth for persistent search
   GLOBAL_finito_Buffer = clCreateBuffer(
                         		        context, 
+                                    CL_MEM_READ_WRITE,
+                                    sizeof(u32) * MAXPLY,
+                                    NULL, 
+                                    &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_finito_Buffer)\n");
+    return false;
+  }
+
+  // stop flag, polled by the running kernel, host pinned with zero-copy
+  GLOBAL_stop_Buffer = clCreateBuffer(
+                        		        context, 
+                                    (zerocopy)?
+                                      CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR | CL_MEM_COPY_HOST_PTR
+                                     :CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
+                                    sizeof(u32) * 1,
+                                    (void *)&finitozero, 
+                                    &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_stop_Buffer)\n");
+    return false;
+  }
+  if (zerocopy)
+  {
+    stopmap = (volatile u32 *)cl_map_buffer(GLOBAL_stop_Buffer, sizeof(u32) * 1);
+    if (stopmap==NULL)
+      return false;
+  }
+
+  // search stack checkpoints for time sliced kernel runs
+  GLOBAL_Checkpoint_Buffer = clCreateBuffer(
+                        		        context, 
+                                    CL_MEM_READ_WRITE,
+                                    sizeof(u64) * totalWorkUnits * CHECKPOINTSIZE,
+                                    NULL, 
+                                    &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_Checkpoint_Buffer)\n");
+    return false;
+  }
+
+  GLOBAL_slicecount_Buffer = clCreateBuffer(
+                        		        context, 
                                     CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR,
                                     sizeof(u32) * 1,
-                                    &finito, 
+                                    (void *)&finitozero, 
                                     &status);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: clCreateBuffer (GLOBAL_finito_Buffer)\n");
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_slicecount_Buffer)\n");
     return false;
   }
 
+  // persistent search progress, polled by host while running,
+  // host pinned with zero-copy
+  GLOBAL_Progress_Buffer = clCreateBuffer(
+                        		        context, 
+                                    (zerocopy)?
+                                      CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR
+                                     :CL_MEM_READ_WRITE,
+                                    sizeof(u32) * PROGRESSSIZE,
+                                    NULL, 
+                                    &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_Progress_Buffer)\n");
+    return false;
+  }
+  if (zerocopy)
+  {
+    progressmap = (volatile u32 *)cl_map_buffer(GLOBAL_Progress_Buffer, sizeof(u32) * PROGRESSSIZE);
+    if (progressmap==NULL)
+      return false;
+  }
+
+  // multipv, root moves excluded from search, written per search
+  GLOBAL_RootExclude_Buffer = clCreateBuffer(
+                        		        context, 
+                                    CL_MEM_READ_ONLY,
+                                    sizeof(Bitboard) * MULTIPVSIZE,
+                                    NULL, 
+                                    &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_RootExclude_Buffer)\n");
+    return false;
+  }
+
+  // root split, root move claims and scores, split points, cleared per search
+  GLOBAL_RootSplit_Buffer = clCreateBuffer(
+                        		        context, 
+                                    CL_MEM_READ_WRITE,
+                                    sizeof(u32) * ROOTSPLITSIZE,
+                                    NULL, 
+                                    &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clCreateBuffer (GLOBAL_RootSplit_Buffer)\n");
+    return false;
+  }
+
+  // TT samples of sample kernel, read back after search
+  if (samplekernel!=NULL)
+  {
+    GLOBAL_Sample_Buffer = clCreateBuffer(
+                                      context, 
+                                      CL_MEM_WRITE_ONLY,
+                                      sizeof(s32) * TTSAMPLES * TTSAMPLESIZE,
+                                      NULL, 
+                                      &status);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: clCreateBuffer (GLOBAL_Sample_Buffer)\n");
+      return false;
+    }
+  }
+
+  // host helper threads, own TT of TT1 size, deep entries merged per launch
+  if (mergekernel!=NULL)
+  {
+    GLOBAL_Merge_Buffer = clCreateBuffer(
+                                      context, 
+                                      CL_MEM_READ_ONLY,
+                                      sizeof(TTE) * MAXMERGE,
+                                      NULL, 
+                                      &status);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: clCreateBuffer (GLOBAL_Merge_Buffer)\n");
+      return false;
+    }
+    mergeentries = (TTE *)malloc(MAXMERGE*sizeof(TTE));
+    if (mergeentries==NULL)
+    {
+      print_debug((char *)"Error: Allocating merge entries. (cl_init_device)\n");
+      return false;
+    }
+    if (!cpu_init_device())
+      return false;
+  }
+
+  // bind invariant kernel arguments, buffers and tt sizes
+  if (strstr(kernelname, "perft_gpu"))
+  {
+    if (!cl_bind_perft())
+      return false;
+  }
+  if (strstr(kernelname, "alphabeta_gpu"))
+  {
+    if (!cl_bind_alphabeta())
+      return false;
+  }
+
+  // zero device tables on device, no host copies needed
+  if (clearkernel!=NULL)
+  {
+    if (!cl_reset_device())
+      return false;
+  }
+
   return true;
 }
 // write OpenCL memory buffers, called every search run
+// non-blocking, kernel launch waits on the write events
 bool cl_write_objects(void) 
 {
+  double submit = get_time_mono();
+
+  // search threads read host memory directly
+  if (cpu_threads>0)
+  {
+    hostoverhead += get_time_mono()-submit;
+    return true;
+  }
+
+  numwriteevents = 0;
+
+  // reset profiling of last iteration
+  memset(clprofile, 0, sizeof(clprofile));
+  memset(clprofilecount, 0, sizeof(clprofilecount));
+
   // write buffers
   status = clEnqueueWriteBuffer(
                                 commandQueue,
                                 GLOBAL_BOARD_Buffer,
-                                CL_TRUE,
+                                CL_FALSE,
                                 0,
                                 sizeof(Bitboard) * 7,
                                 GLOBAL_BOARD, 
                                 0,
                                 NULL,
-                                NULL);
+                                &writeevents[numwriteevents++]);
 
   if(status!=CL_SUCCESS)
   {
@@ -533,25 +726,16 @@ bool cl_write_objects(void)
     return false;
   }
 
-  // flush command queue
-  status = clFlush(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: flushing the memory writes. (clFlush)\n");
-    return false;
-  }
-
-
   status = clEnqueueWriteBuffer(
                                 commandQueue,
                                 GLOBAL_COUNTERS_Buffer,
-                                CL_TRUE,
+                                CL_FALSE,
                                 0,
                                 sizeof(u64) * totalWorkUnits * threadsZ,
                                 COUNTERSZEROED, 
                                 0,
                                 NULL,
-                                NULL);
+                                &writeevents[numwriteevents++]);
 
   if(status!=CL_SUCCESS)
   {
@@ -559,25 +743,16 @@ bool cl_write_objects(void)
     return false;
   }
 
-  // flush command queue
-  status = clFlush(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: flushing the memory writes. (clFlush)\n");
-    return false;
-  }
-
-
   status = clEnqueueWriteBuffer(
                                 commandQueue,
                                 GLOBAL_RNUMBERS_Buffer,
-                                CL_TRUE,
+                                CL_FALSE,
                                 0,
                                 sizeof(u32) * totalWorkUnits * threadsZ,
                                 RNUMBERS, 
                                 0,
                                 NULL,
-                                NULL);
+                                &writeevents[numwriteevents++]);
 
   if(status!=CL_SUCCESS)
   {
@@ -585,24 +760,16 @@ bool cl_write_objects(void)
     return false;
   }
 
-  // flush command queue
-  status = clFlush(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: flushing the memory writes. (clFlush)\n");
-    return false;
-  }
-
   status = clEnqueueWriteBuffer(
                                 commandQueue,
                                 GLOBAL_PV_Buffer,
-                                CL_TRUE,
+                                CL_FALSE,
                                 0,
                                 sizeof(Move) * MAXPLY,
                                 PVZEROED, 
                                 0,
                                 NULL,
-                                NULL);
+                                &writeevents[numwriteevents++]);
 
   if(status!=CL_SUCCESS)
   {
@@ -610,24 +777,35 @@ bool cl_write_objects(void)
     return false;
   }
 
-  // flush command queue
-  status = clFlush(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: flushing the memory writes. (clFlush)\n");
+  // multipv, root moves excluded from search
+  status = clEnqueueWriteBuffer(
+                                commandQueue,
+                                GLOBAL_RootExclude_Buffer,
+                                CL_FALSE,
+                                0,
+                                sizeof(Bitboard) * MULTIPVSIZE,
+                                ROOTEXCLUDE, 
+                                0,
+                                NULL,
+                                &writeevents[numwriteevents++]);
+
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_RootExclude_Buffer)\n");
     return false;
   }
 
+  // shared game history, only positions up to current game ply
   status = clEnqueueWriteBuffer(
                                 commandQueue,
                                 GLOBAL_HASHHISTORY_Buffer,
-                                CL_TRUE,
+                                CL_FALSE,
                                 0,
-                                sizeof(Hash) * totalWorkUnits * MAXGAMEPLY,
-                                GLOBAL_HASHHISTORY, 
+                                sizeof(Hash) * ((PLY+1<MAXGAMEPLY)?PLY+1:MAXGAMEPLY),
+                                HashHistory, 
                                 0,
                                 NULL,
-                                NULL);
+                                &writeevents[numwriteevents++]);
 
   if(status!=CL_SUCCESS)
   {
@@ -635,21 +813,853 @@ bool cl_write_objects(void)
     return false;
   }
 
-  u32 finito = 0x0;
   status = clEnqueueWriteBuffer(
                                 commandQueue,
                                 GLOBAL_finito_Buffer,
-                                CL_TRUE,
+                                CL_FALSE,
+                                0,
+                                sizeof(u32) * 1,
+                                &finitozero, 
+                                0,
+                                NULL,
+                                &writeevents[numwriteevents++]);
+
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_finito_Buffer)\n");
+    return false;
+  }
+
+  // reset stop flag, via mapped pointer with zero-copy, no kernel running
+  if (zerocopy)
+    *stopmap = 0;
+  else
+  {
+    status = clEnqueueWriteBuffer(
+                                  commandQueue,
+                                  GLOBAL_stop_Buffer,
+                                  CL_FALSE,
+                                  0,
+                                  sizeof(u32) * 1,
+                                  &finitozero, 
+                                  0,
+                                  NULL,
+                                  &writeevents[numwriteevents++]);
+
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_stop_Buffer)\n");
+      return false;
+    }
+  }
+
+  status = clEnqueueWriteBuffer(
+                                commandQueue,
+                                GLOBAL_slicecount_Buffer,
+                                CL_FALSE,
                                 0,
                                 sizeof(u32) * 1,
-                                &finito, 
+                                &finitozero, 
+                                0,
+                                NULL,
+                                &writeevents[numwriteevents++]);
+
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_slicecount_Buffer)\n");
+    return false;
+  }
+
+  // host helper TT entries, in-order queue merges them before search kernel
+  if (mergekernel!=NULL)
+  {
+    if (!cl_merge_helpers())
+      return false;
+  }
+
+  // flush command queue, no wait
+  status = clFlush(commandQueue);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: flushing the memory writes. (clFlush)\n");
+    return false;
+  }
+
+  hostoverhead += get_time_mono()-submit;
+
+	return true;
+}
+// release events of previous enqueue calls
+static bool cl_release_events(cl_event *events, cl_uint count)
+{
+  cl_uint i;
+
+  for (i=0;i<count;i++)
+  {
+    if (events[i]!=NULL)
+    {
+      status = clReleaseEvent(events[i]);
+      if(status!=CL_SUCCESS) 
+      { 
+        print_debug((char *)"Error: Release event object. (clReleaseEvent)\n");
+        return false;
+      }
+      events[i] = NULL;
+    }
+  }
+  return true;
+}
+// retain events for profiling, timestamps are queried when commands are done
+static bool cl_profile_events(cl_event *events, cl_uint count, s32 type)
+{
+  cl_uint i;
+
+  if (!opencl_profiling)
+    return true;
+
+  // many time slices, evaluate what is retained so far
+  if (numprofevents+count>MAXPROFEVENTS)
+  {
+    status = clFinish(commandQueue);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Waiting for profiled commands. (clFinish)\n");
+      return false;
+    }
+    if (!cl_profile_collect())
+      return false;
+  }
+
+  for (i=0;i<count;i++)
+  {
+    if (events[i]==NULL)
+      continue;
+    status = clRetainEvent(events[i]);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Retain event object. (clRetainEvent)\n");
+      return false;
+    }
+    profevents[numprofevents] = events[i];
+    proftypes[numprofevents] = type;
+    numprofevents++;
+  }
+  return true;
+}
+// accumulate queued, submit, start and end timestamps of retained events
+static bool cl_profile_collect(void)
+{
+  cl_ulong stamps[4];
+  cl_profiling_info info[4] =
+  {
+    CL_PROFILING_COMMAND_QUEUED,
+    CL_PROFILING_COMMAND_SUBMIT,
+    CL_PROFILING_COMMAND_START,
+    CL_PROFILING_COMMAND_END
+  };
+  cl_uint i;
+  s32 j;
+
+  for (i=0;i<numprofevents;i++)
+  {
+    for (j=0;j<4;j++)
+    {
+      status = clGetEventProfilingInfo(
+                                        profevents[i],
+                                        info[j],
+                                        sizeof(cl_ulong),
+                                        &stamps[j],
+                                        NULL);
+      if(status!=CL_SUCCESS) 
+      { 
+        print_debug((char *)"Error: Query event profiling info. (clGetEventProfilingInfo)\n");
+        return false;
+      }
+    }
+    // nanoseconds to milliseconds
+    clprofile[proftypes[i]][PROFQUEUED] += (double)(stamps[1]-stamps[0])/1000000;
+    clprofile[proftypes[i]][PROFSUBMIT] += (double)(stamps[2]-stamps[1])/1000000;
+    clprofile[proftypes[i]][PROFEXEC]   += (double)(stamps[3]-stamps[2])/1000000;
+    clprofilecount[proftypes[i]]++;
+  }
+  if (!cl_release_events(profevents, numprofevents))
+    return false;
+  numprofevents = 0;
+
+  return true;
+}
+// run OpenCL bestfirst kernel, every search
+bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes, Score alpha, Score beta, bool persistent)
+{
+  double submit = get_time_mono();
+  s32 i = ABARGSTM;
+
+  // thread launch counts as host overhead too
+  if (cpu_threads>0)
+  {
+    if (!cpu_run_alphabeta(stm, depth, nodes, alpha, beta, persistent))
+      return false;
+    hostoverhead += get_time_mono()-submit;
+    return true;
+  }
+
+  // host helper threads search same root, kept running over launches
+  if (mergekernel!=NULL&&depth>0)
+  {
+    if (!cpu_helpers_start(stm))
+      return false;
+  }
+
+  // set per launch kernel arguments, invariant ones are bound once
+  temp = (s32)stm;
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&temp);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (stm)\n");
+    return false;
+  }
+  i++;
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&PLY);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (ply_init)\n");
+    return false;
+  }
+  i++;
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&depth);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (search_depth)\n");
+    return false;
+  }
+  i++;
+
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_ulong), 
+                          (void *)&nodes);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (max_nodes)\n");
+    return false;
+  }
+  i++;
+
+  // persistent search runs iterative deepening on device up to depth
+  temp = (s32)persistent;
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGPERSISTENT, 
+                          sizeof(cl_int), 
+                          (void *)&temp);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (persistent)\n");
+    return false;
+  }
+  // root window, -INF and INF for full window search
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGWINDOW, 
+                          sizeof(cl_int), 
+                          (void *)&alpha);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (alpha_init)\n");
+    return false;
+  }
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGWINDOW+1, 
+                          sizeof(cl_int), 
+                          (void *)&beta);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (beta_init)\n");
+    return false;
+  }
+  // root split, not in persistent search, iterative deepening on device
+  temp = (root_split&&!persistent)?1:0;
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGSPLIT+1, 
+                          sizeof(cl_int), 
+                          (void *)&temp);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (rootsplit)\n");
+    return false;
+  }
+  // fresh abdada generation per searched depth, stale locks of previous
+  // searches are reset, kernel adds search depth, time slices keep it,
+  // persistent search advances by depths it reached, see cl_poll_progress
+  ttgeneration += ttgenused;
+  temp = (s32)(ttgeneration+1-((persistent)?1:(u32)depth));
+  for (s32 d=1;d<=((persistent)?depth:1);d++)
+    ttgenply[(ttgeneration+(u32)d)&0xFF] = (s32)PLY;
+  ttgenused = 1;
+  ttgenmax = (persistent)?(u32)depth:1;
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGTTGEN, 
+                          sizeof(cl_uint), 
+                          (void *)&temp);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (ttgen_init)\n");
+    return false;
+  }
+  // fresh per depth finito flags, in-order queue before search kernel,
+  // fresh pv slots, via mapped pointer with zero-copy, no kernel running
+  if (persistent)
+  {
+    if (!cl_clear_buffer(GLOBAL_finito_Buffer, sizeof(u32)*MAXPLY))
+      return false;
+    if (zerocopy)
+      memset((void *)progressmap, 0, sizeof(u32)*PROGRESSSIZE);
+    else if (!cl_clear_buffer(GLOBAL_Progress_Buffer, sizeof(u32)*PROGRESSSIZE))
+      return false;
+  }
+  // fresh root move claims, kept over time slices of one search
+  if (temp)
+  {
+    if (!cl_clear_buffer(GLOBAL_RootSplit_Buffer, sizeof(u32)*ROOTSPLITSIZE))
+      return false;
+  }
+
+  // node budget per work-group and time slice, 0 runs search in one launch
+  // persistent search is not time sliced
+  slicenodes = 0;
+  if (slice_ms>0&&!persistent)
+  {
+    slicenodes = (u64)((double)nodes_per_second*slice_ms/1000/totalWorkUnits);
+    slicenodes = (slicenodes<1)?1:slicenodes;
+  }
+
+  if (!cl_enqueue_alphabeta(false))
+    return false;
+
+  hostoverhead += get_time_mono()-submit;
+
+  return true;
+}
+// enqueue alphabeta kernel, behind pending memory writes
+static bool cl_enqueue_alphabeta(bool resume)
+{
+  s32 i = ABARGSLICE;
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_ulong), 
+                          (void *)&slicenodes);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (slice_nodes)\n");
+    return false;
+  }
+  i++;
+
+  temp = (s32)resume;
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&temp);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (resume)\n");
+    return false;
+  }
+  i++;
+
+  // enqueue a kernel run call.
+  globalThreads[0] = (size_t)threadsX;
+  globalThreads[1] = (size_t)threadsY;
+  globalThreads[2] = (size_t)threadsZ;
+
+  localThreads[0]  = 1;
+  localThreads[1]  = 1;
+  localThreads[2]  = (size_t)threadsZ;
+
+  status = clEnqueueNDRangeKernel(
+	                                 commandQueue,
+                                   kernel,
+                                   maxDims,
+                                   NULL,
+                                   globalThreads,
+                                   localThreads,
+                                   numwriteevents,
+                                   (numwriteevents>0)?writeevents:NULL,
+                                   &kernelevent);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)\n");
+    return false;
+  }
+  if (!cl_profile_events(writeevents, numwriteevents, PROFWRITE))
+    return false;
+  if (!cl_profile_events(&kernelevent, 1, PROFKERNEL))
+    return false;
+  if (!cl_release_events(writeevents, numwriteevents))
+    return false;
+  numwriteevents = 0;
+
+  // flush command queueu, cl_read_memory waits for the kernel
+  status = clFlush(commandQueue);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: flushing the Kernel. (clFlush)\n");
+    return false;
+  }
+
+  return true;
+}
+// relaunch alphabeta kernel if work-groups yielded at end of time slice
+static bool cl_resume_alphabeta(bool *resumed)
+{
+  u32 count = 0;
+
+  *resumed = false;
+
+  if (slicenodes==0)
+    return true;
+
+  // kernel is done, in-order queue
+  status = clEnqueueReadBuffer(
+                                commandQueue,
+                                GLOBAL_slicecount_Buffer,
+                                CL_TRUE,
+                                0,
+                                sizeof(u32) * 1,
+                                &count,
+                                0,
+                                NULL,
+                                NULL);
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_slicecount_Buffer)\n");
+    return false;
+  }
+  if (count==0)
+    return true;
+
+  if (!cl_release_events(&kernelevent, 1))
+    return false;
+
+  numwriteevents = 0;
+  status = clEnqueueWriteBuffer(
+                                commandQueue,
+                                GLOBAL_slicecount_Buffer,
+                                CL_FALSE,
+                                0,
+                                sizeof(u32) * 1,
+                                &finitozero, 
+                                0,
+                                NULL,
+                                &writeevents[numwriteevents++]);
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_slicecount_Buffer)\n");
+    return false;
+  }
+
+  if (!cl_enqueue_alphabeta(true))
+    return false;
+
+  *resumed = true;
+
+  return true;
+}
+// run OpenCL bestfirst kernel, every search
+bool cl_run_perft(bool stm, s32 depth)
+{
+  double submit = get_time_mono();
+  s32 i = PERFTARGSTM;
+
+  if (cpu_threads>0)
+    return cpu_run_perft(stm, depth);
+
+  // set per launch kernel arguments, invariant ones are bound once
+  temp = (s32)stm;
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&temp);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (stm)\n");
+    return false;
+  }
+  i++;
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&PLY);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (ply_init)\n");
+    return false;
+  }
+  i++;
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_int), 
+                          (void *)&depth);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (search_depth)\n");
+    return false;
+  }
+  i++;
+
+
+  status = clSetKernelArg(
+                          kernel, 
+                          i, 
+                          sizeof(cl_ulong), 
+                          (void *)&MaxNodes);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Setting kernel argument. (max_nodes)\n");
+    return false;
+  }
+  i++;
+
+  // enqueue a kernel run call.
+  globalThreads[0] = 1;
+  globalThreads[1] = 1;
+  globalThreads[2] = (size_t)threadsZ;
+
+  localThreads[0]  = 1;
+  localThreads[1]  = 1;
+  localThreads[2]  = (size_t)threadsZ;
+
+  status = clEnqueueNDRangeKernel(
+	                                 commandQueue,
+                                   kernel,
+                                   maxDims,
+                                   NULL,
+                                   globalThreads,
+                                   localThreads,
+                                   numwriteevents,
+                                   (numwriteevents>0)?writeevents:NULL,
+                                   &kernelevent);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)\n");
+    return false;
+  }
+  if (!cl_profile_events(writeevents, numwriteevents, PROFWRITE))
+    return false;
+  if (!cl_profile_events(&kernelevent, 1, PROFKERNEL))
+    return false;
+  if (!cl_release_events(writeevents, numwriteevents))
+    return false;
+  numwriteevents = 0;
+
+  // flush command queueu, cl_read_memory waits for the kernel
+  status = clFlush(commandQueue);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: flushing the Kernel. (clFlush)\n");
+    return false;
+  }
+
+  hostoverhead += get_time_mono()-submit;
+
+  return true;
+}
+
+// wait for running alphabeta kernel, set stop flag at deadline in ms,
+// deadline 0 waits without limit,
+// relaunch time sliced searches until all work-groups are done
+bool cl_wait_alphabeta(double deadline)
+{
+  cl_int eventstatus = CL_QUEUED;
+  bool stopped = false;
+
+  if (cpu_threads>0)
+    return cpu_wait_alphabeta(deadline);
+
+  if (kernelevent==NULL)
+    return true;
+
+  while (true)
+  {
+    status = clGetEventInfo(kernelevent,
+                            CL_EVENT_COMMAND_EXECUTION_STATUS,
+                            sizeof(cl_int),
+                            &eventstatus,
+                            NULL);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Query kernel execution status. (clGetEventInfo)\n");
+      return false;
+    }
+    // aborted, errors are reported by cl_read_memory
+    if (eventstatus<0)
+      break;
+    // time slice done, relaunch suspended work-groups
+    if (eventstatus==CL_COMPLETE)
+    {
+      bool resumed;
+      if (!cl_resume_alphabeta(&resumed))
+        return false;
+      if (!resumed)
+        break;
+      continue;
+    }
+    // deadline passed or move now requested by user
+    if (!stopped&&((deadline>0&&get_time()>=deadline)||MOVENOW))
+    {
+      if (!cl_stop_alphabeta())
+        return false;
+      stopped = true;
+    }
+    sleep_ms(1);
+  }
+
+  return true;
+}
+// check once if persistent search published depth, or kernel finished
+// on ready copies score and pv of depth into PV and a snapshot of counters
+bool cl_poll_progress(s32 depth, bool *ready, bool *done)
+{
+  cl_int eventstatus = CL_QUEUED;
+  u32 slot[PROGSLOT];
+  u32 counts[PROGNCOUNT*2];
+  s32 i = 0;
+
+  if (cpu_threads>0)
+    return cpu_poll_progress(depth, ready, done);
+
+  *ready = false;
+  *done = true;
+
+  if (kernelevent==NULL||depth<1||depth>=MAXPLY)
+    return true;
+
+  // kernel state first, so progress read after completion is final
+  status = clGetEventInfo(kernelevent,
+                          CL_EVENT_COMMAND_EXECUTION_STATUS,
+                          sizeof(cl_int),
+                          &eventstatus,
+                          NULL);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Query kernel execution status. (clGetEventInfo)\n");
+    return false;
+  }
+  *done = (eventstatus==CL_COMPLETE||eventstatus<0)?true:false;
+
+  // ready flag, score and pv, then counter totals of depth, plain reads of
+  // host pinned memory with zero-copy, else blocking reads on second queue
+  if (zerocopy)
+  {
+    if (!progressmap[PROGPV+depth*PROGSLOT])
+      return true;
+    for (i=0;i<PROGSLOT;i++)
+      slot[i] = progressmap[PROGPV+depth*PROGSLOT+i];
+    for (i=0;i<PROGNCOUNT*2;i++)
+      counts[i] = progressmap[PROGCOUNT+depth*PROGNCOUNT*2+i];
+  }
+  else
+  {
+    status = clEnqueueReadBuffer(
+                                  stopQueue,
+                                  GLOBAL_Progress_Buffer,
+                                  CL_TRUE,
+                                  sizeof(u32) * (PROGPV+depth*PROGSLOT),
+                                  sizeof(u32) * PROGSLOT,
+                                  slot,
+                                  0,
+                                  NULL,
+                                  NULL);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_Progress_Buffer)\n");
+      return false;
+    }
+    if (!slot[0])
+      return true;
+    status = clEnqueueReadBuffer(
+                                  stopQueue,
+                                  GLOBAL_Progress_Buffer,
+                                  CL_TRUE,
+                                  sizeof(u32) * (PROGCOUNT+depth*PROGNCOUNT*2),
+                                  sizeof(u32) * PROGNCOUNT*2,
+                                  counts,
+                                  0,
+                                  NULL,
+                                  NULL);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_Progress_Buffer)\n");
+      return false;
+    }
+  }
+
+  // generations used, depth after published one may have started
+  if ((u32)depth+2>ttgenused)
+    ttgenused = ((u32)depth+2<ttgenmax)?(u32)depth+2:ttgenmax;
+
+  // score and pv of depth
+  for (i=0;i<MAXPLY;i++)
+    PV[i] = (Move)slot[1+i];
+  // node counter totals of depth, as published by the device, kept in the
+  // slots of worker 0, full counters are read after the kernel finished
+  memset(COUNTERS, 0, totalWorkUnits * 64 * sizeof(u64));
+  for (i=0;i<PROGNCOUNT;i++)
+    COUNTERS[i+1] = (u64)counts[i*2]|(u64)counts[i*2+1]<<32;
+  // device pv as move order hints for host helper threads
+  if (mergekernel!=NULL)
+  {
+    if (!cpu_helpers_seed(PV))
+      return false;
+  }
+
+  *ready = true;
+
+  return true;
+}
+// wait until persistent search published depth, or kernel finished
+bool cl_wait_progress(s32 depth, double deadline, bool *completed)
+{
+  bool done = false;
+  bool stopped = false;
+
+  *completed = false;
+
+  while (true)
+  {
+    if (!cl_poll_progress(depth, completed, &done))
+      return false;
+    if (*completed||done)
+      break;
+    // deadline passed or move now requested by user
+    if (!stopped&&((deadline>0&&get_time()>=deadline)||MOVENOW))
+    {
+      if (!cl_stop_alphabeta())
+        return false;
+      stopped = true;
+    }
+    sleep_ms(1);
+  }
+
+  return true;
+}
+// set stop flag of running alphabeta kernel, the kernel polls it via
+// volatile reads, with zero-copy plain host store into the mapped pinned
+// buffer, else blocking write on second queue
+bool cl_stop_alphabeta(void)
+{
+  if (cpu_threads>0)
+    return cpu_stop_alphabeta();
+
+  if (zerocopy)
+  {
+    if (stopmap==NULL)
+      return false;
+    *stopmap = 0x1;
+    return true;
+  }
+
+  if (stopQueue==NULL)
+    return false;
+
+  status = clEnqueueWriteBuffer(
+                                stopQueue,
+                                GLOBAL_stop_Buffer,
+                                CL_TRUE,
+                                0,
+                                sizeof(u32) * 1,
+                                &stopone, 
+                                0,
+                                NULL,
+                                NULL);
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_stop_Buffer)\n");
+    return false;
+  }
+
+  return true;
+}
+// copy memory from device to host
+// non-blocking reads chained on kernel event, one wait per search run
+bool cl_read_memory(void)
+{
+  cl_event readevents[2] = {NULL, NULL};
+  cl_uint numkernelevents = (kernelevent!=NULL)?1:0;
+  double submit = get_time_mono();
+
+  // counters and pv are written by the search threads, wait for them
+  if (cpu_threads>0)
+  {
+    if (!cpu_wait_alphabeta(0))
+      return false;
+    hostoverhead += get_time_mono()-submit;
+    return true;
+  }
+
+  // copy counters buffer
+  status = clEnqueueReadBuffer(
+                                commandQueue,
+                                GLOBAL_COUNTERS_Buffer,
+                                CL_FALSE,
+                                0,
+                                totalWorkUnits * 64 * sizeof(u64),
+                                COUNTERS,
+                                numkernelevents,
+                                (numkernelevents>0)?&kernelevent:NULL,
+                                &readevents[0]);
+
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_COUNTERS_Buffer)\n");
+    cl_release_events(&kernelevent, 1);
+    return false;
+  }
+
+  // copy PV buffer
+  status = clEnqueueReadBuffer(
+                                commandQueue,
+                                GLOBAL_PV_Buffer,
+                                CL_FALSE,
                                 0,
-                                NULL,
-                                NULL);
+                                MAXPLY * sizeof(Move),
+                                PV,
+                                numkernelevents,
+                                (numkernelevents>0)?&kernelevent:NULL,
+                                &readevents[1]);
 
   if(status!=CL_SUCCESS)
   {
-    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_finito_Buffer)\n");
+    print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_PV_Buffer)\n");
+    cl_release_events(readevents, 2);
+    cl_release_events(&kernelevent, 1);
     return false;
   }
 
@@ -657,22 +1667,64 @@ bool cl_write_objects(void)
   status = clFlush(commandQueue);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: flushing the memory writes. (clFlush)\n");
+    print_debug((char *)"Error: flushing the memory reads. (clFlush)\n");
+    cl_release_events(readevents, 2);
+    cl_release_events(&kernelevent, 1);
     return false;
   }
 
-  // wait for queue to finish memory write ops
-  status = clFinish(commandQueue);
+  // single sync point, wait for kernel and memory reads to finish execution
+  status = clWaitForEvents(2, readevents);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Waiting for memory writes run to finish. (clFinish)\n");
+    print_debug((char *)"Error: Waiting for memory reads run to finish. (clWaitForEvents)\n");
+    cl_release_events(readevents, 2);
+    cl_release_events(&kernelevent, 1);
+    return false;
+  }
+  // host overhead includes the sync wait on the reads
+  hostoverhead += get_time_mono()-submit;
+
+  if (!cl_profile_events(readevents, 2, PROFREAD))
+  {
+    cl_release_events(readevents, 2);
+    cl_release_events(&kernelevent, 1);
+    return false;
+  }
+  if (!cl_profile_collect())
+  {
+    cl_release_events(readevents, 2);
+    cl_release_events(&kernelevent, 1);
+    return false;
+  }
+  if (!cl_release_events(readevents, 2))
+  {
+    cl_release_events(&kernelevent, 1);
     return false;
   }
+  if (!cl_release_events(&kernelevent, 1))
+    return false;
+  // device pv as move order hints for host helper threads
+  if (mergekernel!=NULL)
+  {
+    if (!cpu_helpers_seed(PV))
+      return false;
+  }
 
 	return true;
 }
-// run OpenCL bestfirst kernel, every search
-bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes)
+// stop host helper threads after search, their nodes into HELPERNODECOUNT
+bool cl_stop_helpers(void)
+{
+  HELPERNODECOUNT = 0;
+
+  if (cpu_threads>0||mergekernel==NULL)
+    return true;
+
+  return cpu_helpers_stop(&HELPERNODECOUNT);
+}
+// bind invariant kernel arguments once, called by cl_init_device
+static bool cl_bind_alphabeta(void)
 {
   s32 i = 0;
   // set kernel arguments
@@ -846,15 +1898,16 @@ bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes)
   }
   i++;
 
-  temp = (s32)stm;
+  i = ABARGSTM+4; // skip per launch arguments stm, ply, depth, max_nodes
+
   status = clSetKernelArg(
                           kernel, 
                           i, 
-                          sizeof(cl_int), 
-                          (void *)&temp);
+                          sizeof(cl_ulong), 
+                          (void *)&ttbits1);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (stm)\n");
+    print_debug((char *)"Error: Setting kernel argument. (ttindex1)\n");
     return false;
   }
   i++;
@@ -862,11 +1915,11 @@ bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes)
   status = clSetKernelArg(
                           kernel, 
                           i, 
-                          sizeof(cl_int), 
-                          (void *)&PLY);
+                          sizeof(cl_ulong), 
+                          (void *)&ttbits2);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (ply_init)\n");
+    print_debug((char *)"Error: Setting kernel argument. (ttindex2)\n");
     return false;
   }
   i++;
@@ -874,24 +1927,23 @@ bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes)
   status = clSetKernelArg(
                           kernel, 
                           i, 
-                          sizeof(cl_int), 
-                          (void *)&depth);
+                          sizeof(cl_mem), 
+                          (void *)&GLOBAL_finito_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (search_depth)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_finito_Buffer)\n");
     return false;
   }
   i++;
 
-
   status = clSetKernelArg(
                           kernel, 
                           i, 
-                          sizeof(cl_ulong), 
-                          (void *)&nodes);
+                          sizeof(cl_mem), 
+                          (void *)&GLOBAL_stop_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (max_nodes)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_stop_Buffer)\n");
     return false;
   }
   i++;
@@ -899,11 +1951,11 @@ bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes)
   status = clSetKernelArg(
                           kernel, 
                           i, 
-                          sizeof(cl_ulong), 
-                          (void *)&ttbits1);
+                          sizeof(cl_mem), 
+                          (void *)&GLOBAL_Checkpoint_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (ttindex1)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_Checkpoint_Buffer)\n");
     return false;
   }
   i++;
@@ -911,72 +1963,145 @@ bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes)
   status = clSetKernelArg(
                           kernel, 
                           i, 
-                          sizeof(cl_ulong), 
-                          (void *)&ttbits2);
+                          sizeof(cl_mem), 
+                          (void *)&GLOBAL_slicecount_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (ttindex2)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_slicecount_Buffer)\n");
     return false;
   }
   i++;
 
+  i = ABARGSLICE+2; // skip per launch arguments slice_nodes, resume
+
   status = clSetKernelArg(
                           kernel, 
                           i, 
                           sizeof(cl_mem), 
-                          (void *)&GLOBAL_finito_Buffer);
+                          (void *)&GLOBAL_Progress_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_finito_Buffer)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_Progress_Buffer)\n");
     return false;
   }
   i++;
 
-  // enqueue a kernel run call.
-  globalThreads[0] = (size_t)threadsX;
-  globalThreads[1] = (size_t)threadsY;
-  globalThreads[2] = (size_t)threadsZ;
-
-  localThreads[0]  = 1;
-  localThreads[1]  = 1;
-  localThreads[2]  = (size_t)threadsZ;
-
-  status = clEnqueueNDRangeKernel(
-	                                 commandQueue,
-                                   kernel,
-                                   maxDims,
-                                   NULL,
-                                   globalThreads,
-                                   localThreads,
-                                   0,
-                                   NULL,
-                                   NULL);
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGEXCLUDE, 
+                          sizeof(cl_mem), 
+                          (void *)&GLOBAL_RootExclude_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_RootExclude_Buffer)\n");
     return false;
   }
 
-  // flush command queueu
-  status = clFlush(commandQueue);
+  status = clSetKernelArg(
+                          kernel, 
+                          ABARGSPLIT, 
+                          sizeof(cl_mem), 
+                          (void *)&GLOBAL_RootSplit_Buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: flushing the Kernel. (clFlush)\n");
+    print_debug((char *)"Error: Setting kernel argument. (GLOBAL_RootSplit_Buffer)\n");
     return false;
   }
 
-  // wait for kernel to finish execution
-  status = clFinish(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: Waiting for kernel run to finish. (clFinish)\n");
-    return false;
+  // merge kernel, TT1 and staged host helper entries, count per launch
+  if (mergekernel!=NULL)
+  {
+    status = clSetKernelArg(
+                            mergekernel, 
+                            0, 
+                            sizeof(cl_mem), 
+                            (void *)&GLOBAL_TT1_Buffer);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (GLOBAL_TT1_Buffer)\n");
+      return false;
+    }
+    status = clSetKernelArg(
+                            mergekernel, 
+                            1, 
+                            sizeof(cl_mem), 
+                            (void *)&GLOBAL_Merge_Buffer);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (GLOBAL_Merge_Buffer)\n");
+      return false;
+    }
+    status = clSetKernelArg(
+                            mergekernel, 
+                            3, 
+                            sizeof(cl_ulong), 
+                            (void *)&ttbits1);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (ttindex1)\n");
+      return false;
+    }
+  }
+
+  // sample kernel, TT1, TT2, samples and tt sizes, ply per launch
+  if (samplekernel!=NULL)
+  {
+    status = clSetKernelArg(
+                            samplekernel, 
+                            0, 
+                            sizeof(cl_mem), 
+                            (void *)&GLOBAL_TT1_Buffer);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (GLOBAL_TT1_Buffer)\n");
+      return false;
+    }
+    status = clSetKernelArg(
+                            samplekernel, 
+                            1, 
+                            sizeof(cl_mem), 
+                            (void *)&GLOBAL_TT2_Buffer);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (GLOBAL_TT2_Buffer)\n");
+      return false;
+    }
+    status = clSetKernelArg(
+                            samplekernel, 
+                            2, 
+                            sizeof(cl_mem), 
+                            (void *)&GLOBAL_Sample_Buffer);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (GLOBAL_Sample_Buffer)\n");
+      return false;
+    }
+    status = clSetKernelArg(
+                            samplekernel, 
+                            3, 
+                            sizeof(cl_ulong), 
+                            (void *)&ttbits1);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (ttindex1)\n");
+      return false;
+    }
+    status = clSetKernelArg(
+                            samplekernel, 
+                            4, 
+                            sizeof(cl_ulong), 
+                            (void *)&ttbits2);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (ttindex2)\n");
+      return false;
+    }
   }
 
   return true;
 }
-// run OpenCL bestfirst kernel, every search
-bool cl_run_perft(bool stm, s32 depth)
+// bind invariant kernel arguments once, called by cl_init_device
+static bool cl_bind_perft(void)
 {
   s32 i = 0;
   // set kernel arguments
@@ -1052,221 +2177,483 @@ bool cl_run_perft(bool stm, s32 depth)
   }
   i++;
 
-  temp = (s32)stm;
+  return true;
+}
+// zero device buffer of size in bytes via clear kernel
+static bool cl_clear_buffer(cl_mem buffer, u64 size)
+{
+  u64 offset;
+  u64 elements = size/sizeof(u32);
+  size_t clearThreads[1];
+
   status = clSetKernelArg(
-                          kernel, 
-                          i, 
-                          sizeof(cl_int), 
-                          (void *)&temp);
+                          clearkernel, 
+                          0, 
+                          sizeof(cl_mem), 
+                          (void *)&buffer);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (stm)\n");
+    print_debug((char *)"Error: Setting kernel argument. (buffer)\n");
     return false;
   }
-  i++;
-
   status = clSetKernelArg(
-                          kernel, 
-                          i, 
-                          sizeof(cl_int), 
-                          (void *)&PLY);
+                          clearkernel, 
+                          2, 
+                          sizeof(cl_ulong), 
+                          (void *)&elements);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (ply_init)\n");
+    print_debug((char *)"Error: Setting kernel argument. (size)\n");
     return false;
   }
-  i++;
+  // clear in chunks, keep global work size in range
+  for (offset=0;offset<elements;offset+=CLEARCHUNK)
+  {
+    clearThreads[0] = (size_t)((elements-offset>CLEARCHUNK)?CLEARCHUNK:elements-offset);
 
-  status = clSetKernelArg(
-                          kernel, 
-                          i, 
-                          sizeof(cl_int), 
-                          (void *)&depth);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: Setting kernel argument. (search_depth)\n");
+    status = clSetKernelArg(
+                            clearkernel, 
+                            1, 
+                            sizeof(cl_ulong), 
+                            (void *)&offset);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Setting kernel argument. (offset)\n");
+      return false;
+    }
+    status = clEnqueueNDRangeKernel(
+                                    commandQueue,
+                                    clearkernel,
+                                    1,
+                                    NULL,
+                                    clearThreads,
+                                    NULL,
+                                    0,
+                                    NULL,
+                                    NULL);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Enqueueing kernel onto command queue. (clear_buffer)\n");
+      return false;
+    }
+  }
+  return true;
+}
+// map buffer into host address space once, blocking, host allocated
+// buffers stay pinned, the host accesses them via the returned pointer
+static void *cl_map_buffer(cl_mem buffer, size_t size)
+{
+  void *ptr;
+
+  ptr = clEnqueueMapBuffer(
+                            commandQueue,
+                            buffer,
+                            CL_TRUE,
+                            CL_MAP_READ | CL_MAP_WRITE,
+                            0,
+                            size,
+                            0,
+                            NULL,
+                            NULL,
+                            &status);
+  if(status!=CL_SUCCESS||ptr==NULL)
+  {
+    print_debug((char *)"Error: Mapping buffer to host. (clEnqueueMapBuffer)\n");
+    return NULL;
+  }
+  return ptr;
+}
+// unmap buffer mapped by cl_map_buffer, before release of buffer
+static bool cl_unmap_buffer(cl_mem buffer, void *ptr)
+{
+  status = clEnqueueUnmapMemObject(
+                                    commandQueue,
+                                    buffer,
+                                    ptr,
+                                    0,
+                                    NULL,
+                                    NULL);
+  if(status==CL_SUCCESS)
+    status = clFinish(commandQueue);
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: Unmapping buffer. (clEnqueueUnmapMemObject)\n");
     return false;
   }
-  i++;
+  return true;
+}
+// upload exported host helper TT entries and enqueue merge kernel,
+// invariant arguments are bound by cl_init_device
+static bool cl_merge_helpers(void)
+{
+  size_t mergeThreads[1];
 
+  mergecount = cpu_helpers_export(mergeentries);
+  if (mergecount==0)
+    return true;
 
+  status = clEnqueueWriteBuffer(
+                                commandQueue,
+                                GLOBAL_Merge_Buffer,
+                                CL_FALSE,
+                                0,
+                                sizeof(TTE) * mergecount,
+                                mergeentries, 
+                                0,
+                                NULL,
+                                &writeevents[numwriteevents++]);
+  if(status!=CL_SUCCESS)
+  {
+    print_debug((char *)"Error: clEnqueueWriteBuffer failed. (GLOBAL_Merge_Buffer)\n");
+    return false;
+  }
   status = clSetKernelArg(
-                          kernel, 
-                          i, 
+                          mergekernel, 
+                          2, 
                           sizeof(cl_ulong), 
-                          (void *)&MaxNodes);
+                          (void *)&mergecount);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Setting kernel argument. (max_nodes)\n");
+    print_debug((char *)"Error: Setting kernel argument. (count)\n");
     return false;
   }
-  i++;
-
-  // enqueue a kernel run call.
-  globalThreads[0] = 1;
-  globalThreads[1] = 1;
-  globalThreads[2] = (size_t)threadsZ;
 
-  localThreads[0]  = 1;
-  localThreads[1]  = 1;
-  localThreads[2]  = (size_t)threadsZ;
+  mergeThreads[0] = (size_t)mergecount;
 
   status = clEnqueueNDRangeKernel(
-	                                 commandQueue,
-                                   kernel,
-                                   maxDims,
-                                   NULL,
-                                   globalThreads,
-                                   localThreads,
-                                   0,
-                                   NULL,
-                                   NULL);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: Enqueueing kernel onto command queue. (clEnqueueNDRangeKernel)\n");
-    return false;
-  }
-
-  // flush command queueu
-  status = clFlush(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: flushing the Kernel. (clFlush)\n");
-    return false;
-  }
-
-  // wait for kernel to finish execution
-  status = clFinish(commandQueue);
+                                  commandQueue,
+                                  mergekernel,
+                                  1,
+                                  NULL,
+                                  mergeThreads,
+                                  NULL,
+                                  0,
+                                  NULL,
+                                  NULL);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Waiting for kernel run to finish. (clFinish)\n");
+    print_debug((char *)"Error: Enqueueing kernel onto command queue. (merge_tt)\n");
     return false;
   }
-
   return true;
 }
-
-// copy memory from device to host
-bool cl_read_memory(void)
+// reset device tables for a new game, keeps context, program and buffers
+bool cl_reset_device(void)
 {
-//  cl_event events[2];
+  if (cpu_threads>0)
+    return cpu_reset_device();
 
-  // copy counters buffer
-  status = clEnqueueReadBuffer(
-                                commandQueue,
-                                GLOBAL_COUNTERS_Buffer,
-                                CL_TRUE,
-                                0,
-                                totalWorkUnits * 64 * sizeof(u64),
-                                COUNTERS,
-                                0,
-                                NULL,
-                                NULL);
+  if (clearkernel==NULL||commandQueue==NULL)
+    return false;
 
-  if(status!=CL_SUCCESS)
-  {
-    print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_COUNTERS_Buffer)\n");
+  if (!cl_clear_buffer(GLOBAL_TT1_Buffer, sizeof(TTE)*mem1))
+    return false;
+  if (!cl_clear_buffer(GLOBAL_TT2_Buffer, tt2entry*mem2))
+    return false;
+  if (!cl_clear_buffer(GLOBAL_Killer_Buffer, sizeof(TTMove)*totalWorkUnits*MAXPLY))
+    return false;
+  if (!cl_clear_buffer(GLOBAL_Counter_Buffer, sizeof(TTMove)*totalWorkUnits*64*64))
     return false;
+
+  // host helper threads, stop before their TT is cleared
+  if (mergekernel!=NULL)
+  {
+    if (!cpu_stop_alphabeta())
+      return false;
+    if (!cpu_reset_device())
+      return false;
   }
 
   // flush command queue
   status = clFlush(commandQueue);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: flushing the memory reads. (clFlush)\n");
+    print_debug((char *)"Error: flushing the clear kernels. (clFlush)\n");
     return false;
   }
-
-/*
-  // wait for memory reads to finish execution
+  // wait for queue to finish clear kernels
   status = clFinish(commandQueue);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Waiting for memory reads run to finish. (clFinish)\n");
+    print_debug((char *)"Error: Waiting for clear kernels to finish. (clFinish)\n");
     return false;
   }
-*/
 
-/*
-  // wait for the read buffer to finish execution
-  status = clWaitForEvents(1, &events[1]);
+  return true;
+}
+// sample TT1 and TT2 at even strides, TTSAMPLESIZE s32 per sample,
+// after search, device idle
+bool cl_sample_tt(s32 *samples)
+{
+  size_t sampleThreads[1] = { TTSAMPLES };
+  s32 ply = (s32)PLY;
+
+  if (cpu_threads>0)
+    return cpu_sample_tt(samples);
+
+  if (samplekernel==NULL||commandQueue==NULL)
+    return false;
+
+  status = clSetKernelArg(
+                          samplekernel, 
+                          5, 
+                          sizeof(cl_int), 
+                          (void *)&ply);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Waiting for read buffer call to finish. (GLOBAL_COUNTERS_Buffer)\n");
+    print_debug((char *)"Error: Setting kernel argument. (ply_init)\n");
     return false;
   }
-  status = clReleaseEvent(events[1]);
+  status = clEnqueueNDRangeKernel(
+                                  commandQueue,
+                                  samplekernel,
+                                  1,
+                                  NULL,
+                                  sampleThreads,
+                                  NULL,
+                                  0,
+                                  NULL,
+                                  NULL);
   if(status!=CL_SUCCESS) 
   { 
-    print_debug((char *)"Error: Release event object.(GLOBAL_COUNTERS_Buffer)\n");
+    print_debug((char *)"Error: Enqueueing kernel onto command queue. (sample_tt)\n");
     return false;
   }
-*/
-  // copy PV buffer
   status = clEnqueueReadBuffer(
                                 commandQueue,
-                                GLOBAL_PV_Buffer,
+                                GLOBAL_Sample_Buffer,
                                 CL_TRUE,
                                 0,
-                                MAXPLY * sizeof(Move),
-                                PV,
+                                sizeof(s32) * TTSAMPLES * TTSAMPLESIZE,
+                                samples,
                                 0,
                                 NULL,
                                 NULL);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_Sample_Buffer)\n");
+    return false;
+  }
+  // packed TT2 samples search generation, age in plies via game ply of it
+  if (tt2entry==sizeof(ABDADATTEPACKED))
+  {
+    for (u64 i=0;i<TTSAMPLES;i++)
+    {
+      if (samples[i*TTSAMPLESIZE+3]>0)
+        samples[i*TTSAMPLESIZE+4] = ply-ttgenply[samples[i*TTSAMPLESIZE+4]&0xFF];
+    }
+  }
 
-  if(status!=CL_SUCCESS)
+  return true;
+}
+// layout flags of current tables for TT file header
+static u32 cl_tt_layout(void)
+{
+  u32 layout = 0;
+
+  if (tt_buckets&&ttbits1>=TTBUCKETSIZE)
+    layout |= TTFILEBUCKET;
+  if (cpu_threads==0&&ttunified)
+    layout |= TTFILEUNIFIED;
+  if (cpu_threads==0&&tt2entry==sizeof(ABDADATTEPACKED))
+    layout |= TTFILECOMPACT;
+
+  return layout;
+}
+// stream device buffer from or to file in chunks, two host chunks in flight
+// so disk io and device transfers overlap, file written in buffer order
+static bool cl_stream_tt(cl_mem buffer, u64 size, FILE *fd, bool load)
+{
+  u8 *chunks[2] = { NULL, NULL };
+  cl_event events[2] = { NULL, NULL };
+  u64 lens[2] = { 0, 0 };
+  u64 offset;
+  u64 len = 0;
+  s32 c = 0;
+  bool ok = true;
+
+  chunks[0] = (u8 *)malloc(TTFILECHUNK);
+  chunks[1] = (u8 *)malloc(TTFILECHUNK);
+  if (chunks[0]==NULL||chunks[1]==NULL)
   {
-    print_debug((char *)"Error: clEnqueueReadBuffer failed. (GLOBAL_PV_Buffer)\n");
-    return false;
+    print_debug((char *)"Error: Allocating TT file chunks. (cl_stream_tt)\n");
+    ok = false;
   }
 
-  // flush command queue
-  status = clFlush(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: flushing the memory reads. (clFlush)\n");
-    return false;
+  for (offset=0;ok&&offset<size;offset+=len)
+  {
+    len = (size-offset>TTFILECHUNK)?TTFILECHUNK:size-offset;
+    // host chunk free after its previous transfer, on save write it out
+    if (events[c]!=NULL)
+    {
+      ok = (clWaitForEvents(1, &events[c])==CL_SUCCESS)?true:false;
+      clReleaseEvent(events[c]);
+      events[c] = NULL;
+      if (ok&&!load)
+        ok = (fwrite(chunks[c], 1, lens[c], fd)==lens[c])?true:false;
+    }
+    if (ok&&load)
+      ok = (fread(chunks[c], 1, len, fd)==len)?true:false;
+    if (ok)
+    {
+      if (load)
+        status = clEnqueueWriteBuffer(commandQueue, buffer, CL_FALSE, offset, len, chunks[c], 0, NULL, &events[c]);
+      else
+        status = clEnqueueReadBuffer(commandQueue, buffer, CL_FALSE, offset, len, chunks[c], 0, NULL, &events[c]);
+      if (status==CL_SUCCESS)
+        status = clFlush(commandQueue);
+      ok = (status==CL_SUCCESS)?true:false;
+      lens[c] = len;
+    }
+    c ^= 1;
+  }
+  // drain older chunk first
+  for (s32 i=0;i<2;i++)
+  {
+    if (events[c]!=NULL)
+    {
+      if (clWaitForEvents(1, &events[c])!=CL_SUCCESS)
+        ok = false;
+      clReleaseEvent(events[c]);
+      events[c] = NULL;
+      if (ok&&!load)
+        ok = (fwrite(chunks[c], 1, lens[c], fd)==lens[c])?true:false;
+    }
+    c ^= 1;
   }
 
-  // wait for memory reads to finish execution
-  status = clFinish(commandQueue);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: Waiting for memory reads run to finish. (clFinish)\n");
-    return false;
+  if (chunks[0]!=NULL)
+    free(chunks[0]);
+  if (chunks[1]!=NULL)
+    free(chunks[1]);
+
+  return ok;
+}
+// save TT1 and optionally TT2 to file, header with version, layout and sizes
+bool cl_save_tt(char *filename, bool tt2)
+{
+  TTFILE header;
+  TTE *cputt = NULL;
+  FILE *fd;
+  bool ok;
+
+  memset(&header, 0, sizeof(TTFILE));
+  header.magic      = TTFILEMAGIC;
+  header.version    = TTFILEVERSION;
+  header.layout     = cl_tt_layout();
+  header.tt1entries = ttbits1;
+  header.tt1size    = (header.layout&TTFILEUNIFIED)?sizeof(TTEUNIFIED):sizeof(TTE);
+  header.tt2entries = (tt2&&cpu_threads==0&&mem2>1)?mem2:0;
+  header.tt2size    = tt2entry;
+
+  if (cpu_threads>0)
+  {
+    cputt = cpu_tt_table();
+    if (cputt==NULL)
+    {
+      print_debug((char *)"Error: No hash table to save. (cl_save_tt)\n");
+      return false;
+    }
   }
-/*
-  // wait for the read buffer to finish execution
-  status = clWaitForEvents(1, &events[1]);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: Waiting for read buffer call to finish. (GLOBAL_PV_Buffer)\n");
+  else if (GLOBAL_TT1_Buffer==NULL||commandQueue==NULL)
+  {
+    print_debug((char *)"Error: No hash table to save. (cl_save_tt)\n");
     return false;
   }
-  status = clReleaseEvent(events[1]);
-  if(status!=CL_SUCCESS) 
-  { 
-    print_debug((char *)"Error: Release event object.(GLOBAL_PV_Buffer)\n");
+
+  fd = fopen(filename, "wb");
+  if (fd==NULL)
+  {
+    print_debug((char *)"Error: Opening TT file. (cl_save_tt)\n");
     return false;
   }
-*/
 
+  ok = (fwrite(&header, sizeof(TTFILE), 1, fd)==1)?true:false;
+  if (ok&&cputt!=NULL)
+    ok = (fwrite(cputt, header.tt1size, header.tt1entries, fd)==header.tt1entries)?true:false;
+  else if (ok)
+    ok = cl_stream_tt(GLOBAL_TT1_Buffer, header.tt1entries*header.tt1size, fd, false);
+  if (ok&&header.tt2entries>0)
+    ok = cl_stream_tt(GLOBAL_TT2_Buffer, header.tt2entries*header.tt2size, fd, false);
+  if (fclose(fd)!=0)
+    ok = false;
 
-/* keep build program across game play
+  if (!ok)
+    print_debug((char *)"Error: Writing TT file. (cl_save_tt)\n");
 
-  status = clReleaseProgram(program);
-  if(status!=CL_SUCCESS)
+  return ok;
+}
+// load TT1 and TT2 if present from file, layout and sizes must match config,
+// TT2 of other size is skipped
+bool cl_load_tt(char *filename)
+{
+  TTFILE header;
+  TTE *cputt = NULL;
+  FILE *fd;
+  bool ok;
+
+  if (cpu_threads>0)
   {
-    print_debug((char *)"Error: In clReleaseProgram\n");
-    return false; 
+    cputt = cpu_tt_table();
+    if (cputt==NULL)
+    {
+      print_debug((char *)"Error: No hash table to load. (cl_load_tt)\n");
+      return false;
+    }
+  }
+  else if (GLOBAL_TT1_Buffer==NULL||commandQueue==NULL)
+  {
+    print_debug((char *)"Error: No hash table to load. (cl_load_tt)\n");
+    return false;
   }
-*/
 
-	return true;
+  fd = fopen(filename, "rb");
+  if (fd==NULL)
+  {
+    print_debug((char *)"Error: Opening TT file. (cl_load_tt)\n");
+    return false;
+  }
+
+  if (fread(&header, sizeof(TTFILE), 1, fd)!=1
+      ||header.magic!=TTFILEMAGIC
+      ||header.version!=TTFILEVERSION)
+  {
+    print_debug((char *)"Error: TT file of other version or hash scheme. (cl_load_tt)\n");
+    fclose(fd);
+    return false;
+  }
+  if (header.layout!=cl_tt_layout()
+      ||header.tt1entries!=ttbits1
+      ||header.tt1size!=((header.layout&TTFILEUNIFIED)?sizeof(TTEUNIFIED):sizeof(TTE)))
+  {
+    print_debug((char *)"Error: TT file layout or size differs from config. (cl_load_tt)\n");
+    fclose(fd);
+    return false;
+  }
+
+  if (cputt!=NULL)
+    ok = (fread(cputt, header.tt1size, header.tt1entries, fd)==header.tt1entries)?true:false;
+  else
+    ok = cl_stream_tt(GLOBAL_TT1_Buffer, header.tt1entries*header.tt1size, fd, true);
+  if (ok
+      &&cpu_threads==0
+      &&header.tt2entries>0
+      &&header.tt2entries==mem2
+      &&header.tt2size==tt2entry)
+    ok = cl_stream_tt(GLOBAL_TT2_Buffer, header.tt2entries*header.tt2size, fd, true);
+  fclose(fd);
+
+  if (!ok)
+    print_debug((char *)"Error: Reading TT file. (cl_load_tt)\n");
+
+  return ok;
 }
 // release OpenCL device
 bool cl_release_device(void) 
 {
+  if (cpu_threads>0)
+    return cpu_release_device();
+
   // release memory buffers
   if (GLOBAL_BOARD_Buffer!=NULL)
   {
@@ -1435,7 +2822,52 @@ bool cl_release_device(void)
     GLOBAL_finito_Buffer=NULL;
 	}
 
+  // release pending events
+  cl_release_events(writeevents, numwriteevents);
+  numwriteevents = 0;
+  cl_release_events(profevents, numprofevents);
+  numprofevents = 0;
+  cl_release_events(&kernelevent, 1);
+
   // release cl objects
+  if (mergekernel!=NULL)
+  {
+    // host helper threads, stopped and joined
+    if (!cpu_release_device())
+      return false;
+    status = clReleaseKernel(mergekernel);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseKernel (mergekernel)\n");
+      return false; 
+    }
+    mergekernel=NULL;
+  }
+  if (mergeentries!=NULL)
+    free(mergeentries);
+  mergeentries = NULL;
+  if (samplekernel!=NULL)
+  {
+    status = clReleaseKernel(samplekernel);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseKernel (samplekernel)\n");
+      return false; 
+    }
+    samplekernel=NULL;
+  }
+
+  if (clearkernel!=NULL)
+  {
+    status = clReleaseKernel(clearkernel);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseKernel (clearkernel)\n");
+      return false; 
+    }
+    clearkernel=NULL;
+  }
+
   if (kernel!=NULL)
   {
     status = clReleaseKernel(kernel);
@@ -1447,6 +2879,111 @@ bool cl_release_device(void)
     kernel=NULL;
   }
 
+  if (GLOBAL_Checkpoint_Buffer!=NULL)
+  {
+    status = clReleaseMemObject(GLOBAL_Checkpoint_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_Checkpoint_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_Checkpoint_Buffer=NULL;
+  }
+
+  if (GLOBAL_slicecount_Buffer!=NULL)
+  {
+    status = clReleaseMemObject(GLOBAL_slicecount_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_slicecount_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_slicecount_Buffer=NULL;
+  }
+
+  if (GLOBAL_RootExclude_Buffer!=NULL)
+  {
+    status = clReleaseMemObject(GLOBAL_RootExclude_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_RootExclude_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_RootExclude_Buffer=NULL;
+  }
+
+  if (GLOBAL_RootSplit_Buffer!=NULL)
+  {
+    status = clReleaseMemObject(GLOBAL_RootSplit_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_RootSplit_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_RootSplit_Buffer=NULL;
+  }
+
+  if (GLOBAL_Merge_Buffer!=NULL)
+  {
+    status = clReleaseMemObject(GLOBAL_Merge_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_Merge_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_Merge_Buffer=NULL;
+  }
+
+  if (GLOBAL_Sample_Buffer!=NULL)
+  {
+    status = clReleaseMemObject(GLOBAL_Sample_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_Sample_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_Sample_Buffer=NULL;
+  }
+
+  if (GLOBAL_Progress_Buffer!=NULL)
+  {
+    if (progressmap!=NULL&&!cl_unmap_buffer(GLOBAL_Progress_Buffer, (void *)progressmap))
+      return false;
+    progressmap = NULL;
+    status = clReleaseMemObject(GLOBAL_Progress_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_Progress_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_Progress_Buffer=NULL;
+  }
+
+  if (GLOBAL_stop_Buffer!=NULL)
+  {
+    if (stopmap!=NULL&&!cl_unmap_buffer(GLOBAL_stop_Buffer, (void *)stopmap))
+      return false;
+    stopmap = NULL;
+    status = clReleaseMemObject(GLOBAL_stop_Buffer);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseMemObject (GLOBAL_stop_Buffer)\n");
+      return false; 
+    }
+    GLOBAL_stop_Buffer=NULL;
+  }
+
+  if (stopQueue!=NULL)
+  {
+    status = clReleaseCommandQueue(stopQueue);
+    if(status!=CL_SUCCESS)
+    {
+      print_debug((char *)"Error: In clReleaseCommandQueue (stopQueue)\n");
+      return false;
+    }
+    stopQueue=NULL;
+  }
+
   if (commandQueue!=NULL)
   {
     status = clReleaseCommandQueue(commandQueue);
@@ -1505,3 +3042,288 @@ void print_debug(char *debug)
   fclose(Stats);
 }
 
+// FNV-1a hash, used as key for the program binary cache
+static u64 fnv1a(u64 hash, const char *data, size_t len)
+{
+  size_t i;
+  for (i=0;i<len;i++)
+  {
+    hash ^= (u8)data[i];
+    hash *= 0x100000001B3ULL;
+  }
+  return hash;
+}
+// build program from source and print build log on failure
+static bool cl_build_program_source(const char *content, size_t len)
+{
+  program = clCreateProgramWithSource(
+                          	          context, 
+                                      1, 
+                                      &content,
+                            		      &len,
+                                      &status);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Loading Source into cl_program (clCreateProgramWithSource)\n");
+    return false;
+  }   
+  // create program for all the devices specified */
+  status = clBuildProgram(program, 
+                          1, 
+                          &devices[opencl_device_id], 
+                          coptions, 
+                          NULL, 
+                          NULL
+                         );
+  // get build log and print
+  if(status!=CL_SUCCESS) 
+  { 
+    char* build_log=0;
+    size_t log_size=0;
+    FILE 	*temp=0;
+
+    print_debug((char *)"Error: Building Program (clBuildProgram)\n");
+    // shows the log
+    // first call to know the proper size
+    clGetProgramBuildInfo(program, 
+                          devices[opencl_device_id], 
+                          CL_PROGRAM_BUILD_LOG, 
+                          0, 
+                          NULL, 
+                          &log_size
+                         );
+    build_log = (char *) malloc(log_size+1);
+    // second call to get the log
+    status = clGetProgramBuildInfo(program, 
+                                   devices[opencl_device_id], 
+                                   CL_PROGRAM_BUILD_LOG, 
+                                   log_size, 
+                                   build_log, 
+                                   NULL
+                                  );
+    //build_log[log_size] = '\0';
+    temp = fopen(LOGFILE, "a");
+    fprintdate(temp);
+    fprintf(temp, "buildlog: %s \n", build_log);
+    fclose(temp);
+    if(status!=CL_SUCCESS) 
+    { 
+      print_debug((char *)"Error: Building Log (clGetProgramBuildInfo)\n");
+    }
+    free(build_log);
+    return false;
+  }
+  return true;
+}
+// try to load and build program from cached binary file
+static bool cl_load_program_binary(char *filename)
+{
+  FILE *fcache;
+  unsigned char *binary;
+  size_t size;
+  cl_int binstatus;
+
+  fcache = fopen(filename, "rb");
+  if (fcache==NULL)
+    return false;
+  fseek(fcache, 0, SEEK_END);
+  size = (size_t)ftell(fcache);
+  fseek(fcache, 0, SEEK_SET);
+  binary = (unsigned char *)malloc(size);
+  if (binary==NULL||size==0||fread(binary, 1, size, fcache)!=size)
+  {
+    free(binary);
+    fclose(fcache);
+    return false;
+  }
+  fclose(fcache);
+
+  program = clCreateProgramWithBinary(
+                                      context,
+                                      1,
+                                      &devices[opencl_device_id],
+                                      &size,
+                                      (const unsigned char **)&binary,
+                                      &binstatus,
+                                      &status);
+  free(binary);
+  if(status!=CL_SUCCESS||binstatus!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Loading Binary into cl_program, rebuilding from source (clCreateProgramWithBinary)\n");
+    if (program)
+      clReleaseProgram(program);
+    program = NULL;
+    return false;
+  }   
+  status = clBuildProgram(program, 
+                          1, 
+                          &devices[opencl_device_id], 
+                          coptions, 
+                          NULL, 
+                          NULL
+                         );
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Building Program from Binary, rebuilding from source (clBuildProgram)\n");
+    clReleaseProgram(program);
+    program = NULL;
+    return false;
+  }
+  return true;
+}
+// store binary of built program to cache file
+static void cl_save_program_binary(char *filename)
+{
+  FILE *fcache;
+  unsigned char *binary;
+  size_t size = 0;
+
+  status = clGetProgramInfo(program,
+                            CL_PROGRAM_BINARY_SIZES,
+                            sizeof(size_t),
+                            &size,
+                            NULL);
+  if(status!=CL_SUCCESS||size==0) 
+  { 
+    print_debug((char *)"Error: Query Program Binary Size (clGetProgramInfo)\n");
+    return;
+  }
+  binary = (unsigned char *)malloc(size);
+  if (binary==NULL)
+    return;
+  status = clGetProgramInfo(program,
+                            CL_PROGRAM_BINARIES,
+                            sizeof(unsigned char *),
+                            &binary,
+                            NULL);
+  if(status!=CL_SUCCESS) 
+  { 
+    print_debug((char *)"Error: Query Program Binary (clGetProgramInfo)\n");
+    free(binary);
+    return;
+  }
+  fcache = fopen(filename, "wb");
+  if (fcache!=NULL)
+  {
+    if (fwrite(binary, 1, size, fcache)!=size)
+    {
+      fclose(fcache);
+      remove(filename);
+    }
+    else
+      fclose(fcache);
+  }
+  free(binary);
+}
+// check device extensions string of selected device for extension name
+static bool cl_device_extension(const char *name)
+{
+  char *extensions;
+  size_t size = 0;
+  bool found = false;
+
+  status = clGetDeviceInfo(devices[opencl_device_id],
+                           CL_DEVICE_EXTENSIONS,
+                           0,
+                           NULL,
+                           &size);
+  if (status!=CL_SUCCESS||size==0)
+    return false;
+
+  extensions = (char *)calloc(size+1, sizeof(char));
+  if (extensions==NULL)
+    return false;
+
+  status = clGetDeviceInfo(devices[opencl_device_id],
+                           CL_DEVICE_EXTENSIONS,
+                           size,
+                           extensions,
+                           NULL);
+  if (status==CL_SUCCESS&&strstr(extensions, name))
+    found = true;
+
+  free(extensions);
+
+  return found;
+}
+// generate -D build options from config and device, so the compiler can fold
+// session constants, each set of options gets its own cached binary
+static void cl_build_options(char *kernelname)
+{
+  s32 n = 0;
+
+  coptions[0] = '\0';
+
+  if (opencl_specialize&&strstr(kernelname, "alphabeta_gpu"))
+  {
+    n = snprintf(coptions, 
+                 sizeof(coptions), 
+                 "-DTTINDEX1=%" PRIu64 "UL -DTTINDEX2=%" PRIu64 "UL -DTOTALWORKERS=%" PRIu64 " ",
+                 ttbits1,
+                 ttbits2,
+                 totalWorkUnits);
+    // atomics path by device generation, 0 = guess from device extensions
+    if (opencl_gpugen>0&&n>0&&(size_t)n<sizeof(coptions))
+      n += snprintf(coptions+n, 
+                    sizeof(coptions)-n, 
+                    "-DGPUGEN=%d ", 
+                    opencl_gpugen);
+  }
+  // TT2 layout, packed ABDADA entries
+  if (tt2entry==sizeof(ABDADATTEPACKED)&&strstr(kernelname, "alphabeta_gpu")&&n>=0&&(size_t)n<sizeof(coptions))
+    n += snprintf(coptions+n, 
+                  sizeof(coptions)-n, 
+                  "-DTT2COMPACT ");
+  // TT1 layout, abdada lock inside entries, also read by merge kernel
+  if (ttunified&&strstr(kernelname, "alphabeta_gpu")&&n>=0&&(size_t)n<sizeof(coptions))
+    n += snprintf(coptions+n, 
+                  sizeof(coptions)-n, 
+                  "-DTTUNIFIED=1 ");
+  // TT1 layout, buckets of 64 bytes, also read by merge kernel
+  if (tt_buckets&&ttbits1>=TTBUCKETSIZE&&strstr(kernelname, "alphabeta_gpu")&&n>=0&&(size_t)n<sizeof(coptions))
+    n += snprintf(coptions+n, 
+                  sizeof(coptions)-n, 
+                  "-DTTBUCKET=%d ", 
+                  TTBUCKETSIZE);
+  // user options from config, also to override LMRR, NULLR, RMO, RANDWORKERS
+  if (n>=0&&(size_t)n<sizeof(coptions))
+    snprintf(coptions+n, sizeof(coptions)-n, "%s", opencl_options);
+}
+// build program, reuse cached binary keyed by device, driver, options, source
+static bool cl_build_program(char *kernelname, const char *content, size_t len)
+{
+  char devicename[256] = "";
+  char driverversion[256] = "";
+  char filename[256];
+  u64 key = 0xCBF29CE484222325ULL;
+
+  clGetDeviceInfo(devices[opencl_device_id],
+                  CL_DEVICE_NAME,
+                  sizeof(devicename),
+                  devicename,
+                  NULL);
+  clGetDeviceInfo(devices[opencl_device_id],
+                  CL_DRIVER_VERSION,
+                  sizeof(driverversion),
+                  driverversion,
+                  NULL);
+  devicename[255] = '\0';
+  driverversion[255] = '\0';
+
+  key = fnv1a(key, devicename, strlen(devicename)+1);
+  key = fnv1a(key, driverversion, strlen(driverversion)+1);
+  key = fnv1a(key, coptions, strlen(coptions)+1);
+  key = fnv1a(key, content, len);
+
+  snprintf(filename, sizeof(filename), CLBINCACHE, kernelname, key);
+
+  if (cl_load_program_binary(filename))
+    return true;
+
+  if (!cl_build_program_source(content, len))
+    return false;
+
+  cl_save_program_binary(filename);
+
+  return true;
+}
@@ -22,11 +22,23 @@
 #ifndef CLRUN_H_INCLUDED
 #define CLRUN_H_INCLUDED
 
+// number of tt entries, sized by cl_init_device
+extern u64 ttbits1;
+
 bool cl_init_device(char *kernelname);
 bool cl_write_objects(void);
-bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes);
+bool cl_run_alphabeta(bool stm, s32 depth, u64 nodes, Score alpha, Score beta, bool persistent);
 bool cl_run_perft(bool stm, s32 depth);
+bool cl_wait_alphabeta(double deadline);
+bool cl_poll_progress(s32 depth, bool *ready, bool *done);
+bool cl_wait_progress(s32 depth, double deadline, bool *completed);
+bool cl_stop_alphabeta(void);
 bool cl_read_memory(void);
+bool cl_stop_helpers(void);
+bool cl_reset_device(void);
+bool cl_sample_tt(s32 *samples);
+bool cl_save_tt(char *filename, bool tt2);
+bool cl_load_tt(char *filename);
 bool cl_release_device(void);
 
 #endif /* CLRUN_H_INCLUDED */
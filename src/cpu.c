@@ -0,0 +1,1283 @@
+/*
+  Name:         Zeta
+  Description:  Experimental chess engine written in OpenCL.
+  Author:       Srdja Matovic <s.matovic@app26.de>
+  Created at:   2019-07-14
+  Updated at:   2019
+  License:      GPL >= v2
+
+  Copyright (C) 2011-2019 Srdja Matovic
+
+  Zeta is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  Zeta is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+*/
+
+#include <pthread.h>    // for search threads
+#include <stdio.h>      // for print
+#include <stdlib.h>     // for alloc
+#include <string.h>     // for memcpy and memset
+
+#include "bit.h"        // bit functions
+#include "bitboard.h"   // move generation and domove helpers
+#include "clrun.h"      // tt size
+#include "cpu.h"        // native CPU search
+#include "timer.h"      // timer functions
+#include "types.h"      // types and defaults and macros
+#include "zeta.h"       // for global vars
+
+// search tunables, consider also zeta.cl file
+#define LMRR            1 // late move reduction
+#define NULLR           2 // null move reduction
+#define RANDBRO         1 // how many brothers searched before randomized order
+#define MOVESCOREINF    0x7FFFFFFF
+#define HELPERDRAFT     3 // min draft of helper TT entries merged into device TT
+
+// piece values
+// pnone, pawn, knight, king, bishop, rook, queen
+// consider also zeta.cl file
+static const Score EvalPieceValues[7] = {0, 100, 400, 0, 400, 600, 1200};
+// square control bonus, black view
+// flop square for white-index: sq^56
+static const Score EvalControl[64] =
+{
+    0,  0,  5,  5,  5,  5,  0,  0,
+    5,  0,  5,  5,  5,  5,  0,  5,
+    0,  0, 10,  5,  5, 10,  0,  0,
+    0,  5,  5, 10, 10,  5,  5,  0,
+    0,  5,  5, 10, 10,  5,  5,  0,
+    0,  0, 10,  5,  5, 10,  0,  0,
+    0,  0,  5,  5,  5,  5,  0,  0,
+    0,  0,  5,  5,  5,  5,  0,  0
+};
+// piece square tables, black view
+// flop square for white-index: sq^56
+static const Score EvalTable[7*64] =
+{
+    // piece none
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+
+    // pawn
+    0,  0,  0,  0,  0,  0,  0,  0,
+   50, 50, 50, 50, 50, 50, 50, 50,
+   30, 30, 30, 30, 30, 30, 30, 30,
+    5,  5,  5, 10, 10,  5,  5,  5,
+    3,  3,  3,  8,  8,  3,  3,  3,
+    2,  2,  2,  2,  2,  2,  2,  2,
+    0,  0,  0, -5, -5,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,
+
+     // knight
+  -50,-40,-30,-30,-30,-30,-40,-50,
+  -40,-20,  0,  0,  0,  0,-20,-40,
+  -30,  0, 10, 15, 15, 10,  0,-30,
+  -30,  5, 15, 20, 20, 15,  5,-30,
+  -30,  0, 15, 20, 20, 15,  0,-30,
+  -30,  5, 10, 15, 15, 10,  5,-30,
+  -40,-20, 0,   5,  5,  0,-20,-40,
+  -50,-40,-30,-30,-30,-30,-40,-50,
+
+    // king
+   -1, -1, -1, -1, -1, -1, -1, -1,
+   -1,  0,  0,  0,  0,  0,  0, -1,
+   -1,  0,  0,  0,  0,  0,  0, -1,
+   -1,  0,  0,  0,  0,  0,  0, -1,
+   -1,  0,  0,  0,  0,  0,  0, -1,
+   -1,  0,  0,  0,  0,  0,  0, -1,
+   -1,  0,  0,  0,  0,  0,  0, -1,
+   -1, -1, -1, -1, -1, -1, -1, -1,
+
+    // bishop
+  -20,-10,-10,-10,-10,-10,-10,-20,
+  -10,  0,  0,  0,  0,  0,  0,-10,
+  -10,  0,  5, 10, 10,  5,  0,-10,
+  -10,  5,  5, 10, 10,  5,  5,-10,
+  -10,  0, 10, 10, 10, 10,  0,-10,
+  -10, 10, 10, 10, 10, 10, 10,-10,
+  -10,  5,  0,  0,  0,  0,  5,-10,
+  -20,-10,-10,-10,-10,-10,-10,-20,
+
+    // rook
+    0,  0,  0,  0,  0,  0,  0,  0,
+    5, 10, 10, 10, 10, 10, 10,  5,
+   -5,  0,  0,  0,  0,  0,  0, -5,
+   -5,  0,  0,  0,  0,  0,  0, -5,
+   -5,  0,  0,  0,  0,  0,  0, -5,
+   -5,  0,  0,  0,  0,  0,  0, -5,
+   -5,  0,  0,  0,  0,  0,  0, -5,
+    0,  0,  0,  5,  5,  0,  0,  0,
+
+    // queen
+  -20,-10,-10, -5, -5,-10,-10,-20,
+  -10,  0,  0,  0,  0,  0,  0,-10,
+  -10,  0,  5,  5,  5,  5,  0,-10,
+   -5,  0,  5,  5,  5,  5,  0, -5,
+   -5,  0,  5,  5,  5 , 5 , 0, -5,
+  -10,  0,  5,  5,  5,  5,  0,-10,
+  -10,  0,  0,  0,  0 , 0 , 0,-10,
+  -20,-10,-10, -5, -5,-10,-10,-20
+};
+
+// search thread, one per worker
+typedef struct
+{
+  pthread_t thread;
+  s32 gid;
+  u32 prn;                    // xorshift state, lazy smp move order
+  s32 depth;                  // current iteration
+  Bitboard board[7];
+  Hash hashhistory[MAXPLY+1]; // in-search positions, root at 0
+  Move movehistory[MAXPLY+1];
+  Move killers[MAXPLY];
+  Move counters[64*64];
+  Move bestmove;
+  Score bestscore;
+} CPUWORKER;
+
+// shared transposition table, lockless via xor trick,
+// aligned to 64 byte buckets of cpubucket entries
+static void *CPUTTMEM = NULL;
+static TTE *CPUTT = NULL;
+static u64 cpubucket = 1;
+static CPUWORKER *cpuworkers = NULL;
+static u64 cpunumworkers = 0;
+static u64 cpunumlaunched = 0;
+// parameters of current launch, read-only for the threads
+static Bitboard cpuboard[7];
+static Bitboard cpuexclude[MULTIPVSIZE];
+static Hash *cpuhashhistory = NULL;
+static bool cpustm = WHITE;
+static bool cpupersistent = false;
+static bool cpurootexclude = false;
+static s32 cpuply = 0;
+static s32 cpudepth = 0;
+static u64 cpunodes = 0;
+static Score cpualpha = -INF;
+static Score cpubeta = INF;
+static u8 cputtage = 0;
+// helper mode, threads assist the OpenCL device search, own TT merged
+// into device TT1 per kernel launch
+static bool cpuhelper = false;
+// node counters of threads, private, copied to COUNTERS by host thread in
+// search mode, so a reset of COUNTERS by rootsearch does not hit them
+static u64 *cpucounters = NULL;
+// double buffered export of deep helper TT entries, lossy when full
+static TTE *cpuexport[2] = { NULL, NULL };
+static volatile u64 cpuexportcount[2] = { 0, 0 };
+static volatile u32 cpuexportslot = 0;
+// run state, written by threads
+static volatile bool cpustop = false;
+static volatile u32 cpurunning = 0;
+static volatile u32 cpufinito[MAXPLY];
+// persistent search, per depth ready flag and score plus pv
+static volatile u32 cpuready[MAXPLY];
+static Move cpuprogress[MAXPLY*MAXPLY];
+
+void print_debug(char *debug);
+
+// xorshift32 prng
+static u32 cpu_random(CPUWORKER *w)
+{
+  w->prn ^= w->prn<<13;
+  w->prn ^= w->prn>>17;
+  w->prn ^= w->prn<<5;
+  return w->prn;
+}
+// evaluate position, white view, same terms as zeta.cl
+static Score cpu_evalpos(Bitboard *board)
+{
+  Bitboard bbBlockers = board[QBBP1]|board[QBBP2]|board[QBBP3];
+  Bitboard bbPawns    = board[QBBP1]&~board[QBBP2]&~board[QBBP3];
+  Bitboard bbBishops  = ~board[QBBP1]&~board[QBBP2]&board[QBBP3];
+  Bitboard bbWork     = bbBlockers;
+  Bitboard bbMe;
+  Bitboard bbOpp;
+  Score evalscore = 0;
+  Score score;
+  Square sq;
+  Square sqfrom;
+  s32 sqto;
+  Piece pfrom;
+  bool color;
+
+  while (bbWork)
+  {
+    sq      = popfirst1(&bbWork);
+    pfrom   = GETPIECE(board, sq);
+    color   = GETCOLOR(pfrom);
+    pfrom   = GETPTYPE(pfrom);
+    bbMe    = (color)?board[QBBBLACK]:(board[QBBBLACK]^bbBlockers);
+    bbOpp   = (color)?(board[QBBBLACK]^bbBlockers):board[QBBBLACK];
+    sqfrom  = (color)?sq:FLOP(sq);
+    // piece bonus, wood count, piece square and square control tables
+    score   = 10
+              +EvalPieceValues[pfrom]
+              +EvalTable[pfrom*64+sqfrom]
+              +EvalControl[sqfrom];
+    // simple pawn structure white
+    if (pfrom==PAWN&&color==WHITE)
+    {
+      // blocked
+      score-=(GETRANK(sq)<RANK_8&&(bbOpp&SETMASKBB(sq+8)))?15:0;
+      // chain
+      score+=(GETFILE(sq)<FILE_H&&(bbPawns&bbMe&SETMASKBB(sq-7)))?10:0;
+      score+=(GETFILE(sq)>FILE_A&&(bbPawns&bbMe&SETMASKBB(sq-9)))?10:0;
+      // column
+      for(sqto=sq-8;sqto>7;sqto-=8)
+        score-=(bbPawns&bbMe&SETMASKBB(sqto))?30:0;
+    }
+    // simple pawn structure black
+    if (pfrom==PAWN&&color==BLACK)
+    {
+      // blocked
+      score-=(GETRANK(sq)>RANK_1&&(bbOpp&SETMASKBB(sq-8)))?15:0;
+      // chain
+      score+=(GETFILE(sq)>FILE_A&&(bbPawns&bbMe&SETMASKBB(sq+7)))?10:0;
+      score+=(GETFILE(sq)<FILE_H&&(bbPawns&bbMe&SETMASKBB(sq+9)))?10:0;
+      // column
+      for(sqto=sq+8;sqto<56;sqto+=8)
+        score-=(bbPawns&bbMe&SETMASKBB(sqto))?30:0;
+    }
+    // negamaxed scores
+    evalscore+= (color)?-score:score;
+  }
+  // double bishop
+  evalscore-= (popcount(board[QBBBLACK]&bbBishops)==2)?25:0;
+  evalscore+= (popcount((board[QBBBLACK]^bbBlockers)&bbBishops)==2)?25:0;
+
+  return evalscore;
+}
+// own king not in check after move
+static bool cpu_legal(Bitboard *board, bool stm, Move move)
+{
+  bool kic;
+
+  domovequick(board, move);
+  kic = squareunderattack(board, !stm, getkingpos(board, stm));
+  undomovequick(board, move);
+
+  return !kic;
+}
+// generate legal moves, qs generates captures and queen promotions only,
+// underpromotions for perft, the search kernel promotes to queen only
+static s32 cpu_genmoves(Bitboard *board, bool stm, bool qs, bool underpromo, bool kic, Move *moves)
+{
+  Bitboard bbBlockers = board[QBBP1]|board[QBBP2]|board[QBBP3];
+  Bitboard bbMe       = (stm)?board[QBBBLACK]:(board[QBBBLACK]^bbBlockers);
+  Bitboard bbOpp      = bbBlockers^bbMe;
+  Bitboard bbWork     = bbMe;
+  Bitboard bbMoves;
+  Square sqking       = getkingpos(board, stm);
+  Square sqfrom;
+  Square sqto;
+  Square sqcpt;
+  Square sqep;
+  Piece pfrom;
+  Piece pto;
+  Piece pcpt;
+  Piece pking         = MAKEPIECE(KING,stm);
+  Move move;
+  s32 n               = 0;
+  s32 i;
+
+  // en passant target square via piece moved flags
+  bbMoves = (~board[QBBPMVD])&0x000000FFFF000000ULL;
+  sqep    = (bbMoves)?first1(bbMoves):0x0;
+
+  while (bbWork)
+  {
+    sqfrom  = popfirst1(&bbWork);
+    pfrom   = GETPIECE(board, sqfrom);
+    switch (GETPTYPE(pfrom))
+    {
+      case PAWN:
+        bbMoves = AttackTables[stm*64+sqfrom]&bbOpp;
+        sqto    = (stm)?sqfrom-8:sqfrom+8;
+        if (!(bbBlockers&SETMASKBB(sqto)))
+        {
+          if (!qs||GETRRANK(sqto,stm)==RANK_8)
+            bbMoves|= SETMASKBB(sqto);
+          // double push
+          sqto    = (stm)?sqto-8:sqto+8;
+          if (!qs
+              &&GETRRANK(sqfrom,stm)==RANK_2
+              &&!(bbBlockers&SETMASKBB(sqto)))
+            bbMoves|= SETMASKBB(sqto);
+        }
+        // en passant
+        if (sqep
+            &&GETRANK(sqep)==GETRANK(sqfrom)
+            &&((s32)GETFILE(sqep)-(s32)GETFILE(sqfrom)==1
+               ||(s32)GETFILE(sqfrom)-(s32)GETFILE(sqep)==1))
+          bbMoves|= SETMASKBB((stm)?sqep-8:sqep+8);
+        break;
+      case KNIGHT:
+        bbMoves = AttackTables[128+sqfrom]&~bbMe;
+        break;
+      case KING:
+        bbMoves = AttackTables[192+sqfrom]&~bbMe;
+        break;
+      case BISHOP:
+        bbMoves = bishop_attacks(bbBlockers, sqfrom)&~bbMe;
+        break;
+      case ROOK:
+        bbMoves = rook_attacks(bbBlockers, sqfrom)&~bbMe;
+        break;
+      case QUEEN:
+        bbMoves = (rook_attacks(bbBlockers, sqfrom)
+                   |bishop_attacks(bbBlockers, sqfrom))&~bbMe;
+        break;
+      default:
+        bbMoves = BBEMPTY;
+        break;
+    }
+    // captures only in quiescence search
+    if (qs&&GETPTYPE(pfrom)!=PAWN)
+      bbMoves&= bbOpp;
+
+    while (bbMoves)
+    {
+      sqto  = popfirst1(&bbMoves);
+      sqcpt = (GETPTYPE(pfrom)==PAWN
+               &&sqep
+               &&sqto==((stm)?sqep-8:sqep+8))?sqep:sqto;
+      pcpt  = GETPIECE(board, sqcpt);
+      // pawn promotions, queen first
+      if (GETPTYPE(pfrom)==PAWN&&GETRRANK(sqto,stm)==RANK_8)
+      {
+        for (i=0;i<((underpromo)?4:1);i++)
+        {
+          pto   = MAKEPIECE(((i==0)?QUEEN:(i==1)?ROOK:(i==2)?BISHOP:KNIGHT),stm);
+          move  = MAKEMOVE((Move)sqfrom, (Move)sqto, (Move)sqcpt, (Move)pfrom, (Move)pto, (Move)pcpt);
+          if (cpu_legal(board, stm, move))
+            moves[n++] = move;
+        }
+        continue;
+      }
+      move  = MAKEMOVE((Move)sqfrom, (Move)sqto, (Move)sqcpt, (Move)pfrom, (Move)pfrom, (Move)pcpt);
+      if (cpu_legal(board, stm, move))
+        moves[n++] = move;
+    }
+  }
+  // castles, rights via piece moved flags of king and rook
+  if (!qs&&!kic)
+  {
+    // queenside
+    if ((((~board[QBBPMVD])&((stm)?SMCRBLACKQ:SMCRWHITEQ))==((stm)?SMCRBLACKQ:SMCRWHITEQ))
+        &&GETPIECE(board,sqking-4)==MAKEPIECE(ROOK,stm)
+        &&!(bbBlockers&(SETMASKBB(sqking-1)|SETMASKBB(sqking-2)|SETMASKBB(sqking-3)))
+        &&!squareunderattack(board, !stm, sqking-1)
+        &&!squareunderattack(board, !stm, sqking-2)
+       )
+      moves[n++] = MAKEMOVE((Move)sqking, (Move)(sqking-2), (Move)(sqking-2), (Move)pking, (Move)pking, (Move)PNONE);
+    // kingside
+    if ((((~board[QBBPMVD])&((stm)?SMCRBLACKK:SMCRWHITEK))==((stm)?SMCRBLACKK:SMCRWHITEK))
+        &&GETPIECE(board,sqking+3)==MAKEPIECE(ROOK,stm)
+        &&!(bbBlockers&(SETMASKBB(sqking+1)|SETMASKBB(sqking+2)))
+        &&!squareunderattack(board, !stm, sqking+1)
+        &&!squareunderattack(board, !stm, sqking+2)
+       )
+      moves[n++] = MAKEMOVE((Move)sqking, (Move)(sqking+2), (Move)(sqking+2), (Move)pking, (Move)pking, (Move)PNONE);
+  }
+
+  return n;
+}
+// leaf node count
+static u64 cpu_perft(Bitboard *board, bool stm, s32 depth)
+{
+  Move moves[MAXMOVES];
+  Cr cr     = board[QBBPMVD];
+  Hash hash = board[QBBHASH];
+  u64 hmc   = board[QBBHMC];
+  u64 count = 0;
+  bool kic;
+  s32 n;
+  s32 i;
+
+  if (depth<1)
+    return 1;
+
+  kic = squareunderattack(board, !stm, getkingpos(board, stm));
+  n   = cpu_genmoves(board, stm, false, true, kic, moves);
+
+  if (depth==1)
+    return (u64)n;
+
+  for (i=0;i<n;i++)
+  {
+    domove(board, moves[i]);
+    count+= cpu_perft(board, !stm, depth-1);
+    undomove(board, moves[i], cr, hash, hmc);
+  }
+
+  return count;
+}
+// stop flag, early bird of other thread or node limit
+static bool cpu_aborted(CPUWORKER *w)
+{
+  return (cpustop
+          ||cpufinito[w->depth]
+          ||cpucounters[w->gid*64+1]>cpunodes)?true:false;
+}
+// load entry of position from hash table bucket, caller checks via xor
+// trick, first entry of bucket if position not present
+static TTE cpu_ttload(Hash hash)
+{
+  const u64 index = hash&(ttbits1-cpubucket);
+  TTE tt1;
+
+  for (u64 i=0;i<cpubucket;i++)
+  {
+    tt1 = CPUTT[index+i];
+    if (tt1.hash==(hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+      return tt1;
+  }
+  return CPUTT[index];
+}
+// save entry to hash table bucket, replacement scheme of zeta.cl,
+// returns true on store into empty slot
+static bool cpu_ttsave(Hash hash, TTE tte, u8 ttage)
+{
+  const u64 index = hash&(ttbits1-cpubucket);
+  u64 slot = index;
+  s32 rank = 0x7FFFFFFF;
+  s32 tmp;
+  bool found = false;
+  TTE tt1;
+
+  for (u64 i=0;i<cpubucket;i++)
+  {
+    tt1 = CPUTT[index+i];
+    if (tt1.hash==(hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+    {
+      slot  = index+i;
+      found = true;
+      break;
+    }
+    tmp = (s32)tt1.depth-((ttage!=(tt1.flag>>2)&&ttage!=(tt1.flag>>2)+2)?256:0);
+    if (tmp<rank)
+    {
+      rank = tmp;
+      slot = index+i;
+    }
+  }
+
+  tt1 = CPUTT[slot];
+  if (
+       (!found&&cpubucket>1)
+       ||
+       (tte.depth>tt1.depth)
+       ||
+       (tte.depth>=tt1.depth
+        &&tt1.hash==(hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth)
+        &&tte.score>tt1.score
+       )
+       ||
+       (ttage!=(tt1.flag>>2)
+        &&ttage!=(tt1.flag>>2)+2
+       )
+     )
+  {
+    CPUTT[slot] = tte;
+    return (tt1.hash==0&&tt1.depth==0)?true:false;
+  }
+  return false;
+}
+// save to hash table, replacement scheme of zeta.cl
+static void cpu_ttstore(CPUWORKER *w, Hash hash, Move move, Score score, u8 flag, s32 depth)
+{
+  TTE tt1;
+
+  tt1.bestmove  = (TTMove)move;
+  tt1.score     = (TTScore)score;
+  tt1.flag      = flag | (cputtage&0x3F)<<2;
+  tt1.depth     = (u8)depth;
+  // xor trick for avoiding race conditions
+  tt1.hash      = hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth;
+
+  // count stores into empty slots, for hashfull estimate
+  if (cpu_ttsave(hash, tt1, cputtage))
+    cpucounters[w->gid*64+6]++;
+
+  // helper mode, deep entries are merged into device TT on next launch
+  if (cpuhelper&&depth>=HELPERDRAFT)
+  {
+    u32 slot  = cpuexportslot;
+    u64 index = __sync_fetch_and_add(&cpuexportcount[slot], 1);
+    if (index<MAXMERGE)
+      cpuexport[slot][index] = tt1;
+  }
+}
+// alphabeta with quiescence search, scores fail hard like zeta.cl
+static Score cpu_search(CPUWORKER *w, bool stm, s32 depth, s32 sd, Score alpha, Score beta, bool nullok)
+{
+  Bitboard *board   = w->board;
+  Move moves[MAXMOVES];
+  s32 movescores[MAXMOVES];
+  Move move;
+  Move tmpmove;
+  Move ttmove       = MOVENONE;
+  Move bestmove     = MOVENONE;
+  Move lastmove     = (sd>0)?w->movehistory[sd-1]:MOVENONE;
+  Move killermove   = w->killers[sd];
+  Move countermove  = w->counters[GETSQFROM(lastmove)*64+GETSQTO(lastmove)];
+  Hash hash         = board[QBBHASH];
+  Cr cr             = board[QBBPMVD];
+  u64 hmc           = board[QBBHMC];
+  Score score;
+  Score evalscore;
+  s32 tmpscore;
+  s32 i;
+  s32 j;
+  s32 n;
+  u8 flag           = FAILLOW;
+  bool kic;
+  bool qs;
+  bool ext          = false;
+  bool lmr;
+  bool brandomize;
+  TTE tt1;
+
+  if (cpu_aborted(w))
+    return 0;
+
+  cpucounters[w->gid*64+1]++;
+
+  w->hashhistory[sd] = hash;
+
+  // fifty move rule and Kxk draw
+  if (sd>0
+      &&(hmc>=100||popcount(board[QBBP1]|board[QBBP2]|board[QBBP3])<=2))
+    return DRAWSCORE;
+
+  kic = squareunderattack(board, !stm, getkingpos(board, stm));
+
+  // depth extension, check and queen promotion
+  if (sd>0
+      &&depth>=0
+      &&(kic
+         ||(GETPTYPE(GETPFROM(lastmove))==PAWN
+            &&GETPTYPE(GETPTO(lastmove))==QUEEN)
+        )
+     )
+  {
+    depth++;
+    ext = true;
+  }
+  qs = (depth<=0)?true:false;
+
+  evalscore = cpu_evalpos(board);
+  evalscore = (stm)?-evalscore:evalscore;
+
+  // check bounds
+  if (sd>=MAXPLY-1)
+    return evalscore;
+
+  // draw by 3 fold repetition
+  // in-search positions from thread history, game positions from shared
+  for (n=sd+cpuply-2;sd>0&&!qs&&n>=0&&n>=sd+cpuply-(s32)hmc;n-=2)
+  {
+    if (hash==((n>=cpuply)?w->hashhistory[n-cpuply]:cpuhashhistory[n]))
+      return DRAWSCORE;
+  }
+
+  // stand pat in qsearch
+  if (qs&&!kic)
+  {
+    alpha = (evalscore>alpha)?evalscore:alpha;
+    if (alpha>=beta)
+      return alpha;
+  }
+
+  // load from hash table, update alpha with ttscore
+  if (sd>0&&!qs&&ttbits1>1)
+  {
+    tt1 = cpu_ttload(hash);
+    // tt probe counter
+    cpucounters[w->gid*64+7]++;
+    if (tt1.hash==(hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+    {
+      cpucounters[w->gid*64+8]++;
+      ttmove = (Move)tt1.bestmove;
+      score  = (Score)tt1.score;
+
+      // handle mate scores in TT
+      score = (ISMATE(score)&&score>0)?score-sd:score;
+      score = (ISMATE(score)&&score<0)?score+sd:score;
+
+      if ((s32)tt1.depth>=depth
+          &&(tt1.flag&0x3)>FAILLOW
+          &&!ISINF(score)
+          &&score>alpha
+         )
+      {
+        alpha = score;
+        // tt score hit counter
+        cpucounters[w->gid*64+4]++;
+        if (alpha>=beta)
+          return alpha;
+      }
+    }
+  }
+
+  // null move, set score only when score >= beta
+  if (nullok
+      &&sd>0
+      &&!qs
+      &&!kic
+      &&!ext
+      &&depth>=4
+     )
+  {
+    w->movehistory[sd] = NULLMOVE;
+    board[QBBPMVD]    |= 0x000000FFFF000000ULL;
+    board[QBBHASH]     = computehash(board, !stm);
+    score = -cpu_search(w, !stm, depth-1-NULLR, sd+1, -beta, -beta+1, false);
+    board[QBBPMVD]     = cr;
+    board[QBBHASH]     = hash;
+    if (cpu_aborted(w))
+      return 0;
+    if (score>=beta)
+      return score;
+  }
+
+  n = cpu_genmoves(board, stm, (qs&&!kic), false, kic, moves);
+
+  // multipv, exclude root moves of previous lines
+  if (sd==0&&cpurootexclude)
+  {
+    for (i=0,j=0;i<n;i++)
+    {
+      if (!(cpuexclude[GETSQFROM(moves[i])]&SETMASKBB(GETSQTO(moves[i]))))
+        moves[j++] = moves[i];
+    }
+    n = j;
+  }
+
+  // checkmate, stalemate or no captures left in qsearch
+  if (n==0)
+    return (kic)?-INF+sd:(qs)?alpha:DRAWSCORE;
+
+  // move ordering, same scheme as zeta.cl
+  for (i=0;i<n;i++)
+  {
+    tmpmove  = moves[i];
+    tmpscore = EvalPieceValues[GETPTYPE(GETPTO(tmpmove))]
+               +EvalTable[GETPTYPE(GETPTO(tmpmove))*64+((stm)?GETSQTO(tmpmove):FLOP(GETSQTO(tmpmove)))]
+               +EvalControl[((stm)?GETSQTO(tmpmove):FLOP(GETSQTO(tmpmove)))];
+    tmpscore-= EvalPieceValues[GETPTYPE(GETPFROM(tmpmove))]
+               +EvalTable[GETPTYPE(GETPFROM(tmpmove))*64+((stm)?GETSQFROM(tmpmove):FLOP(GETSQFROM(tmpmove)))]
+               +EvalControl[((stm)?GETSQFROM(tmpmove):FLOP(GETSQFROM(tmpmove)))];
+    // MVV-LVA
+    tmpscore = (GETPTYPE(GETPCPT(tmpmove))!=PNONE)?
+                EvalPieceValues[GETPTYPE(GETPCPT(tmpmove))]*16-EvalPieceValues[GETPTYPE(GETPTO(tmpmove))]
+               :tmpscore;
+    // counter move heuristic, second highest quiet move
+    if (countermove==tmpmove)
+      tmpscore = EvalPieceValues[QUEEN]+EvalPieceValues[PAWN];
+    // killer move heuristic, highest quiet move
+    if (killermove==tmpmove)
+      tmpscore = EvalPieceValues[QUEEN]+EvalPieceValues[PAWN]*2;
+    // tt move, highest move
+    if (ttmove==tmpmove)
+    {
+      tmpscore = MOVESCOREINF-100;
+      // TThits counter
+      cpucounters[w->gid*64+3]++;
+    }
+    movescores[i] = tmpscore;
+  }
+
+  // lazy smp, helper threads randomize move order after oldest son
+  brandomize = ((w->gid>0||cpuhelper)
+                &&sd>0
+                &&!qs
+                &&!kic
+                &&!ext
+                &&nullok
+                &&depth>0)?true:false;
+
+  for (i=0;i<n;i++)
+  {
+    if (brandomize&&i==RANDBRO)
+      for (j=i;j<n;j++)
+        movescores[j]+= (s32)(cpu_random(w)%INF);
+
+    // pick best scored move
+    for (j=i+1;j<n;j++)
+    {
+      if (movescores[j]>movescores[i])
+      {
+        tmpmove       = moves[i];
+        moves[i]      = moves[j];
+        moves[j]      = tmpmove;
+        tmpscore      = movescores[i];
+        movescores[i] = movescores[j];
+        movescores[j] = tmpscore;
+      }
+    }
+    move = moves[i];
+
+    // get a bestmove anyway
+    if (sd==0&&i==0)
+      w->bestmove = move;
+
+    // late move reductions, quiet moves after oldest sons
+    lmr = (sd>0
+           &&!qs
+           &&!kic
+           &&!ext
+           &&GETPTYPE(GETPCPT(move))==PNONE
+           &&i>=2
+           &&depth>=2
+           &&popcount(board[QBBBLACK])>=2
+           &&popcount(board[QBBBLACK]^(board[QBBP1]|board[QBBP2]|board[QBBP3]))>=2
+          )?true:false;
+
+    w->movehistory[sd] = move;
+    domove(board, move);
+
+    // no check giving moves
+    if (lmr&&squareunderattack(board, stm, getkingpos(board, !stm)))
+      lmr = false;
+
+    score = -cpu_search(w, !stm, depth-1-((lmr)?LMRR:0), sd+1, -beta, -alpha, true);
+
+    // late move reductions research
+    if (lmr&&score>alpha&&!cpu_aborted(w))
+      score = -cpu_search(w, !stm, depth-1, sd+1, -beta, -alpha, true);
+
+    undomove(board, move, cr, hash, hmc);
+
+    if (cpu_aborted(w))
+      return 0;
+
+    // set negamaxed alpha score
+    if (score>alpha)
+    {
+      alpha     = score;
+      bestmove  = move;
+      flag      = EXACTSCORE;
+      // collect bestmove and score
+      if (sd==0)
+      {
+        w->bestmove   = move;
+        w->bestscore  = score;
+      }
+    }
+    if (alpha>=beta)
+    {
+      flag = FAILHIGH;
+      // save killer and counter move heuristic for quiet moves
+      if (!qs&&GETPTYPE(GETPCPT(move))==PNONE)
+      {
+        w->killers[sd] = move;
+        w->counters[GETSQFROM(lastmove)*64+GETSQTO(lastmove)] = move;
+      }
+      break;
+    }
+  }
+
+  // save to hash table
+  if (flag>FAILLOW
+      &&!qs
+      &&ttbits1>1
+      &&!(cpurootexclude&&sd==0) // keep root entry of first line
+     )
+  {
+    // handle mate scores in TT, mate in => distance to mate
+    score = alpha;
+    score = (ISMATE(score)&&score>0)?score+sd:score;
+    score = (ISMATE(score)&&score<0)?score-sd:score;
+    cpu_ttstore(w, hash, bestmove, score, flag, depth);
+  }
+
+  return alpha;
+}
+// collect pv from bestmove and hash table, for gui output
+static void cpu_collectpv(CPUWORKER *w, s32 depth)
+{
+  Bitboard board[7];
+  Move *pvout = (cpupersistent)?&cpuprogress[depth*MAXPLY]:PV;
+  Move move   = w->bestmove;
+  Score score = w->bestscore;
+  bool stm    = cpustm;
+  s32 n       = 1;
+  TTE tt1;
+
+  memcpy(board, cpuboard, 7*sizeof(Bitboard));
+
+  pvout[0] = (Move)score;
+  while (n<MAXPLY)
+  {
+    pvout[n] = move;
+
+    domove(board, move);
+    stm = !stm;
+
+    move  = MOVENONE;
+    score = -INF;
+
+    // load ttmove from hash table
+    if (ttbits1>1)
+    {
+      tt1 = cpu_ttload(board[QBBHASH]);
+      if (tt1.hash==
+            (board[QBBHASH]^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+      {
+        score = (Score)tt1.score;
+        move  = (Move)tt1.bestmove;
+      }
+    }
+
+    if (move==MOVENONE||ISINF(score))
+      break;
+    // index collision, moving piece has to be on board
+    if (GETPIECE(board, GETSQFROM(move))!=GETPFROM(move)
+        ||GETCOLOR(GETPFROM(move))!=stm)
+      break;
+
+    n++;
+  }
+  // persistent search, publish depth to host
+  if (cpupersistent)
+  {
+    __sync_synchronize();
+    cpuready[depth] = 1;
+  }
+}
+// search thread, iterative deepening in persistent mode
+static void *cpu_worker(void *arg)
+{
+  CPUWORKER *w = (CPUWORKER *)arg;
+  s32 depth = (cpupersistent)?1:cpudepth;
+
+  // helper mode, every second thread iterates one depth ahead
+  if (cpuhelper)
+    depth+= w->gid&1;
+
+  for (;depth<=cpudepth;depth++)
+  {
+    w->depth      = depth;
+    w->bestmove   = MOVENONE;
+    w->bestscore  = -INF;
+    memcpy(w->board, cpuboard, 7*sizeof(Bitboard));
+
+    cpu_search(w, cpustm, depth, 0, cpualpha, cpubeta, false);
+
+    if (cpustop||cpucounters[w->gid*64+1]>cpunodes)
+      break;
+    // helpers report via TT only
+    if (cpuhelper)
+      continue;
+    // early bird, first finished thread publishes its pv
+    if (__sync_bool_compare_and_swap(&cpufinito[depth], 0, (u32)w->gid+1))
+      cpu_collectpv(w, depth);
+  }
+
+  __sync_fetch_and_sub(&cpurunning, 1);
+
+  return NULL;
+}
+// allocate hash table and search threads, called once per game,
+// as helpers of the OpenCL device with TT of same size as device TT1
+bool cpu_init_device(void)
+{
+  u64 mem = 1;
+
+  cpuhelper = (cpu_threads>0)?false:true;
+
+  // size transposition table TT1, number of entries as power of two,
+  // helper mode keeps size of device TT1 for same index scheme
+  if (!cpuhelper)
+  {
+    ttbits1 = 0;
+    if (tt1_memory>0)
+    {
+      mem = (tt1_memory*1024*1024)/(sizeof(TTE));
+
+      while ( mem >>= 1)   // get msb
+        ttbits1++;
+      ttbits1 = 1ULL<<ttbits1;   // get number of tt entries
+    }
+    else
+      ttbits1 = 0x1;
+  }
+
+  // buckets of 64 bytes, not more than table size
+  cpubucket = (tt_buckets&&ttbits1>=TTBUCKETSIZE)?TTBUCKETSIZE:1;
+
+  CPUTTMEM = calloc(ttbits1+TTBUCKETSIZE, sizeof(TTE));
+  if (CPUTTMEM==NULL)
+  {
+    print_debug((char *)"Error: Allocating hash table. (cpu_init_device)\n");
+    return false;
+  }
+  CPUTT = (TTE *)(((size_t)CPUTTMEM+63)&~(size_t)63);
+  cpunumworkers = (cpuhelper)?(u64)cpu_helpers:totalWorkUnits;
+  cpuworkers = (CPUWORKER *)calloc(cpunumworkers, sizeof(CPUWORKER));
+  if (cpuworkers==NULL)
+  {
+    print_debug((char *)"Error: Allocating search threads. (cpu_init_device)\n");
+    return false;
+  }
+  for (u64 i=0;i<cpunumworkers;i++)
+  {
+    cpuworkers[i].gid = (s32)i;
+    cpuworkers[i].prn = (u32)(i+1)*0x9E3779B9;
+  }
+  cpucounters = (u64 *)calloc(cpunumworkers*64, sizeof(u64));
+  if (cpucounters==NULL)
+  {
+    print_debug((char *)"Error: Allocating node counters. (cpu_init_device)\n");
+    return false;
+  }
+  // helpers count nodes apart from device COUNTERS
+  if (cpuhelper)
+  {
+    cpuexport[0] = (TTE *)calloc(MAXMERGE, sizeof(TTE));
+    cpuexport[1] = (TTE *)calloc(MAXMERGE, sizeof(TTE));
+    if (cpuexport[0]==NULL||cpuexport[1]==NULL)
+    {
+      print_debug((char *)"Error: Allocating helper buffers. (cpu_init_device)\n");
+      return false;
+    }
+  }
+
+  return true;
+}
+// launch search threads without waiting, like a kernel run
+bool cpu_run_alphabeta(bool stm, s32 depth, u64 nodes, Score alpha, Score beta, bool persistent)
+{
+  Hash *hashhistory;
+
+  // previous launch has to be finished
+  if (!cpu_wait_alphabeta(0))
+    return false;
+
+  if (CPUTT==NULL||cpuworkers==NULL)
+  {
+    print_debug((char *)"Error: Search threads not initialized. (cpu_run_alphabeta)\n");
+    return false;
+  }
+
+  // game positions for repetition detection
+  hashhistory = (Hash *)realloc(cpuhashhistory, (PLY+1)*sizeof(Hash));
+  if (hashhistory==NULL)
+  {
+    print_debug((char *)"Error: Allocating hash history. (cpu_run_alphabeta)\n");
+    return false;
+  }
+  cpuhashhistory = hashhistory;
+  memcpy(cpuhashhistory, HashHistory, (PLY+1)*sizeof(Hash));
+
+  memcpy(cpuboard, GLOBAL_BOARD, 7*sizeof(Bitboard));
+  memcpy(cpuexclude, ROOTEXCLUDE, sizeof(cpuexclude));
+  // helpers search all root moves
+  cpurootexclude  = (!cpuhelper&&ROOTEXCLUDE[MULTIPVCOUNT]>0)?true:false;
+  cpustm          = stm;
+  cpuply          = PLY;
+  cpudepth        = (depth<MAXPLY)?depth:MAXPLY-1;
+  cpunodes        = nodes;
+  cpualpha        = alpha;
+  cpubeta         = beta;
+  cpupersistent   = persistent;
+  cputtage        = (u8)PLY&0x3F;
+  cpustop         = false;
+
+  memset((void *)cpufinito, 0, sizeof(cpufinito));
+  memset((void *)cpuready, 0, sizeof(cpuready));
+  memset(cpuprogress, 0, sizeof(cpuprogress));
+  memset(cpucounters, 0, cpunumworkers*64*sizeof(u64));
+  if (!cpuhelper)
+  {
+    memset(PV, 0, MAXPLY*sizeof(Move));
+    memset(COUNTERS, 0, totalWorkUnits*threadsZ*sizeof(u64));
+  }
+
+  cpurunning = (u32)cpunumworkers;
+  for (cpunumlaunched=0;cpunumlaunched<cpunumworkers;cpunumlaunched++)
+  {
+    if (pthread_create(&cpuworkers[cpunumlaunched].thread, NULL, cpu_worker, &cpuworkers[cpunumlaunched]))
+    {
+      print_debug((char *)"Error: Creating search thread. (pthread_create)\n");
+      cpustop = true;
+      __sync_fetch_and_sub(&cpurunning, (u32)(cpunumworkers-cpunumlaunched));
+      return false;
+    }
+  }
+
+  return true;
+}
+// perft on host, leaf node count into counters of first worker
+bool cpu_run_perft(bool stm, s32 depth)
+{
+  COUNTERS[1] = cpu_perft_count(GLOBAL_BOARD, stm, depth);
+
+  return true;
+}
+// leaf node count of position on a copy, no device or threads needed,
+// selftest checks the CPU move generator against the OpenCL kernel with it
+u64 cpu_perft_count(Bitboard *board, bool stm, s32 depth)
+{
+  Bitboard tmp[7];
+
+  memcpy(tmp, board, 7*sizeof(Bitboard));
+
+  return cpu_perft(tmp, stm, depth);
+}
+// wait for search threads, set stop flag at deadline in ms,
+// deadline 0 waits without limit
+bool cpu_wait_alphabeta(double deadline)
+{
+  if (cpunumlaunched==0)
+    return true;
+
+  while (cpurunning>0)
+  {
+    // deadline passed or move now requested by user
+    if (!cpustop&&((deadline>0&&get_time()>=deadline)||MOVENOW))
+      cpustop = true;
+    sleep_ms(1);
+  }
+  for (u64 i=0;i<cpunumlaunched;i++)
+  {
+    if (pthread_join(cpuworkers[i].thread, NULL))
+    {
+      print_debug((char *)"Error: Joining search thread. (pthread_join)\n");
+      return false;
+    }
+  }
+  cpunumlaunched = 0;
+  // final node counters of search
+  if (!cpuhelper)
+    memcpy(COUNTERS, cpucounters, cpunumworkers*64*sizeof(u64));
+
+  return true;
+}
+// check once if persistent search published depth, or threads finished
+bool cpu_poll_progress(s32 depth, bool *ready, bool *done)
+{
+  *ready = false;
+  *done = true;
+
+  if (cpunumlaunched==0||depth<1||depth>=MAXPLY)
+    return true;
+
+  // thread state first, so progress read after completion is final
+  *done = (cpurunning==0)?true:false;
+
+  if (!cpuready[depth])
+    return true;
+
+  __sync_synchronize();
+  memcpy(PV, &cpuprogress[depth*MAXPLY], MAXPLY*sizeof(Move));
+  // node counters snapshot while threads run
+  if (!cpuhelper)
+    memcpy(COUNTERS, cpucounters, cpunumworkers*64*sizeof(u64));
+
+  *ready = true;
+
+  return true;
+}
+// set stop flag of running search threads
+bool cpu_stop_alphabeta(void)
+{
+  cpustop = true;
+
+  return true;
+}
+// reset hash table and move heuristics for a new game
+bool cpu_reset_device(void)
+{
+  if (CPUTT==NULL||cpuworkers==NULL)
+    return false;
+
+  if (!cpu_wait_alphabeta(0))
+    return false;
+
+  memset(CPUTT, 0, ttbits1*sizeof(TTE));
+  cpuexportcount[0] = 0;
+  cpuexportcount[1] = 0;
+  for (u64 i=0;i<cpunumworkers;i++)
+  {
+    memset(cpuworkers[i].killers, 0, sizeof(cpuworkers[i].killers));
+    memset(cpuworkers[i].counters, 0, sizeof(cpuworkers[i].counters));
+  }
+
+  return true;
+}
+// hash table of host search with ttbits1 entries, for TT file io,
+// search threads joined before
+TTE *cpu_tt_table(void)
+{
+  if (CPUTT==NULL||!cpu_wait_alphabeta(0))
+    return NULL;
+
+  return CPUTT;
+}
+// sample hash table at even strides like sample_tt kernel, no TT2 on host
+bool cpu_sample_tt(s32 *samples)
+{
+  const u64 stride = (ttbits1>TTSAMPLES)?ttbits1/TTSAMPLES:1;
+  TTE tt1;
+
+  if (CPUTT==NULL)
+    return false;
+
+  for (u64 i=0;i<TTSAMPLES;i++)
+  {
+    for (s32 j=0;j<TTSAMPLESIZE;j++)
+      samples[i*TTSAMPLESIZE+j] = -1;
+    if (ttbits1<=1||i*stride>=ttbits1)
+      continue;
+    // rotate through slots of bucket, slot 0 alone overstates occupancy
+    tt1 = CPUTT[i*stride+((stride>=cpubucket)?i%cpubucket:0)];
+    samples[i*TTSAMPLESIZE+0] = (tt1.hash!=0||tt1.depth!=0)?1:0;
+    samples[i*TTSAMPLESIZE+1] = (s32)(((u32)PLY-(u32)(tt1.flag>>2))&0x3F);
+    samples[i*TTSAMPLESIZE+2] = (s32)tt1.depth;
+  }
+
+  return true;
+}
+// stop and join search threads, free hash table
+bool cpu_release_device(void)
+{
+  cpustop = true;
+  if (!cpu_wait_alphabeta(0))
+    return false;
+
+  if (CPUTTMEM!=NULL)
+    free(CPUTTMEM);
+  CPUTTMEM = NULL;
+  CPUTT = NULL;
+  if (cpuworkers!=NULL)
+    free(cpuworkers);
+  cpuworkers = NULL;
+  cpunumworkers = 0;
+  if (cpuhashhistory!=NULL)
+    free(cpuhashhistory);
+  cpuhashhistory = NULL;
+  if (cpucounters!=NULL)
+    free(cpucounters);
+  cpucounters = NULL;
+  for (s32 i=0;i<2;i++)
+  {
+    if (cpuexport[i]!=NULL)
+      free(cpuexport[i]);
+    cpuexport[i] = NULL;
+    cpuexportcount[i] = 0;
+  }
+
+  return true;
+}
+// start helper threads on root of device search, iterative deepening
+// until stopped, keeps running threads on same root and side to move
+bool cpu_helpers_start(bool stm)
+{
+  if (cpuworkers==NULL||cpunumworkers==0)
+    return true;
+
+  if (cpunumlaunched>0
+      &&cpurunning>0
+      &&cpuboard[QBBHASH]==GLOBAL_BOARD[QBBHASH]
+      &&cpustm==stm)
+    return true;
+
+  cpustop = true;
+
+  return cpu_run_alphabeta(stm, MAXPLY-1, 0xFFFFFFFFFFFFFFFFULL, -INF, INF, true);
+}
+// stop and join helper threads, node count of last run
+bool cpu_helpers_stop(u64 *nodes)
+{
+  *nodes = 0;
+
+  cpustop = true;
+  if (!cpu_wait_alphabeta(0))
+    return false;
+
+  if (cpucounters==NULL)
+    return true;
+
+  for (u64 i=0;i<cpunumworkers;i++)
+    *nodes+= cpucounters[i*64+1];
+
+  return true;
+}
+// copy deep helper TT entries for merge into device TT, returns count,
+// entries written while slot flips are lost or torn, torn entries fail
+// the xor check on probe like any other race
+u64 cpu_helpers_export(TTE *entries)
+{
+  u32 slot;
+  u64 count;
+
+  if (cpuexport[0]==NULL||cpuexport[1]==NULL)
+    return 0;
+
+  slot = cpuexportslot;
+  cpuexportslot = slot^1;
+  __sync_synchronize();
+
+  count = __sync_lock_test_and_set(&cpuexportcount[slot], 0);
+  count = (count<MAXMERGE)?count:MAXMERGE;
+  memcpy(entries, cpuexport[slot], count*sizeof(TTE));
+
+  return count;
+}
+// seed helper TT with pv of device search as move order hints,
+// keeps entries of helpers for the same position
+bool cpu_helpers_seed(Move *pv)
+{
+  Bitboard board[7];
+  Hash hash;
+  TTE tt1;
+  bool stm = cpustm;
+  s32 n;
+
+  if (CPUTT==NULL||ttbits1<=1||cpuboard[QBBHASH]!=GLOBAL_BOARD[QBBHASH])
+    return true;
+
+  memcpy(board, cpuboard, 7*sizeof(Bitboard));
+
+  for (n=1;n<MAXPLY&&pv[n]!=MOVENONE;n++)
+  {
+    // index collision in device pv, moving piece has to be on board
+    if (GETPIECE(board, GETSQFROM(pv[n]))!=GETPFROM(pv[n])
+        ||GETCOLOR(GETPFROM(pv[n]))!=stm)
+      break;
+
+    hash  = board[QBBHASH];
+    tt1   = cpu_ttload(hash);
+
+    if (tt1.hash!=(hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+    {
+      // move only, fail low flag keeps score unused
+      tt1.bestmove  = (TTMove)pv[n];
+      tt1.score     = 0;
+      tt1.flag      = FAILLOW | (cputtage&0x3F)<<2;
+      tt1.depth     = 0;
+      tt1.hash      = hash^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth;
+      cpu_ttsave(hash, tt1, cputtage);
+    }
+
+    domove(board, pv[n]);
+    stm = !stm;
+  }
+
+  return true;
+}
@@ -0,0 +1,46 @@
+/*
+  Name:         Zeta
+  Description:  Experimental chess engine written in OpenCL.
+  Author:       Srdja Matovic <s.matovic@app26.de>
+  Created at:   2019-07-14
+  Updated at:   2019
+  License:      GPL >= v2
+
+  Copyright (C) 2011-2019 Srdja Matovic
+
+  Zeta is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  Zeta is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+*/
+
+#ifndef CPU_H_INCLUDED
+#define CPU_H_INCLUDED
+
+#include "types.h"
+
+// native CPU search, mirrors the OpenCL run functions of clrun.c
+bool cpu_init_device(void);
+bool cpu_run_alphabeta(bool stm, s32 depth, u64 nodes, Score alpha, Score beta, bool persistent);
+bool cpu_run_perft(bool stm, s32 depth);
+u64 cpu_perft_count(Bitboard *board, bool stm, s32 depth);
+bool cpu_wait_alphabeta(double deadline);
+bool cpu_poll_progress(s32 depth, bool *ready, bool *done);
+bool cpu_stop_alphabeta(void);
+bool cpu_reset_device(void);
+TTE *cpu_tt_table(void);
+bool cpu_sample_tt(s32 *samples);
+bool cpu_release_device(void);
+// host helper threads of OpenCL device search, own TT, deep entries merged
+// into device TT1 per kernel launch as warm start
+bool cpu_helpers_start(bool stm);
+bool cpu_helpers_stop(u64 *nodes);
+u64 cpu_helpers_export(TTE *entries);
+bool cpu_helpers_seed(Move *pv);
+
+#endif /* CPU_H_INCLUDED */
@@ -19,6 +19,9 @@
   GNU General Public License for more details.
 */
 
+#define _POSIX_C_SOURCE 200112L // for pthreads with std=c99
+
+#include <pthread.h>      // for input reader thread
 #include <stdio.h>        // for print and scan
 #include <stdlib.h>       // for alloc
 #include <string.h>       // for string compare 
@@ -29,10 +32,20 @@
 #include "search.h"       // rootsearch and perft
 #include "timer.h"        // timer functions
 #include "types.h"        // types and defaults and macros 
+#include "uci.h"          // uci protocol command loop
 #include "zeta.h"         // for global vars and functions
 
 void createfen(char *fenstring, Bitboard *board, bool stm, s32 gameply);
 
+// input reader thread, queues stdin lines for the command loop
+static pthread_t inputthread;
+static pthread_mutex_t inputmutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t inputcond = PTHREAD_COND_INITIALIZER;
+static char inputlines[INPUTLINES][1024];
+static s32 inputhead = 0;
+static s32 inputtail = 0;
+static bool inputeof = false;
+
 // print bitboard
 void printbitboard(Bitboard board)
 {
@@ -571,13 +584,144 @@ bool read_and_init_config(char configfile[])
     sscanf(line, "opencl_platform_id: %d;", &opencl_platform_id);
     sscanf(line, "opencl_device_id: %d;", &opencl_device_id);
     sscanf(line, "opencl_gpugen: %d;", &opencl_gpugen);
+    sscanf(line, "slice_ms: %d;", &slice_ms);
+    sscanf(line, "opencl_profiling: %d;", &opencl_profiling);
+    sscanf(line, "opencl_zerocopy: %d;", &opencl_zerocopy);
+    sscanf(line, "persistent_search: %d;", &persistent_search);
+    sscanf(line, "multipv: %d;", &multipv);
+    sscanf(line, "root_split: %d;", &root_split);
+    sscanf(line, "cpu_threads: %d;", &cpu_threads);
+    sscanf(line, "cpu_helpers: %d;", &cpu_helpers);
+    sscanf(line, "tt_buckets: %d;", &tt_buckets);
+    sscanf(line, "tt2_compact: %d;", &tt2_compact);
+    sscanf(line, "tt_unified: %d;", &tt_unified);
+    sscanf(line, "opencl_options: %255[^;];", opencl_options);
   }
   fclose(fcfg);
 
   MaxNodes = (u64)nodes_per_second; 
 
+  multipv = (multipv<1)?1:(multipv>MAXMULTIPV)?MAXMULTIPV:multipv;
+
+  // native CPU search, one worker per thread, no device to help
+  if (cpu_threads>0)
+  {
+    threadsX = (u64)cpu_threads;
+    threadsY = 1;
+    cpu_helpers = 0;
+    tt_unified = 0;
+  }
+  cpu_helpers = (cpu_helpers<0)?0:cpu_helpers;
+
   totalWorkUnits = threadsX*threadsY;
 
   return true;
 }
+// move now via ?, uci stop and quit end a running search the same way
+static bool inputstopline(const char *line)
+{
+  return (line[0]=='?'
+          ||(uci_mode&&(!strncmp(line, "stop", 4)||!strncmp(line, "quit", 4))))?true:false;
+}
+// input reader thread, blocks in fgets while the engine searches
+static void *inputreader(void *arg)
+{
+  char line[1024];
+  bool stop;
+
+  (void)arg;
 
+  while (fgets(line, 1023, stdin))
+  {
+    // move now, seen by running search within milliseconds
+    stop = inputstopline(line);
+    if (stop)
+      MOVENOW = true;
+    // uci isready during blocking search, answered here, not queued
+    if (uci_mode&&uci_searching&&!strncmp(line, "isready", 7))
+    {
+      fprintf(stdout, "readyok\n");
+      fflush(stdout);
+      continue;
+    }
+
+    pthread_mutex_lock(&inputmutex);
+    while ((inputtail+1)%INPUTLINES==inputhead)
+      pthread_cond_wait(&inputcond, &inputmutex);
+    // again under lock, a reset by input_clearmovenow may have run between
+    if (stop)
+      MOVENOW = true;
+    memcpy(inputlines[inputtail], line, sizeof(line));
+    inputtail = (inputtail+1)%INPUTLINES;
+    pthread_cond_broadcast(&inputcond);
+    pthread_mutex_unlock(&inputmutex);
+  }
+
+  pthread_mutex_lock(&inputmutex);
+  inputeof = true;
+  pthread_cond_broadcast(&inputcond);
+  pthread_mutex_unlock(&inputmutex);
+
+  return NULL;
+}
+// start input reader thread, called once before the command loop
+bool input_start(void)
+{
+  if (pthread_create(&inputthread, NULL, inputreader, NULL))
+  {
+    fprintf(stdout,"Error (creating input thread): pthread_create\n");
+    return false;
+  }
+  pthread_detach(inputthread);
+
+  return true;
+}
+// get next input line, blocking, quit on end of input
+void input_getline(char *line)
+{
+  pthread_mutex_lock(&inputmutex);
+  while (inputhead==inputtail&&!inputeof)
+    pthread_cond_wait(&inputcond, &inputmutex);
+  if (inputhead!=inputtail)
+  {
+    memcpy(line, inputlines[inputhead], 1024);
+    inputhead = (inputhead+1)%INPUTLINES;
+    pthread_cond_broadcast(&inputcond);
+  }
+  else
+    strcpy(line, "quit\n");
+  pthread_mutex_unlock(&inputmutex);
+}
+// get next input line if available, non-blocking
+bool input_pollline(char *line)
+{
+  bool available;
+
+  pthread_mutex_lock(&inputmutex);
+  available = (inputhead!=inputtail||inputeof)?true:false;
+  pthread_mutex_unlock(&inputmutex);
+
+  if (available)
+    input_getline(line);
+
+  return available;
+}
+// clear move now on dispatch of a search command, before the search starts,
+// a stop already queued behind the command, before the next search command,
+// keeps it set
+void input_clearmovenow(void)
+{
+  bool stop = false;
+
+  pthread_mutex_lock(&inputmutex);
+  for (s32 i=inputhead;i!=inputtail&&!stop;i=(i+1)%INPUTLINES)
+  {
+    if (!strncmp(inputlines[i], "go", 2)
+        ||!strncmp(inputlines[i], "ponderhit", 9)
+        ||!strncmp(inputlines[i], "usermove", 8))
+      break;
+    stop = inputstopline(inputlines[i]);
+  }
+  MOVENOW = stop;
+  pthread_mutex_unlock(&inputmutex);
+}
@@ -33,6 +33,10 @@ void printboard(Bitboard *board);
 void createfen(char *fenstring, Bitboard *board, bool stm, s32 gameply);
 bool setboard(Bitboard *board, char *fenstring);
 bool read_and_init_config(char configfile[]);
+bool input_start(void);
+void input_getline(char *line);
+bool input_pollline(char *line);
+void input_clearmovenow(void);
 
 #endif /* IO_H_INCLUDED */
 
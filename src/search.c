@@ -29,23 +29,273 @@
 #include "io.h"           // various IO and format functions
 #include "timer.h"        // timer functions
 #include "types.h"        // types and defaults and macros 
+#include "uci.h"          // uci protocol command loop
 #include "xboard.h"       // xboard protocol command loop
 #include "zeta.h"         // for global vars and functions
 
+// state of open-ended analysis, runs as persistent search on device
+static bool analysing = false;
+static s32 analysisdepth = 1;
+static u64 analysisnodes = 0;
+static double analysistime = 0;
+static Move analysismove = MOVENONE;
+// best move of deepest depth completed by last stopped ponder search
+static Move pondermissmove = MOVENONE;
+// start of ponder search and next depth to print, reported time and nps
+// of an adopted ponder search count from start of pondering
+static double pondertime = 0;
+static s32 ponderdepth = 1;
+
+// permill of tt entries in use, estimated from stores into empty slots
+static s32 hashfull(void)
+{
+  u64 fills = TTFILLSTOTAL+TTFILLS;
+
+  return (fills>=ttbits1)?1000:(s32)(fills*1000/ttbits1);
+}
+// sampled occupancy, age and depth distribution of TT1 and TT2 after search,
+// shares of used entries in permill, to size tt1_memory and tt2_memory
+static void printttsample(bool out)
+{
+  static s32 samples[TTSAMPLES*TTSAMPLESIZE];
+  char line[512];
+  s32 total;
+  s32 used;
+  s32 div;
+  s32 age[4];
+  s32 depth[5];
+  s32 a;
+  s32 d;
+
+  if (!cl_sample_tt(samples))
+    return;
+
+  for (s32 t=0;t<2;t++)
+  {
+    total = 0;
+    used = 0;
+    memset(age, 0, sizeof(age));
+    memset(depth, 0, sizeof(depth));
+    for (s32 i=0;i<TTSAMPLES;i++)
+    {
+      if (samples[i*TTSAMPLESIZE+t*3]<0)
+        continue;
+      total++;
+      if (samples[i*TTSAMPLESIZE+t*3]==0)
+        continue;
+      used++;
+      a = samples[i*TTSAMPLESIZE+t*3+1];
+      d = samples[i*TTSAMPLESIZE+t*3+2];
+      age[(a<=0)?0:(a<=2)?1:(a<=8)?2:3]++;
+      depth[(d<0)?0:(d>=16)?4:d/4]++;
+    }
+    // table not present
+    if (total==0)
+      continue;
+    div = (used>0)?used:1;
+    snprintf(line, sizeof(line), "#tt%i sampled %i entries, hashfull: %i permill, age 0/1-2/3-8/9+ plies: %i/%i/%i/%i permill, depth 0-3/4-7/8-11/12-15/16+: %i/%i/%i/%i/%i permill \n", t+1, total, used*1000/total, age[0]*1000/div, age[1]*1000/div, age[2]*1000/div, age[3]*1000/div, depth[0]*1000/div, depth[1]*1000/div, depth[2]*1000/div, depth[3]*1000/div, depth[4]*1000/div);
+    if (out)
+      fprintf(stdout, "%s", line);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile, "%s", line);
+    }
+  }
+}
+// print uci info line of PV, as one write, input thread may answer isready
+static void printuciinfo(s32 depth, s32 line, Score score, double seconds, u64 nodes)
+{
+  char info[MAXPLY*6+256];
+  char movec[6];
+  s32 len;
+  s32 i = 1;
+
+  len = sprintf(info, "info depth %i", depth);
+  if (multipv>1)
+    len+= sprintf(info+len, " multipv %i", line);
+
+  // uci mate scores in moves, else centipawns
+  if (score>=MATESCORE)
+    len+= sprintf(info+len, " score mate %i", (INF-score+1)/2);
+  else if (score<=-MATESCORE)
+    len+= sprintf(info+len, " score mate %i", -(INF+score)/2);
+  else
+    len+= sprintf(info+len, " score cp %i", (s32)score);
+
+  len+= sprintf(info+len, " time %i nodes %" PRIu64 " nps %" PRIu64 " hashfull %i pv", (s32)(seconds*1000), nodes, (seconds>0)?(u64)((double)nodes/seconds):0, hashfull());
+
+  // print PV line
+  while(i<MAXPLY&&i<=depth)
+  { 
+    if (JUSTMOVE(PV[i])==MOVENONE)
+      break;
+    move2can(PV[i], movec);
+    len+= sprintf(info+len, " %s", movec);
+    i++;
+  };
+
+  fprintf(stdout, "%s\n", info);
+  fflush(stdout);
+  if (LogFile)
+  {
+    fprintdate(LogFile);
+    fprintf(LogFile, "%s\n", info);
+    fflush(LogFile);
+  }
+}
+// print depth score time nodes pv line of PV, line is multipv rank
+static void printpvline(s32 depth, s32 line, Score score, double seconds, u64 nodes)
+{
+  s32 xboard_score;
+  s32 i = 1;
+
+  if (uci_mode)
+  {
+    printuciinfo(depth, line, score, seconds, nodes);
+    return;
+  }
+
+  // xboard mate scores
+  xboard_score = (s32)score;
+  xboard_score = (score<=-MATESCORE)?
+                  -100000-(INF+score)
+                 :xboard_score;
+  xboard_score = (score>=MATESCORE)?
+                  100000-(-INF+score)
+                 :xboard_score;
+
+  fprintf(stdout,"%i %i %i %" PRIu64 " ", depth, xboard_score, (s32 )(seconds*100), nodes);          
+  if (LogFile)
+  {
+    fprintdate(LogFile);
+    fprintf(LogFile,"%i %i %i %" PRIu64 " ", depth, xboard_score, (s32 )(seconds*100), nodes);          
+  }
+
+  // print PV line
+  while(i<MAXPLY&&i<=depth)
+  { 
+    if (JUSTMOVE(PV[i])==MOVENONE)
+      break;
+    printmovecan(PV[i]);
+    fprintf(stdout," ");
+    if (LogFile)
+      fprintf(LogFile, " ");
+    i++;
+  };
+
+  fprintf(stdout,"\n");
+  if (LogFile)
+    fprintf(LogFile, "\n");
+
+  fflush(stdout);
+  if (LogFile)
+    fflush(LogFile);
+}
+// multipv, search lines 2 to n of depth with root moves of previous lines
+// excluded, all work-groups on each line, previous lines fill shared TT
+static void multipvsearch(bool stm, s32 depth)
+{
+  Move pvbest[MAXPLY];
+  bool state;
+  s32 line;
+
+  memcpy(pvbest, PV, MAXPLY*sizeof(Move));
+  memset(ROOTEXCLUDE, 0, sizeof(ROOTEXCLUDE));
+
+  for (line=2;line<=multipv;line++)
+  {
+    // exclude first move of previous line
+    ROOTEXCLUDE[GETSQFROM((Move)PV[1])] |= SETMASKBB(GETSQTO((Move)PV[1]));
+    ROOTEXCLUDE[MULTIPVCOUNT]++;
+
+    if (get_time()>=start+MaxTime||MOVENOW)
+      break;
+
+    state = cl_write_objects();
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    state = cl_run_alphabeta(stm, depth, MaxNodes/totalWorkUnits, -INF, INF, false);
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    state = cl_wait_alphabeta(start+MaxTime);
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    state = cl_read_memory();
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    for(u64 i=0;i<totalWorkUnits;i++)
+    {
+      ABNODECOUNT+=   COUNTERS[i*64+1];
+      TTHITS+=        COUNTERS[i*64+3];
+      TTSCOREHITS+=   COUNTERS[i*64+4];
+      IIDHITS+=       COUNTERS[i*64+5];
+      TTFILLS+=       COUNTERS[i*64+6];
+      TTPROBES+=      COUNTERS[i*64+7];
+      TTPROBEHITS+=   COUNTERS[i*64+8];
+    }
+    // interrupted by time or node limit, or no root move left
+    if (get_time()>=start+MaxTime
+        ||MOVENOW
+        ||COUNTERS[1]>=MaxNodes/totalWorkUnits
+        ||JUSTMOVE((Move)PV[1])==MOVENONE)
+      break;
+
+    elapsed = get_time()-start;
+    elapsed+=1;
+    elapsed/=1000; // to seconds
+
+    printpvline(depth, line, ISINF((Score)PV[0])?DRAWSCORE:(Score)PV[0], elapsed, ABNODECOUNT);
+  }
+
+  memset(ROOTEXCLUDE, 0, sizeof(ROOTEXCLUDE));
+  memcpy(PV, pvbest, MAXPLY*sizeof(Move));
+}
 Move rootsearch(Bitboard *board, bool stm, s32 depth)
 {
   bool state;
-  s32 xboard_score;
   Move bestmove = MOVENONE;
   Score bestscore = DRAWSCORE;
   s32 idf = 1;
+  s32 iterations = 0;
+  s32 researches = 0;
+  // ponder hit, take over running background search on this position
+  bool adopt = pondering;
+  // output time base, start of pondering on ponder hit
+  double infostart;
+  // depths already printed while pondering
+  s32 printed = (adopt)?ponderdepth-1:0;
+  // multipv lines and root split are searched per depth, not on persistent kernel
+  bool persistent = ((persistent_search&&multipv<=1&&!root_split)||adopt)?true:false;
+  double profile[MAXPLY][PROFTYPES][PROFSTAGES];
+  u64 profilecount[MAXPLY][PROFTYPES];
 
   ABNODECOUNT = 0;
   TTHITS = 0;
   TTSCOREHITS = 0;
   IIDHITS = 0;
+  TTFILLS = 0;
+  TTPROBES = 0;
+  TTPROBEHITS = 0;
+  hostoverhead = 0;
 
   start = get_time(); 
+  infostart = (adopt)?pondertime:start;
+  pondermove = MOVENONE;
+  memset(profile, 0, sizeof(profile));
+  memset(profilecount, 0, sizeof(profilecount));
 
   // init board
   memcpy(GLOBAL_BOARD, board, 7*sizeof(Bitboard));
@@ -55,15 +305,12 @@ Move rootsearch(Bitboard *board, bool stm, s32 depth)
   srand((unsigned int)start);
   for(u64 i=0;i<totalWorkUnits;i++)
   {
-    // prepare hash history
-    memcpy(&GLOBAL_HASHHISTORY[i*MAXGAMEPLY], 
-           HashHistory, MAXGAMEPLY * sizeof(Hash));
     // set random numbers
     for(u64 j=0;j<64;j++)
       RNUMBERS[i*64+j] = (u32)rand();
   }
 
-  if (xboard_mode==false)
+  if (xboard_mode==false&&uci_mode==false)
   { 
     fprintf(stdout, "depth score time nodes pv \n");
   }
@@ -73,36 +320,133 @@ Move rootsearch(Bitboard *board, bool stm, s32 depth)
     fprintf(LogFile, "depth score time nodes pv \n");
   }
 
-  // iterative deepening framework
-  do {
-
-    // call GPU functions
-  /*
-    state = cl_init_device();
+  // persistent search, one kernel launch runs iterative deepening on device
+  if (persistent&&!adopt)
+  {
+    state = cl_write_objects();
     // something went wrong...
     if (!state)
     {
       quitengine(EXIT_FAILURE);
     }
-  */
-    state = cl_write_objects();
+    state = cl_run_alphabeta(stm, (depth<MAXPLY)?depth:MAXPLY-1, MaxNodes/totalWorkUnits, -INF, INF, true);
     // something went wrong...
     if (!state)
     {
       quitengine(EXIT_FAILURE);
     }
-    state = cl_run_alphabeta(stm, idf, MaxNodes/totalWorkUnits);
-    // something went wrong...
-    if (!state)
+  }
+
+  // iterative deepening framework
+  do {
+    // aspiration search failed low and ran out of time, pv is no result
+    bool timeoutfaillow = false;
+
+    if (persistent)
     {
-      quitengine(EXIT_FAILURE);
+      bool completed;
+      // wait for device to publish depth, stop kernel at deadline
+      state = cl_wait_progress(idf, start+MaxTime, &completed);
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+      // kernel finished before depth was completed
+      if (!completed)
+        break;
+      // counters of persistent search accumulate over depths
+      ABNODECOUNT = 0;
+      TTHITS = 0;
+      TTSCOREHITS = 0;
+      IIDHITS = 0;
+      TTFILLS = 0;
+      TTPROBES = 0;
+      TTPROBEHITS = 0;
     }
-    state = cl_read_memory();
-    // something went wrong...
-    if (!state)
+    else
     {
-      quitengine(EXIT_FAILURE);
+      Score alpha = -INF;
+      Score beta = INF;
+      Score delta = ASPIRATIONWINDOW;
+      // aspiration window around score of previous depth
+      if (idf>ASPIRATIONDEPTH&&!ISMATE(bestscore))
+      {
+        alpha = bestscore-delta;
+        beta = bestscore+delta;
+      }
+      // re-search with widened window on fail-low or fail-high
+      while (true)
+      {
+        bool faillow;
+        bool failhigh;
+        // call GPU functions
+        state = cl_write_objects();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        state = cl_run_alphabeta(stm, idf, MaxNodes/totalWorkUnits, alpha, beta, false);
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        // watch the clock, stop kernel via host flag at deadline
+        state = cl_wait_alphabeta(start+MaxTime);
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        state = cl_read_memory();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        // keep OpenCL profiling per depth, aspiration re-searches add up
+        for (s32 t=0;opencl_profiling&&idf<MAXPLY&&t<PROFTYPES;t++)
+        {
+          for (s32 s=0;s<PROFSTAGES;s++)
+            profile[idf][t][s]+= clprofile[t][s];
+          profilecount[idf][t]+= clprofilecount[t];
+        }
+        // completed search without root move above alpha, or score >= beta
+        faillow = (alpha>-INF&&(Score)PV[0]==-INF)?true:false;
+        failhigh = (beta<INF
+                    &&JUSTMOVE((Move)PV[1])!=MOVENONE
+                    &&(Score)PV[0]>=beta)?true:false;
+        if (!faillow&&!failhigh)
+          break;
+        // out of time, keep fail-high move, fail-low keeps previous bestmove
+        if (get_time()>=start+MaxTime)
+        {
+          timeoutfaillow = faillow;
+          break;
+        }
+        // count nodes of failed search
+        for(u64 i=0;i<totalWorkUnits;i++)
+        {
+          ABNODECOUNT+=   COUNTERS[i*64+1];
+          TTHITS+=        COUNTERS[i*64+3];
+          TTSCOREHITS+=   COUNTERS[i*64+4];
+          IIDHITS+=       COUNTERS[i*64+5];
+          TTFILLS+=       COUNTERS[i*64+6];
+          TTPROBES+=      COUNTERS[i*64+7];
+          TTPROBEHITS+=   COUNTERS[i*64+8];
+        }
+        researches++;
+        // widen window on failed side, full window beyond max
+        delta+=delta;
+        if (faillow)
+          alpha = (delta>ASPIRATIONMAX)?-INF:bestscore-delta;
+        if (failhigh)
+          beta = (delta>ASPIRATIONMAX)?INF:bestscore+delta;
+      }
     }
+    iterations++;
   /*
     state = cl_release_device();
     // something went wrong...
@@ -118,6 +462,9 @@ Move rootsearch(Bitboard *board, bool stm, s32 depth)
       TTHITS+=        COUNTERS[i*64+3];
       TTSCOREHITS+=   COUNTERS[i*64+4];
       IIDHITS+=       COUNTERS[i*64+5];
+      TTFILLS+=       COUNTERS[i*64+6];
+      TTPROBES+=      COUNTERS[i*64+7];
+      TTPROBEHITS+=   COUNTERS[i*64+8];
     }
     // timers
     end = get_time();
@@ -125,55 +472,35 @@ Move rootsearch(Bitboard *board, bool stm, s32 depth)
     elapsed+=1;
     elapsed/=1000; // to seconds
 
+    // keep bestmove, pondermove and score of previous depth, no output
+    if (timeoutfaillow)
+      break;
+
     // get a bestmove anyway
     if (idf==1&&JUSTMOVE((Move)PV[1])!=MOVENONE)
       bestmove = (Move)PV[1];
 
     // only if gpu search was not interrupted by maxnodes
-    if (COUNTERS[1]<MaxNodes/totalWorkUnits)
+    // persistent search publishes completed depths only
+    if (persistent||COUNTERS[1]<MaxNodes/totalWorkUnits)
     {
       if (JUSTMOVE((Move)PV[1])!=MOVENONE)
+      {
         bestmove = (Move)PV[1];
+        // expected reply, for pondering
+        pondermove = (Move)PV[2];
+      }
       bestscore = ISINF((Score)PV[0])?DRAWSCORE:(Score)PV[0];
-      // xboard mate scores
-      xboard_score = (s32)bestscore;
-      xboard_score = (bestscore<=-MATESCORE)?
-                      -100000-(INF+bestscore)
-                     :xboard_score;
-      xboard_score = (bestscore>=MATESCORE)?
-                      100000-(-INF+bestscore)
-                     :xboard_score;
       // print xboard output
       if ((xboard_post==true||xboard_mode == false)
           &&(JUSTMOVE((Move)PV[1])!=MOVENONE))
       {
-        fprintf(stdout,"%i %i %i %" PRIu64 " ", idf, xboard_score, (s32 )(elapsed*100), ABNODECOUNT);          
-        if (LogFile)
-        {
-          fprintdate(LogFile);
-          fprintf(LogFile,"%i %i %i %" PRIu64 " ", idf, xboard_score, (s32 )(elapsed*100), ABNODECOUNT);          
-        }
-      
-        // print PV line
-        int i = 1;
-        while(i<MAXPLY&&i<=idf)
-        { 
-          if (JUSTMOVE(PV[i])==MOVENONE)
-            break;
-          printmovecan(PV[i]);
-          fprintf(stdout," ");
-          if (LogFile)
-            fprintf(LogFile, " ");
-          i++;
-        };
-
-        fprintf(stdout,"\n");
-        if (LogFile)
-          fprintf(LogFile, "\n");
-
-        fflush(stdout);
-        if (LogFile)
-          fflush(LogFile);
+        // adopted ponder search, time and nodes since start of pondering
+        if (idf>printed)
+          printpvline(idf, 1, bestscore, (end-infostart+1)/1000, ABNODECOUNT);
+        // further ranked lines of same depth
+        if (multipv>1&&!persistent)
+          multipvsearch(stm, idf);
       }
       else
         break;
@@ -192,24 +519,125 @@ Move rootsearch(Bitboard *board, bool stm, s32 depth)
     idf++;
   } while (idf<=depth
            &&elapsed*ESTEBF<MaxTime
-           &&ABNODECOUNT*ESTEBF<=MaxNodes
+           &&(adopt||ABNODECOUNT*ESTEBF<=MaxNodes) // ponder nodes are a bonus
            &&ABNODECOUNT>1
            &&idf<MAXPLY
+           &&!MOVENOW
           );
 
+  // persistent search, stop device and collect final counters
+  if (persistent)
+  {
+    state = cl_stop_alphabeta();
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    state = cl_wait_alphabeta(0);
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    state = cl_read_memory();
+    // something went wrong...
+    if (!state)
+    {
+      quitengine(EXIT_FAILURE);
+    }
+    // one launch, profiling of all depths kept as last depth
+    if (opencl_profiling&&iterations>0&&iterations<MAXPLY)
+    {
+      memcpy(profile[iterations], clprofile, sizeof(clprofile));
+      memcpy(profilecount[iterations], clprofilecount, sizeof(clprofilecount));
+    }
+    ABNODECOUNT = 0;
+    TTHITS = 0;
+    TTSCOREHITS = 0;
+    IIDHITS = 0;
+    TTFILLS = 0;
+    TTPROBES = 0;
+    TTPROBEHITS = 0;
+    for(u64 i=0;i<totalWorkUnits;i++)
+    {
+      ABNODECOUNT+=   COUNTERS[i*64+1];
+      TTHITS+=        COUNTERS[i*64+3];
+      TTSCOREHITS+=   COUNTERS[i*64+4];
+      IIDHITS+=       COUNTERS[i*64+5];
+      TTFILLS+=       COUNTERS[i*64+6];
+      TTPROBES+=      COUNTERS[i*64+7];
+      TTPROBEHITS+=   COUNTERS[i*64+8];
+    }
+    // summary of adopted ponder search from start of pondering
+    end = get_time();
+    elapsed = end-infostart;
+    elapsed+=1;
+    elapsed/=1000; // to seconds
+    pondering = false;
+  }
 
-  if ((!xboard_mode)||xboard_debug)
+  // host helper threads, stopped with search, nodes for combined nps
+  state = cl_stop_helpers();
+  // something went wrong...
+  if (!state)
   {
-    fprintf(stdout,"#%" PRIu64 " searched nodes in %lf seconds, with %" PRIu64 " ttmovehits, and %" PRIu64 " ttscorehits, %" PRIu64 " iidhits, ebf: %lf, nps: %" PRIu64 " \n", ABNODECOUNT, elapsed, TTHITS, TTSCOREHITS, IIDHITS, (double)pow(ABNODECOUNT, (double)1/idf), (u64)((double)ABNODECOUNT/(elapsed)));
+    quitengine(EXIT_FAILURE);
+  }
+
+  // tt fill estimate carries over to following searches until tt reset
+  TTFILLSTOTAL+= TTFILLS;
+
+  if ((!xboard_mode&&!uci_mode)||xboard_debug)
+  {
+    fprintf(stdout,"#%" PRIu64 " searched nodes in %lf seconds, with %" PRIu64 " ttmovehits, and %" PRIu64 " ttscorehits, %" PRIu64 " iidhits, ebf: %lf, nps: %" PRIu64 ", host overhead: %lf ms per iteration, aspiration researches: %i \n", ABNODECOUNT, elapsed, TTHITS, TTSCOREHITS, IIDHITS, (double)pow(ABNODECOUNT, (double)1/idf), (u64)((double)ABNODECOUNT/(elapsed)), hostoverhead/((iterations>0)?iterations:1), researches);
     if (LogFile)
     {
       fprintdate(LogFile);
-      fprintf(LogFile,"#%" PRIu64 " searched nodes in %lf seconds, with %" PRIu64 " ttmovehits, and %" PRIu64 " ttscorehits, %" PRIu64 " iidhits, ebf: %lf, nps: %" PRIu64 "  \n", ABNODECOUNT, elapsed, TTHITS, TTSCOREHITS, IIDHITS, (double)pow(ABNODECOUNT, (double)1/idf), (u64)((double)ABNODECOUNT/(elapsed)));
+      fprintf(LogFile,"#%" PRIu64 " searched nodes in %lf seconds, with %" PRIu64 " ttmovehits, and %" PRIu64 " ttscorehits, %" PRIu64 " iidhits, ebf: %lf, nps: %" PRIu64 ", host overhead: %lf ms per iteration, aspiration researches: %i  \n", ABNODECOUNT, elapsed, TTHITS, TTSCOREHITS, IIDHITS, (double)pow(ABNODECOUNT, (double)1/idf), (u64)((double)ABNODECOUNT/(elapsed)), hostoverhead/((iterations>0)?iterations:1), researches);
+    }
+    // tt probe hit rates, compare flat and bucketed TT1 layout
+    fprintf(stdout,"#%" PRIu64 " tt probes, hit rate: %lf, score hit rate: %lf, bucket size: %i \n", TTPROBES, (double)TTPROBEHITS/((TTPROBES>0)?TTPROBES:1), (double)TTSCOREHITS/((TTPROBES>0)?TTPROBES:1), (tt_buckets)?TTBUCKETSIZE:1);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile,"#%" PRIu64 " tt probes, hit rate: %lf, score hit rate: %lf, bucket size: %i \n", TTPROBES, (double)TTPROBEHITS/((TTPROBES>0)?TTPROBES:1), (double)TTSCOREHITS/((TTPROBES>0)?TTPROBES:1), (tt_buckets)?TTBUCKETSIZE:1);
+    }
+    // hybrid search, host helper nodes on top of device nodes
+    if (cpu_helpers>0)
+    {
+      fprintf(stdout,"#%" PRIu64 " host helper nodes with %i threads, combined nps: %" PRIu64 " \n", HELPERNODECOUNT, cpu_helpers, (u64)((double)(ABNODECOUNT+HELPERNODECOUNT)/(elapsed)));
+      if (LogFile)
+      {
+        fprintdate(LogFile);
+        fprintf(LogFile,"#%" PRIu64 " host helper nodes with %i threads, combined nps: %" PRIu64 " \n", HELPERNODECOUNT, cpu_helpers, (u64)((double)(ABNODECOUNT+HELPERNODECOUNT)/(elapsed)));
+      }
+    }
+    // OpenCL profiling breakdown per depth, execution ms and queue wait ms
+    for (s32 d=1;opencl_profiling&&d<=iterations&&d<MAXPLY;d++)
+    {
+      // persistent search fills last depth only
+      if (profilecount[d][PROFWRITE]+profilecount[d][PROFKERNEL]+profilecount[d][PROFREAD]==0)
+        continue;
+      fprintf(stdout,"#profile depth %i, writes: %" PRIu64 " in %lf ms wait %lf ms, kernels: %" PRIu64 " in %lf ms wait %lf ms, reads: %" PRIu64 " in %lf ms wait %lf ms \n", d, profilecount[d][PROFWRITE], profile[d][PROFWRITE][PROFEXEC], profile[d][PROFWRITE][PROFQUEUED]+profile[d][PROFWRITE][PROFSUBMIT], profilecount[d][PROFKERNEL], profile[d][PROFKERNEL][PROFEXEC], profile[d][PROFKERNEL][PROFQUEUED]+profile[d][PROFKERNEL][PROFSUBMIT], profilecount[d][PROFREAD], profile[d][PROFREAD][PROFEXEC], profile[d][PROFREAD][PROFQUEUED]+profile[d][PROFREAD][PROFSUBMIT]);
+      if (LogFile)
+      {
+        fprintdate(LogFile);
+        fprintf(LogFile,"#profile depth %i, writes: %" PRIu64 " in %lf ms wait %lf ms, kernels: %" PRIu64 " in %lf ms wait %lf ms, reads: %" PRIu64 " in %lf ms wait %lf ms \n", d, profilecount[d][PROFWRITE], profile[d][PROFWRITE][PROFEXEC], profile[d][PROFWRITE][PROFQUEUED]+profile[d][PROFWRITE][PROFSUBMIT], profilecount[d][PROFKERNEL], profile[d][PROFKERNEL][PROFEXEC], profile[d][PROFKERNEL][PROFQUEUED]+profile[d][PROFKERNEL][PROFSUBMIT], profilecount[d][PROFREAD], profile[d][PROFREAD][PROFEXEC], profile[d][PROFREAD][PROFQUEUED]+profile[d][PROFREAD][PROFSUBMIT]);
+      }
     }
   }
+  // tt occupancy, age and depth, sampled on idle device, with xboard post too
+  if ((!xboard_mode&&!uci_mode)||xboard_debug||(xboard_mode&&xboard_post)||LogFile)
+    printttsample(((!xboard_mode&&!uci_mode)||xboard_debug||(xboard_mode&&xboard_post))?true:false);
 
   fflush(stdout);
-  fflush(LogFile);
+  if (LogFile)
+    fflush(LogFile);
+
+  // keep nps estimate, nodes of adopted ponder search exceed elapsed time
+  if (adopt)
+    return bestmove;
 
   // compute next nps value
   nps_current =  (s64)((double)ABNODECOUNT/elapsed);
@@ -233,13 +661,6 @@ Score perft(Bitboard *board, bool stm, s32 depth)
   memcpy(GLOBAL_BOARD, board, 7*sizeof(Bitboard));
   // reset counters
   memcpy(COUNTERS, COUNTERSZEROED, totalWorkUnits*threadsZ*sizeof(u64));
-  // prepare hash history
-  for(u64 i=0;i<totalWorkUnits;i++)
-  {
-    memcpy(&GLOBAL_HASHHISTORY[i*MAXGAMEPLY], 
-            HashHistory, MAXGAMEPLY* sizeof(Hash));
-  }
-
   start = get_time(); 
 
   state = cl_write_objects();
@@ -269,4 +690,210 @@ Score perft(Bitboard *board, bool stm, s32 depth)
 
   return 0;
 }
+// launch persistent search on position without waiting, stopped by host
+static bool searchstart(Bitboard *board, bool stm)
+{
+  // init board
+  memcpy(GLOBAL_BOARD, board, 7*sizeof(Bitboard));
+  // reset counters
+  memcpy(COUNTERS, COUNTERSZEROED, totalWorkUnits*threadsZ*sizeof(u64));
+  // init prng
+  srand((unsigned int)get_time());
+  for(u64 i=0;i<totalWorkUnits;i++)
+  {
+    // set random numbers
+    for(u64 j=0;j<64;j++)
+      RNUMBERS[i*64+j] = (u32)rand();
+  }
+  HashHistory[PLY] = board[QBBHASH];
+  if (!cl_write_objects())
+    return false;
+  // persistent search to max depth, no node limit
+  if (!cl_run_alphabeta(stm, MAXPLY-1, PONDERNODES, -INF, INF, true))
+    return false;
+
+  return true;
+}
+// stop persistent search and wait for it, device is ready for next search
+static bool searchstop(void)
+{
+  if (!cl_stop_alphabeta())
+    return false;
+  if (!cl_wait_alphabeta(0))
+    return false;
+  if (!cl_read_memory())
+    return false;
+  if (!cl_stop_helpers())
+    return false;
+
+  return true;
+}
+// start background search on position after expected reply, do not wait
+bool ponderstart(Bitboard *board, bool stm, Move move)
+{
+  Bitboard ponderboard[7];
+  bool state;
+
+  if (pondering||JUSTMOVE(move)==MOVENONE||PLY+1>=MAXGAMEPLY)
+    return true;
+  // sanity check of expected reply from hash table pv
+  if ((Piece)GETPIECE(board, GETSQFROM(move))!=(Piece)GETPFROM(move)
+      ||GETCOLOR(GETPFROM(move))!=stm)
+    return true;
+
+  memcpy(ponderboard, board, 7*sizeof(Bitboard));
+  domove(ponderboard, move);
+
+  // game history as if expected reply was played
+  PLY++;
+  state = searchstart(ponderboard, !stm);
+  PLY--;
+  if (!state)
+    return false;
+
+  ponderhash = ponderboard[QBBHASH];
+  pondering = true;
+  pondertime = get_time();
+  ponderdepth = 1;
+
+  return true;
+}
+// print depths of ponder search completed since last call, does not block,
+// time and nodes since start of pondering
+bool ponderstep(void)
+{
+  bool ready = true;
+  bool done = false;
+  u64 nodes;
+
+  while (pondering&&ready&&ponderdepth<MAXPLY)
+  {
+    if (!cl_poll_progress(ponderdepth, &ready, &done))
+      return false;
+    if (!ready)
+      break;
+    nodes = 0;
+    for(u64 i=0;i<totalWorkUnits;i++)
+      nodes+= COUNTERS[i*64+1];
+    if ((xboard_post==true||xboard_mode==false)
+        &&JUSTMOVE((Move)PV[1])!=MOVENONE)
+      printpvline(ponderdepth, 1, ISINF((Score)PV[0])?DRAWSCORE:(Score)PV[0], (get_time()-pondertime+1)/1000, nodes);
+    ponderdepth++;
+  }
+
+  return true;
+}
+// stop background search on ponder miss, device is ready for next search
+bool ponderstop(void)
+{
+  bool ready = true;
+  bool done = false;
+
+  pondermissmove = MOVENONE;
+
+  if (!pondering)
+    return true;
+
+  pondering = false;
+
+  // deepest completed depth before stop, bestmove on uci ponder miss
+  for (s32 d=1;d<MAXPLY&&ready;d++)
+  {
+    if (!cl_poll_progress(d, &ready, &done))
+      return false;
+    if (ready&&JUSTMOVE((Move)PV[1])!=MOVENONE)
+    {
+      pondermissmove = (Move)PV[1];
+      pondermove = (Move)PV[2];
+    }
+  }
 
+  return searchstop();
+}
+// best move of stopped ponder search, MOVENONE if no depth completed
+Move ponderbestmove(void)
+{
+  return pondermissmove;
+}
+// start open-ended analysis of position, depths are streamed by analysisstep
+bool analysisstart(Bitboard *board, bool stm)
+{
+  if (analysing)
+    return true;
+
+  if (!searchstart(board, stm))
+    return false;
+
+  analysisdepth = 1;
+  analysisnodes = 0;
+  analysistime = get_time();
+  analysismove = MOVENONE;
+  pondermove = MOVENONE;
+  TTFILLS = 0;
+  analysing = true;
+
+  if (!xboard_mode&&!uci_mode)
+  { 
+    fprintf(stdout, "depth score time nodes pv \n");
+  }
+
+  return true;
+}
+// print depths completed since last call, does not block
+bool analysisstep(void)
+{
+  bool ready = true;
+  bool done = false;
+
+  while (analysing&&ready&&analysisdepth<MAXPLY)
+  {
+    if (!cl_poll_progress(analysisdepth, &ready, &done))
+      return false;
+    if (!ready)
+      break;
+    analysisnodes = 0;
+    TTFILLS = 0;
+    for(u64 i=0;i<totalWorkUnits;i++)
+    {
+      analysisnodes+= COUNTERS[i*64+1];
+      TTFILLS+=       COUNTERS[i*64+6];
+    }
+    // best move and expected reply of deepest completed depth
+    if (JUSTMOVE((Move)PV[1])!=MOVENONE)
+    {
+      analysismove = (Move)PV[1];
+      pondermove = (Move)PV[2];
+    }
+    printpvline(analysisdepth, 1, ISINF((Score)PV[0])?DRAWSCORE:(Score)PV[0], (get_time()-analysistime)/1000, analysisnodes);
+    analysisdepth++;
+  }
+
+  return true;
+}
+// print analysis status line, answer to . command
+void analysisstatus(void)
+{
+  if (!analysing)
+    return;
+
+  // time nodes ply mvleft mvtot, move counts at root are not tracked
+  fprintf(stdout, "stat01: %i %" PRIu64 " %i 0 0\n", (s32)((get_time()-analysistime)/10), analysisnodes, analysisdepth-1);
+  fflush(stdout);
+}
+// stop analysis, device is ready for next search
+bool analysisstop(void)
+{
+  if (!analysing)
+    return true;
+
+  analysing = false;
+  TTFILLSTOTAL+= TTFILLS;
+  TTFILLS = 0;
+
+  return searchstop();
+}
+// best move of deepest completed analysis depth, MOVENONE if none
+Move analysisbestmove(void)
+{
+  return analysismove;
+}
@@ -24,6 +24,15 @@
 
 Move rootsearch(Bitboard *board, bool stm, s32 depth);
 Score perft(Bitboard *board, bool stm, s32 depth);
+bool ponderstart(Bitboard *board, bool stm, Move move);
+bool ponderstep(void);
+bool ponderstop(void);
+Move ponderbestmove(void);
+bool analysisstart(Bitboard *board, bool stm);
+bool analysisstep(void);
+void analysisstatus(void);
+bool analysisstop(void);
+Move analysisbestmove(void);
 
 #endif /* SEARCH_H_INCLUDED */
 
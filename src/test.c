@@ -26,6 +26,7 @@
 
 #include "bitboard.h"     // bitboard related functions
 #include "clrun.h"        // OpenCL run functions
+#include "cpu.h"          // native CPU search
 #include "io.h"           // various IO and format functions
 #include "search.h"       // rootsearch and perft
 #include "timer.h"        // timer functions
@@ -38,7 +39,10 @@ void selftest(void)
   bool state;
   u64 done;
   u64 passed = 0;
-  const u64 todo = 14;
+  u64 cpunodes = 0;
+  // OpenCL device runs, plus same positions on native CPU path,
+  // unless cpu_threads runs the device tests on CPU path anyway
+  const u64 todo = (cpu_threads>0)?14:28;
 
   char fenpositions[14][256]  =
   {
@@ -85,18 +89,18 @@ void selftest(void)
     quitengine(EXIT_FAILURE);
   }
 
-  for (done=0;done<todo;done++)
+  for (done=0;done<14;done++)
   {
 
     ABNODECOUNT = 0;
 
     SD = depths[done];
     
-    fprintf(stdout,"#> doing perft depth: %d for position %" PRIu64 " of %" PRIu64 "\n", SD, done+1, todo);  
+    fprintf(stdout,"#> doing perft depth: %d for position %" PRIu64 " of %" PRIu64 "\n", SD, done+1, (u64)14);  
     if (LogFile)
     {
       fprintdate(LogFile);
-      fprintf(LogFile,"#> doing perft depth: %d for position %" PRIu64 " of %" PRIu64 "\n", SD, done+1, todo);  
+      fprintf(LogFile,"#> doing perft depth: %d for position %" PRIu64 " of %" PRIu64 "\n", SD, done+1, (u64)14);  
     }
     if (!setboard(BOARD,  fenpositions[done]))
     {
@@ -140,6 +144,30 @@ void selftest(void)
         fprintf(LogFile,"#> Error, Nodecount NOT Correct, %" PRIu64 " computed nodes != %" PRIu64 " nodes for depth %d. in %lf seconds with %" PRIu64 " nps.\n", ABNODECOUNT, nodecounts[done], SD, (elapsed/1000), (u64)((double)ABNODECOUNT/(elapsed/1000)));
       }
     }
+    // native CPU path, same position, catches divergence to OpenCL kernel
+    if (cpu_threads==0)
+    {
+      cpunodes = cpu_perft_count(BOARD, STM, SD);
+      if(cpunodes==nodecounts[done])
+      {
+        passed++;
+        fprintf(stdout,"#> OK, CPU path Nodecount Correct, %" PRIu64 " nodes.\n", cpunodes);
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"#> OK, CPU path Nodecount Correct, %" PRIu64 " nodes.\n", cpunodes);
+        }
+      }
+      else
+      {
+        fprintf(stdout,"#> Error, CPU path Nodecount NOT Correct, %" PRIu64 " computed nodes != %" PRIu64 " nodes for depth %d.\n", cpunodes, nodecounts[done], SD);
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"#> Error, CPU path Nodecount NOT Correct, %" PRIu64 " computed nodes != %" PRIu64 " nodes for depth %d.\n", cpunodes, nodecounts[done], SD);
+        }
+      }
+    }
   }
   fprintf(stdout,"#\n###############################\n");
   fprintf(stdout,"### passed %" PRIu64 " from %" PRIu64 " tests ###\n", passed, todo);
@@ -19,6 +19,8 @@
   GNU General Public License for more details.
 */
 
+#define _POSIX_C_SOURCE 200112L // for nanosleep
+
 #include <stdio.h>      // for file IO
 #include <string.h>     // for string comparing functions
 #include <time.h>       // for time measurement
@@ -31,6 +33,22 @@ double get_time(void)
   gettimeofday (&t, NULL);
   return t.tv_sec*1000 + t.tv_usec/1000;
 }
+// get monotonic time in milli seconds, micro second resolution,
+// for host overhead of short OpenCL calls
+double get_time_mono(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec*1000 + (double)t.tv_nsec/1000000;
+}
+// sleep for milli seconds, used to poll running device searches
+void sleep_ms(double ms)
+{
+  struct timespec ts;
+  ts.tv_sec  = (time_t)(ms/1000);
+  ts.tv_nsec = (long)((ms-(double)ts.tv_sec*1000)*1000000);
+  nanosleep(&ts, NULL);
+}
 void get_date_string(char *string)
 {
   time_t t;
@@ -27,6 +27,8 @@
 #include <sys/time.h>   // for gettimeofday
 
 double get_time(void);
+double get_time_mono(void);
+void sleep_ms(double ms);
 void get_date_string(char *string);
 void fprintdate(FILE *file);
 
@@ -80,6 +80,49 @@ typedef u8 Rank;
 #define MINDEVICEMB 128ULL  // min memory of OpenCl device in MB
 #define ESTEBF      3       // estaminated effective branching factor, for tc
 #define SPEEDUPMARGIN 1.68f // used in guessconfig to guess totalworkers
+#define ASPIRATIONDEPTH 3   // use aspiration windows at root beyond depth n
+#define ASPIRATIONWINDOW 50 // initial aspiration window, +- n centipawns
+#define ASPIRATIONMAX  800  // widened beyond n, search failed side open
+#define INPUTLINES  64      // max queued input lines of input reader thread
+#define PONDERNODES 0x7FFFFFFFFFFFFFFFULL // ponder search node limit, stopped by host
+#define MAXMULTIPV  32      // max number of multipv lines
+#define MULTIPVSIZE 65      // per square excluded root moves, plus count
+#define MULTIPVCOUNT 64     // index of excluded root moves count
+// root split work queue layout in u32, consider also zeta.cl file
+#define MAXSPLIT    128     // max split points per search, at root children only
+#define RSSPLIT     20484   // per root move tables, counters, then split points
+#define ROOTSPLITSIZE (RSSPLIT+MAXSPLIT*4+MAXSPLIT*4096+MAXMOVES) // plus root move list
+#define UCIMOVESTOGO 40     // assumed moves to go in uci sudden death
+#define UCIMAXTIME  (1000.0*60*60*24) // uci search without time limit, in ms
+#define CHECKPOINTSIZE 1024 // per work-group search stack checkpoint in u64, consider also zeta.cl file
+// persistent search progress buffer layout in u32, consider also zeta.cl file
+#define PROGPV        0                     // per depth slot, ready, score, pv
+#define PROGSLOT      (MAXPLY+1)
+#define PROGCOUNT     (PROGPV+MAXPLY*PROGSLOT) // per depth counter totals, u64 as two u32
+#define PROGNCOUNT    8                     // counter slots 1 to 8 of COUNTERS
+#define PROGRESSSIZE  (PROGCOUNT+MAXPLY*PROGNCOUNT*2)
+#define TTBUCKETSIZE 4      // TT1 entries per 64 byte bucket with tt_buckets, consider also zeta.cl file
+#define MAXMERGE    65536   // max host helper TT entries merged into device TT1 per launch
+#define MAXPROFEVENTS 256   // max retained OpenCL events per iteration for profiling
+#define TTSAMPLES     4096  // TT entries sampled per table after search, consider also zeta.cl file
+#define TTSAMPLESIZE  6     // s32 per sample, used, age, depth of TT1 then TT2
+// TT file of savett and loadtt, header followed by TT1 and optional TT2 entries
+#define TTFILEMAGIC   0x314654544154455AULL // "ZETATTF1" little endian
+#define TTFILEVERSION 1     // hash scheme and entry layout, bump on changes, consider also zobrist.h file
+#define TTFILECHUNK   (64ULL*1024*1024) // bytes per streamed chunk, two in flight
+#define TTFILEBUCKET  0x1   // layout flag, TT1 buckets
+#define TTFILEUNIFIED 0x2   // layout flag, TT1 entries with abdada lock
+#define TTFILECOMPACT 0x4   // layout flag, packed TT2 entries
+// OpenCL profiling, command types
+#define PROFWRITE           0
+#define PROFKERNEL          1
+#define PROFREAD            2
+#define PROFTYPES           3
+// OpenCL profiling, intervals
+#define PROFQUEUED          0 // queued to submit, host side
+#define PROFSUBMIT          1 // submit to start, device queue
+#define PROFEXEC            2 // start to end, execution
+#define PROFSTAGES          3
 // colors
 #define BLACK               1
 #define WHITE               0
@@ -212,6 +255,17 @@ typedef struct
   u8 flag;
   u8 depth;
 } TTE;
+// device TT1 entry with tt_unified, same size as TTE, upper half of hash as
+// key, abdada generation and owner in lock, consider also zeta.cl file
+typedef struct
+{
+  u32 hash;
+  TTMove bestmove;
+  TTScore score;
+  u8 flag;
+  u8 depth;
+  u32 lock;
+} TTEUNIFIED;
 // abdada transposition table entry
 typedef struct
 {
@@ -222,6 +276,21 @@ typedef struct
   TTScore score;
   s16 depth;
 } ABDADATTE;
+// packed abdada entry with tt2_compact, key 16 bits, lock 16 bits,
+// search generation 8 bits, score 16 bits, depth 8 bits,
+// consider also zeta.cl file
+typedef u64 ABDADATTEPACKED;
+// TT file header, entry counts and bytes per entry must match device tables
+typedef struct
+{
+  u64 magic;
+  u32 version;
+  u32 layout;
+  u64 tt1entries;
+  u64 tt1size;
+  u64 tt2entries;   // 0 if TT2 not saved
+  u64 tt2size;
+} TTFILE;
 // TT node type flags
 #define FAILLOW         0
 #define EXACTSCORE      1
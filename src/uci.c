@@ -0,0 +1,528 @@
+/*
+  Name:         Zeta
+  Description:  Experimental chess engine written in OpenCL.
+  Author:       Srdja Matovic <s.matovic@app26.de>
+  Created at:   2018-03-25
+  Updated at:   2019
+  License:      GPL >= v2
+
+  Copyright (C) 2011-2019 Srdja Matovic
+
+  Zeta is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  Zeta is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+*/
+
+#include <stdio.h>        // for print and scan
+#include <stdlib.h>       // for exit
+#include <string.h>       // for string compare
+
+#include "bitboard.h"     // bitboard related functions
+#include "clrun.h"        // OpenCL run functions
+#include "io.h"           // various IO and format functions
+#include "search.h"       // rootsearch and perft
+#include "timer.h"        // timer functions
+#include "types.h"        // types and defaults and macros
+#include "uci.h"          // uci protocol command loop
+#include "zeta.h"         // for global vars and functions
+
+// uci flags
+volatile bool uci_mode      = false;  // set by uci command
+volatile bool uci_searching = false;  // blocking search runs, input thread answers isready
+static bool uci_ponder      = false;  // go ponder, wait for ponderhit or stop
+static bool uci_infinite    = false;  // go infinite, analysis until stop
+
+// position before last move of position command, expected reply for pondering
+static Bitboard uciprevboard[7];
+
+// identify engine and options, hash size and device via config file
+static void uciid(void)
+{
+  fprintf(stdout,"id name Zeta %s\n",VERSION);
+  fprintf(stdout,"id author Srdja Matovic\n");
+  fprintf(stdout,"option name Ponder type check default false\n");
+  fprintf(stdout,"option name MultiPV type spin default %i min 1 max %i\n", multipv, MAXMULTIPV);
+  fprintf(stdout,"option name SaveTT type string default <empty>\n");
+  fprintf(stdout,"option name LoadTT type string default <empty>\n");
+  fprintf(stdout,"uciok\n");
+}
+// print bestmove with optional expected reply
+static void ucibestmove(Move move, Move ponder)
+{
+  char movec[6] = "0000";
+  char ponderc[6];
+
+  if (JUSTMOVE(move)!=MOVENONE)
+    move2can(move, movec);
+
+  if (JUSTMOVE(move)!=MOVENONE&&JUSTMOVE(ponder)!=MOVENONE)
+  {
+    move2can(ponder, ponderc);
+    fprintf(stdout, "bestmove %s ponder %s\n", movec, ponderc);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile, "bestmove %s ponder %s\n", movec, ponderc);
+    }
+  }
+  else
+  {
+    fprintf(stdout, "bestmove %s\n", movec);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile, "bestmove %s\n", movec);
+    }
+  }
+  fflush(stdout);
+  if (LogFile)
+    fflush(LogFile);
+}
+// search position with limits set by go, stop and isready via input thread
+static void ucisearch(void)
+{
+  Move move;
+
+  MOVECOUNT = 0;
+  HashHistory[PLY] = BOARD[QBBHASH];
+
+  uci_searching = true;
+  move = rootsearch(BOARD, STM, SD);
+  uci_searching = false;
+
+  ucibestmove(move, pondermove);
+}
+// bestmove after stop of background search, gui expects one anyway,
+// depth 1 search if no depth was completed or no search was started
+static void ucistopmove(Move move)
+{
+  if (JUSTMOVE(move)!=MOVENONE)
+  {
+    ucibestmove(move, pondermove);
+    return;
+  }
+  SD = 1;
+  MOVENOW = false;
+  ucisearch();
+}
+// stop background search of go infinite or go ponder, report bestmove
+static bool ucistop(void)
+{
+  if (uci_infinite)
+  {
+    uci_infinite = false;
+    if (!analysisstop())
+      return false;
+    ucistopmove(analysisbestmove());
+  }
+  if (uci_ponder)
+  {
+    uci_ponder = false;
+    // ponder miss, gui drops bestmove, take deepest pv of stopped search
+    if (!ponderstop())
+      return false;
+    ucistopmove(ponderbestmove());
+  }
+
+  return true;
+}
+// position [startpos|fen fenstring] [moves move1 ... moven]
+static void uciposition(void)
+{
+  char movec[6];
+  char *moves;
+  s32 n = 0;
+  Move move;
+
+  // split move list from fen string
+  moves = strstr(Line, " moves");
+  if (moves)
+  {
+    *moves = '\0';
+    moves+= 6;
+  }
+
+  *Fen = '\0';
+  if (!strncmp(Line, "position startpos", 17))
+    strcpy(Fen, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+  else
+    sscanf (Line, "position fen %1023[0-9a-zA-Z /-]", Fen);
+
+  if(*Fen == '\0' || !setboard(BOARD, Fen))
+  {
+    fprintf(stdout,"info string Error (in setting chess position): position\n");
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile,"Error (in setting chess position): position\n");
+    }
+    return;
+  }
+
+  CRHistory[PLY] = BOARD[QBBPMVD];
+  HMCHistory[PLY] = BOARD[QBBHMC];
+  memcpy(uciprevboard, BOARD, 7*sizeof(Bitboard));
+
+  // apply moves in coordinate algebraic notation
+  while (moves&&PLY+1<MAXGAMEPLY&&sscanf(moves, "%5s%n", movec, &n)==1)
+  {
+    moves+= n;
+
+    memcpy(uciprevboard, BOARD, 7*sizeof(Bitboard));
+    move = can2move(movec, BOARD, STM);
+
+    domove(BOARD, move);
+
+    PLY++;
+    STM = !STM;
+
+    HashHistory[PLY] = BOARD[QBBHASH];
+    MoveHistory[PLY] = move;
+    CRHistory[PLY] = BOARD[QBBPMVD];
+    HMCHistory[PLY] = BOARD[QBBHMC];
+  }
+}
+// go [wtime btime winc binc movestogo movetime depth nodes infinite ponder]
+static bool ucigo(void)
+{
+  char *token;
+  double wtime = 0;
+  double btime = 0;
+  double winc = 0;
+  double binc = 0;
+  double movetime = 0;
+  s32 movestogo = 0;
+  s32 depth = 0;
+  u64 nodes = 0;
+
+  if ((token = strstr(Line, " wtime ")))
+    sscanf(token, " wtime %lf", &wtime);
+  if ((token = strstr(Line, " btime ")))
+    sscanf(token, " btime %lf", &btime);
+  if ((token = strstr(Line, " winc ")))
+    sscanf(token, " winc %lf", &winc);
+  if ((token = strstr(Line, " binc ")))
+    sscanf(token, " binc %lf", &binc);
+  if ((token = strstr(Line, " movestogo ")))
+    sscanf(token, " movestogo %d", &movestogo);
+  if ((token = strstr(Line, " movetime ")))
+    sscanf(token, " movetime %lf", &movetime);
+  if ((token = strstr(Line, " depth ")))
+    sscanf(token, " depth %d", &depth);
+  if ((token = strstr(Line, " nodes ")))
+    sscanf(token, " nodes %" SCNu64, &nodes);
+
+  // fresh move now flag before the search starts, stop may be queued already
+  input_clearmovenow();
+
+  // set search depth
+  SD = (depth>0&&depth<MAXPLY)?depth:MAXPLY;
+
+  // set max time per move, clock times in milli-seconds
+  TimeLeft = (STM==BLACK)?btime:wtime;
+  TimeInc = (STM==BLACK)?binc:winc;
+  if (strstr(Line, " infinite"))
+  {
+    MaxTime = UCIMAXTIME;
+  }
+  else if (movetime>0)
+  {
+    MaxTime = movetime;
+  }
+  else if (TimeLeft>0)
+  {
+    // one move as time spare, like xboard time control
+    MovesLeft = (movestogo>0)?movestogo+1:UCIMOVESTOGO;
+    MaxTime = TimeLeft/MovesLeft+TimeInc;
+    // increment can not be spent before it is added
+    if (MaxTime>=TimeLeft)
+      MaxTime = TimeLeft/2;
+  }
+  else
+    MaxTime = UCIMAXTIME;
+
+  // get max nodes to search
+  if (nodes>0)
+    MaxNodes = nodes;
+  else if (MaxTime<UCIMAXTIME)
+    MaxNodes = (u64)(MaxTime/1000*(double)nodes_per_second);
+  else
+    MaxNodes = PONDERNODES;
+
+  // analysis until stop, streams completed depths
+  // multipv lines are searched per depth, blocking search until stop
+  if (strstr(Line, " infinite")&&multipv<=1)
+  {
+    HashHistory[PLY] = BOARD[QBBHASH];
+    uci_infinite = true;
+    return analysisstart(BOARD, STM);
+  }
+  // search expected reply in background, adopted by search on ponderhit
+  if (strstr(Line, " ponder"))
+  {
+    bool state = true;
+    uci_ponder = true;
+    if (PLY>0)
+    {
+      PLY--;
+      state = ponderstart(uciprevboard, !STM, MoveHistory[PLY+1]);
+      PLY++;
+    }
+    return state;
+  }
+
+  ucisearch();
+
+  return true;
+}
+// reset game state, keep OpenCL context, program and buffers alive
+static bool ucinewgame(void)
+{
+  bool state;
+
+  resetgameinits();
+  state = cl_reset_device();
+  // device not ready for search, full re-init
+  if (!state)
+  {
+    release_gameinits();
+    state = gameinits();
+    if (!state)
+      return false;
+    state = cl_release_device();
+    if (!state)
+      return false;
+    state = cl_init_device("alphabeta_gpu");
+    if (!state)
+      return false;
+  }
+  if (!setboard(BOARD, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"))
+    return false;
+
+  SD = MAXPLY; // reset search depth
+  MaxNodes = (u64)(MaxTime/1000*(double)nodes_per_second);
+
+  return true;
+}
+// save or load hash table file, args are file name and optional tt2 to add
+// ABDADA table on save, errors are reported via info string
+static void ucitt(bool save, char *args)
+{
+  char ttfile[256] = "";
+  char ttopt[8] = "";
+  bool state = false;
+  double start = 0;
+
+  if (sscanf(args, "%255s %7s", ttfile, ttopt)<1||!strcmp(ttfile, "<empty>"))
+  {
+    fprintf(stdout,"info string Error (missing file name): %s\n", (save)?"savett":"loadtt");
+    return;
+  }
+
+  start = get_time();
+
+  if (save)
+    state = cl_save_tt(ttfile, (!strcmp(ttopt, "tt2"))?true:false);
+  else
+    state = cl_load_tt(ttfile);
+
+  if (state)
+  {
+    fprintf(stdout,"info string %s %s done, seconds: %lf\n", (save)?"savett":"loadtt", ttfile, (get_time()-start)/1000);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile,"info string %s %s done\n", (save)?"savett":"loadtt", ttfile);
+    }
+  }
+  else
+  {
+    fprintf(stdout,"info string Error (%s failed): %s\n", (save)?"savett":"loadtt", ttfile);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile,"Error (%s failed): %s\n", (save)?"savett":"loadtt", ttfile);
+    }
+  }
+}
+// uci protocol command loop, entered via uci command on stdin
+void uci(void)
+{
+  bool state = false;
+
+  uci_mode = true;
+
+  uciid();
+
+  // input loop
+  for (;;)
+  {
+    // just to be sure, flush the output...*/
+    fflush (stdout);
+    if (LogFile)
+      fflush (LogFile);
+    // go infinite or go ponder, stream finished depths until input arrives
+    if (uci_infinite||uci_ponder)
+    {
+      while (!input_pollline(Line))
+      {
+        state = (uci_infinite)?analysisstep():ponderstep();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        sleep_ms(1);
+      }
+    }
+    // get Line
+    else
+      input_getline(Line);
+    // ignore empty Lines
+    if (Line[0] == '\n')
+      continue;
+    // print io to log file
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile, ">> %s",Line);
+    }
+    // get command
+    *Command = '\0';
+    sscanf (Line, "%s", Command);
+    // uci commands
+    if (!strcmp(Command, "uci"))
+    {
+      uciid();
+      continue;
+    }
+    // sync with gui, background search keeps running
+    if (!strcmp(Command, "isready"))
+    {
+      fprintf(stdout,"readyok\n");
+      continue;
+    }
+    // stop go infinite or go ponder, blocking search was stopped by input thread
+    if (!strcmp(Command, "stop"))
+    {
+      state = ucistop();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+      continue;
+    }
+    // opponent played expected reply, search takes over ponder search
+    if (!strcmp(Command, "ponderhit"))
+    {
+      if (uci_ponder)
+      {
+        uci_ponder = false;
+        input_clearmovenow();
+        ucisearch();
+      }
+      continue;
+    }
+    // exit program
+    if (!strcmp(Command, "quit"))
+    {
+      uci_ponder = false;
+      uci_infinite = false;
+      state = analysisstop();
+      if (state)
+        state = ponderstop();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+      break;
+    }
+    // any other command ends background search without bestmove
+    if (uci_infinite||uci_ponder)
+    {
+      uci_infinite = false;
+      uci_ponder = false;
+      state = analysisstop();
+      if (state)
+        state = ponderstop();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+    }
+    // initialize new game
+    if (!strcmp(Command, "ucinewgame"))
+    {
+      state = ucinewgame();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+      continue;
+    }
+    // set up position
+    if (!strcmp(Command, "position"))
+    {
+      uciposition();
+      continue;
+    }
+    // start search
+    if (!strcmp(Command, "go"))
+    {
+      state = ucigo();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+      continue;
+    }
+    // set number of multipv lines, save or load hash table file,
+    // hash and device via config file
+    if (!strcmp(Command, "setoption"))
+    {
+      if (sscanf(Line, "setoption name MultiPV value %d", &multipv)==1)
+        multipv = (multipv<1)?1:(multipv>MAXMULTIPV)?MAXMULTIPV:multipv;
+      else if (!strncmp(Line, "setoption name SaveTT value ", 28))
+        ucitt(true, Line+28);
+      else if (!strncmp(Line, "setoption name LoadTT value ", 28))
+        ucitt(false, Line+28);
+      else if (!strncmp(Line, "setoption name SaveTT", 21)
+               ||!strncmp(Line, "setoption name LoadTT", 21))
+        ucitt((Line[15]=='S')?true:false, (char *)"");
+      continue;
+    }
+    // save or load hash table file, same as setoption SaveTT and LoadTT
+    if (!strcmp(Command, "savett")||!strcmp(Command, "loadtt"))
+    {
+      ucitt((!strcmp(Command, "savett"))?true:false, Line+6);
+      continue;
+    }
+    if (!strcmp(Command, "debug"))
+    {
+      continue;
+    }
+    if (!strcmp(Command, "register"))
+    {
+      continue;
+    }
+    // unknown command
+    fprintf(stdout,"info string Error (unsupported command): %s\n", Command);
+    if (LogFile)
+    {
+      fprintdate(LogFile);
+      fprintf(LogFile,"Error (unsupported command): %s\n", Command);
+    }
+  }
+}
+
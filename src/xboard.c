@@ -30,6 +30,7 @@
 #include "test.h"         // selftest
 #include "timer.h"        // timer functions
 #include "types.h"        // types and defaults and macros 
+#include "uci.h"          // uci protocol command loop
 #include "zeta.h"         // for global vars and functions
 
 // xboard flags
@@ -39,6 +40,8 @@ bool xboard_post    = false;  // post search thinking output
 bool xboard_san     = false;  // use san move notation instead of can
 bool xboard_time    = false;  // use xboards time command for time management
 bool xboard_debug   = false;  // print debug information
+bool xboard_ponder  = false;  // think on opponent's time
+bool xboard_analyze = false;  // analysis mode, search until input arrives
 
 // xboard protocol command loop, ugly but works
 void xboard(void) {
@@ -46,6 +49,14 @@ void xboard(void) {
   s32 xboard_protover = 0;      // works only with protocoll version >= v2
   bool state = false;
 
+  // read stdin in own thread, to handle input while device searches
+  state = input_start();
+  // something went wrong...
+  if (!state)
+  {
+    quitengine(EXIT_FAILURE);
+  }
+
   // input loop
   for (;;)
   {
@@ -53,8 +64,43 @@ void xboard(void) {
     fflush (stdout);
     if (LogFile)
       fflush (LogFile);
+    // analysis, stream finished depths until input arrives
+    if (xboard_analyze)
+    {
+      state = analysisstart(BOARD, STM);
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+      while (!input_pollline(Line))
+      {
+        state = analysisstep();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        sleep_ms(1);
+      }
+    }
+    // pondering, post finished depths until input arrives
+    else if (pondering)
+    {
+      while (!input_pollline(Line))
+      {
+        state = ponderstep();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        sleep_ms(1);
+      }
+    }
     // get Line
-    if (!fgets (Line, 1023, stdin)) {}
+    else
+      input_getline(Line);
     // ignore empty Lines
     if (Line[0] == '\n')
       continue;
@@ -66,6 +112,37 @@ void xboard(void) {
     }
     // get command
     sscanf (Line, "%s", Command);
+    // stop analysis on any command but status, restarted on next input
+    if (xboard_analyze&&strcmp(Command, "."))
+    {
+      state = analysisstop();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+    }
+    // stop background search, unless a ponder hit is still possible
+    if (pondering
+        &&strcmp(Command, "usermove")
+        &&strcmp(Command, "time")
+        &&strcmp(Command, "otim")
+        &&strcmp(Command, "ping")
+        &&strcmp(Command, "hard"))
+    {
+      state = ponderstop();
+      // something went wrong...
+      if (!state)
+      {
+        quitengine(EXIT_FAILURE);
+      }
+    }
+    // switch to uci protocol, uci command loop runs until quit
+    if (!xboard_mode && !strcmp(Command, "uci"))
+    {
+      uci();
+      break;
+    }
     // xboard commands
     // set xboard mode
     if (!strcmp(Command, "xboard"))
@@ -98,14 +175,14 @@ void xboard(void) {
         fprintf(stdout,"feature playother=0\n");
         fprintf(stdout,"feature san=0\n");
         // check feature san accepted 
-        if (!fgets (Line, 1023, stdin)) {}
+        input_getline(Line);
         // get command
         sscanf (Line, "%s", Command);
         if (strstr(Command, "rejected"))
           xboard_san = true;
         fprintf(stdout,"feature usermove=1\n");
         // check feature usermove accepted 
-        if (!fgets (Line, 1023, stdin)) {}
+        input_getline(Line);
         // get command
         sscanf (Line, "%s", Command);
         if (strstr(Command, "rejected"))
@@ -121,7 +198,7 @@ void xboard(void) {
         }
         fprintf(stdout,"feature time=1\n");
         // check feature time accepted 
-        if (!fgets (Line, 1023, stdin)) {}
+        input_getline(Line);
         // get command
         sscanf (Line, "%s", Command);
         if (strstr(Command, "accepted"))
@@ -129,7 +206,7 @@ void xboard(void) {
         fprintf(stdout,"feature draw=0\n");
         fprintf(stdout,"feature sigint=0\n");
         fprintf(stdout,"feature reuse=1\n");
-        fprintf(stdout,"feature analyze=0\n");
+        fprintf(stdout,"feature analyze=1\n");
         fprintf(stdout,"feature variants=\"normal\"\n");
         fprintf(stdout,"feature colors=0\n");
         fprintf(stdout,"feature ics=0\n");
@@ -138,7 +215,7 @@ void xboard(void) {
         fprintf(stdout,"feature nps=0\n");
         fprintf(stdout,"feature debug=1\n");
         // check feature debug accepted 
-        if (!fgets (Line, 1023, stdin)) {}
+        input_getline(Line);
         // get command
         sscanf (Line, "%s", Command);
         if (strstr(Command, "accepted"))
@@ -158,25 +235,31 @@ void xboard(void) {
     // initialize new game
 		if (!strcmp(Command, "new"))
     {
-
-      release_gameinits();
-      state = gameinits();
-      // something went wrong...
-      if (!state)
-      {
-        quitengine(EXIT_FAILURE);
-      }
-      state = cl_release_device();
-      // something went wrong...
+      // reset game state, keep OpenCL context, program and buffers alive
+      resetgameinits();
+      state = cl_reset_device();
+      // device not ready for search, full re-init
       if (!state)
       {
-        quitengine(EXIT_FAILURE);
-      }
-      state = cl_init_device("alphabeta_gpu");
-      // something went wrong...
-      if (!state)
-      {
-        quitengine(EXIT_FAILURE);
+        release_gameinits();
+        state = gameinits();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        state = cl_release_device();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+        state = cl_init_device("alphabeta_gpu");
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
       }
       if (!setboard(BOARD, "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"))
       {
@@ -261,7 +344,8 @@ void xboard(void) {
         }
         else
         {
-          // start thinking
+          // start thinking, keep a move now queued behind the command
+          input_clearmovenow();
           move = rootsearch(BOARD, STM, SD);
 
           // check for root node searched
@@ -332,7 +416,8 @@ void xboard(void) {
               fprintf(LogFile,"\n");
 
             fflush(stdout);
-            fflush(LogFile);
+            if (LogFile)
+              fflush(LogFile);
 
             domove(BOARD, move);
 
@@ -369,6 +454,16 @@ void xboard(void) {
               TimeLeft+= TimeBase;
             // get max nodes to search
             MaxNodes = (u64)(MaxTime/1000*(double)nodes_per_second);
+            // think on expected reply
+            if (xboard_ponder)
+            {
+              state = ponderstart(BOARD, STM, pondermove);
+              // something went wrong...
+              if (!state)
+              {
+                quitengine(EXIT_FAILURE);
+              }
+            }
           }
         }
       }
@@ -493,8 +588,19 @@ void xboard(void) {
       if (!xboard_mode||xboard_debug)
           printboard(BOARD);
 
-      // we are on move
-      if (!xboard_force)
+      // ponder miss, rootsearch takes over background search on hit
+      if (pondering&&(xboard_force||BOARD[QBBHASH]!=ponderhash))
+      {
+        state = ponderstop();
+        // something went wrong...
+        if (!state)
+        {
+          quitengine(EXIT_FAILURE);
+        }
+      }
+
+      // we are on move, not in analysis mode
+      if (!xboard_force&&!xboard_analyze)
       {
         bool kic = squareunderattack(BOARD, !STM, getkingpos(BOARD,STM));
         MOVECOUNT = 0;
@@ -524,7 +630,8 @@ void xboard(void) {
         }
         else
         {
-          // start thinking
+          // start thinking, keep a move now queued behind the command
+          input_clearmovenow();
           move = rootsearch(BOARD, STM, SD);
 
           // check for root node searched
@@ -595,7 +702,8 @@ void xboard(void) {
               fprintf(LogFile,"\n");
 
             fflush(stdout);
-            fflush(LogFile);
+            if (LogFile)
+              fflush(LogFile);
 
             domove(BOARD, move);
 
@@ -632,6 +740,16 @@ void xboard(void) {
               TimeLeft+= TimeBase;
             // get max nodes to search
             MaxNodes = (u64)(MaxTime/1000*(double)nodes_per_second);
+            // think on expected reply
+            if (xboard_ponder)
+            {
+              state = ponderstart(BOARD, STM, pondermove);
+              // something went wrong...
+              if (!state)
+              {
+                quitengine(EXIT_FAILURE);
+              }
+            }
           }
         }
       }
@@ -723,12 +841,40 @@ void xboard(void) {
     {
       continue;
     }
+    // enter analysis mode, search starts before next input is read
+		if (!strcmp(Command, "analyze"))
+    {
+      xboard_analyze = true;
+      continue;
+    }
+    // leave analysis mode, search is already stopped
+		if (!strcmp(Command, "exit"))
+    {
+      xboard_analyze = false;
+      continue;
+    }
+    // analysis status update
+		if (!strcmp(Command, "."))
+    {
+      analysisstatus();
+      continue;
+    }
+    // move now, running search was stopped by input thread
+		if (!strcmp(Command, "?"))
+    {
+      MOVENOW = false;
+      continue;
+    }
+    // turn on pondering
 		if (!strcmp(Command, "hard"))
     {
+      xboard_ponder = true;
       continue;
     }
+    // turn off pondering, background search is already stopped
 		if (!strcmp(Command, "easy"))
     {
+      xboard_ponder = false;
       continue;
     }
 		if (!strcmp(Command, "name"))
@@ -814,7 +960,8 @@ void xboard(void) {
       }
 
       fflush(stdout);
-      fflush(LogFile);
+      if (LogFile)
+        fflush(LogFile);
   
       continue;
     }
@@ -827,11 +974,25 @@ void xboard(void) {
       double *timearr = (double *)calloc(threadsX*threadsY, sizeof (double));
       u64 *workerssarr = (u64 *)calloc(threadsX*threadsY, sizeof (u64));
       u64 *npsarr = (u64 *)calloc(threadsX*threadsY, sizeof (u64));
+      // root split results, same worker counts
+      double *timearrsplit = (double *)calloc(threadsX*threadsY, sizeof (double));
+      u64 *npsarrsplit = (u64 *)calloc(threadsX*threadsY, sizeof (u64));
+      // hybrid results, device plus host helper threads, same worker counts
+      s32 helpers = cpu_helpers;
+      double *timearrhybrid = (double *)calloc(threadsX*threadsY, sizeof (double));
+      u64 *npsarrhybrid = (u64 *)calloc(threadsX*threadsY, sizeof (u64));
+      // unified TT results, abdada lock inside TT1, same worker counts
+      s32 unified = tt_unified;
+      double *timearrunified = (double *)calloc(threadsX*threadsY, sizeof (double));
+      u64 *npsarrunified = (u64 *)calloc(threadsX*threadsY, sizeof (u64));
+      // generic kernel build results, no session constants as build options
+      double *timearrgeneric = (double *)calloc(threadsX*threadsY, sizeof (double));
+      u64 *npsarrgeneric = (u64 *)calloc(threadsX*threadsY, sizeof (u64));
 
       ABNODECOUNT = 0;
       MOVECOUNT = 0;
 
-//      state = cl_run_alphabeta(STM, 0, 1);
+//      state = cl_run_alphabeta(STM, 0, 1, -INF, INF, false);
 
       threadsX = 1;
       threadsY = 1;
@@ -843,57 +1004,93 @@ void xboard(void) {
 //        while(true)
 //        {
 
-          fprintf(stdout,"### doing inits for benchsmp depth %d: ###\n", SD);  
-          if (LogFile)
+          // current scheme first, then root split, then hybrid, then
+          // unified TT, then generic kernel build, same inits
+          for (int split=0;split<=4;split++)
           {
-            fprintdate(LogFile);
-            fprintf(LogFile,"### doing inits for benchsmp depth %d: ###\n", SD);  
-          }
+            if ((split==2&&helpers==0)||(split==3&&!unified)||(split==4&&cpu_threads>0))
+              continue;
+            root_split = (split==1)?1:0;
+            cpu_helpers = (split==2)?helpers:0;
+            tt_unified = (split==3)?unified:0;
+            opencl_specialize = (split==4)?false:true;
+
+            fprintf(stdout,"### doing inits for benchsmp depth %d: ###\n", SD);  
+            if (LogFile)
+            {
+              fprintdate(LogFile);
+              fprintf(LogFile,"### doing inits for benchsmp depth %d: ###\n", SD);  
+            }
 
-          totalWorkUnits = threadsX*threadsY;
+            totalWorkUnits = threadsX*threadsY;
 
-          release_gameinits();
-          state = gameinits();
-          // something went wrong...
-          if (!state)
-          {
-            quitengine(EXIT_FAILURE);
-          }
-          state = cl_release_device();
-          // something went wrong...
-          if (!state)
-          {
-            quitengine(EXIT_FAILURE);
-          }
-          state = cl_init_device("alphabeta_gpu");
-          // something went wrong...
-          if (!state)
-          {
-            quitengine(EXIT_FAILURE);
-          }
+            release_gameinits();
+            state = gameinits();
+            // something went wrong...
+            if (!state)
+            {
+              quitengine(EXIT_FAILURE);
+            }
+            state = cl_release_device();
+            // something went wrong...
+            if (!state)
+            {
+              quitengine(EXIT_FAILURE);
+            }
+            state = cl_init_device("alphabeta_gpu");
+            // something went wrong...
+            if (!state)
+            {
+              quitengine(EXIT_FAILURE);
+            }
 
-          fprintf(stdout,"### computing benchsmp depth %d: ###\n", SD);  
-          fprintf(stdout,"### work-groups: %" PRIu64 " ###\n", threadsX*threadsY);  
-          if (LogFile)
-          {
-            fprintdate(LogFile);
-            fprintf(LogFile,"### computing benchsmp depth %d: ###\n", SD);  
-            fprintdate(LogFile);
-            fprintf(LogFile,"### work-groups: %" PRIu64 " ###\n", threadsX*threadsY);  
-          }
+            fprintf(stdout,"### computing benchsmp depth %d%s: ###\n", SD, (root_split)?" root split":(cpu_helpers>0)?" hybrid":(tt_unified)?" unified tt":(!opencl_specialize)?" generic build":"");  
+            fprintf(stdout,"### work-groups: %" PRIu64 " ###\n", threadsX*threadsY);  
+            if (LogFile)
+            {
+              fprintdate(LogFile);
+              fprintf(LogFile,"### computing benchsmp depth %d%s: ###\n", SD, (root_split)?" root split":(cpu_helpers>0)?" hybrid":(tt_unified)?" unified tt":(!opencl_specialize)?" generic build":"");  
+              fprintdate(LogFile);
+              fprintf(LogFile,"### work-groups: %" PRIu64 " ###\n", threadsX*threadsY);  
+            }
 
-          start = get_time();
+            start = get_time();
          
-          rootsearch(BOARD, STM, SD);
+            input_clearmovenow();
+            rootsearch(BOARD, STM, SD);
 
-          end = get_time();   
-          elapsed = end-start;
-          elapsed += 1;
-          elapsed/=1000;
+            end = get_time();   
+            elapsed = end-start;
+            elapsed += 1;
+            elapsed/=1000;
 
-          // collect results
-          timearr[iter] = elapsed;
-          npsarr[iter] = (u64)((double)ABNODECOUNT/elapsed);
+            // collect results, hybrid nps counts host helper nodes too
+            if (split==4)
+            {
+              timearrgeneric[iter] = elapsed;
+              npsarrgeneric[iter] = (u64)((double)ABNODECOUNT/elapsed);
+            }
+            else if (split==3)
+            {
+              timearrunified[iter] = elapsed;
+              npsarrunified[iter] = (u64)((double)ABNODECOUNT/elapsed);
+            }
+            else if (split==2)
+            {
+              timearrhybrid[iter] = elapsed;
+              npsarrhybrid[iter] = (u64)((double)(ABNODECOUNT+HELPERNODECOUNT)/elapsed);
+            }
+            else if (split)
+            {
+              timearrsplit[iter] = elapsed;
+              npsarrsplit[iter] = (u64)((double)ABNODECOUNT/elapsed);
+            }
+            else
+            {
+              timearr[iter] = elapsed;
+              npsarr[iter] = (u64)((double)ABNODECOUNT/elapsed);
+            }
+          }
           workerssarr[iter] = threadsX*threadsY;
 
           iter++;
@@ -939,6 +1136,92 @@ void xboard(void) {
           fprintf(LogFile,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarr[i], (double)npsarr[i]/(double)npsarr[0], timearr[i], timearr[0]/timearr[i], timearr[i-1]/timearr[i]);
         }
       }
+      // root split against current scheme, speedups relative to 1 worker
+      fprintf(stdout,"### root split\n");
+      fprintf(stdout,"### workers\t#nps\t\t#nps speedup\t#time in s\t#ttd speedup \t#ttd vs current ###\n");
+      if (LogFile)
+      {
+        fprintdate(LogFile);
+        fprintf(LogFile,"### root split\n");
+        fprintdate(LogFile);
+        fprintf(LogFile,"### workers\t#nps\t\t#nps speedup\t#time in s\t#ttd speedup\t#ttd vs current ###\n");
+      }
+      for (int i=0;i<iter;i++)
+      {
+        fprintf(stdout,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrsplit[i], (double)npsarrsplit[i]/(double)npsarr[0], timearrsplit[i], timearr[0]/timearrsplit[i], timearr[i]/timearrsplit[i]);
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrsplit[i], (double)npsarrsplit[i]/(double)npsarr[0], timearrsplit[i], timearr[0]/timearrsplit[i], timearr[i]/timearrsplit[i]);
+        }
+      }
+      // hybrid against device only, speedups relative to 1 worker
+      if (helpers>0)
+      {
+        fprintf(stdout,"### hybrid, %d host helper threads\n", helpers);
+        fprintf(stdout,"### workers\t#nps\t\t#nps speedup\t#time in s\t#ttd speedup \t#ttd vs current ###\n");
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"### hybrid, %d host helper threads\n", helpers);
+          fprintdate(LogFile);
+          fprintf(LogFile,"### workers\t#nps\t\t#nps speedup\t#time in s\t#ttd speedup\t#ttd vs current ###\n");
+        }
+        for (int i=0;i<iter;i++)
+        {
+          fprintf(stdout,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrhybrid[i], (double)npsarrhybrid[i]/(double)npsarr[0], timearrhybrid[i], timearr[0]/timearrhybrid[i], timearr[i]/timearrhybrid[i]);
+          if (LogFile)
+          {
+            fprintdate(LogFile);
+            fprintf(LogFile,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrhybrid[i], (double)npsarrhybrid[i]/(double)npsarr[0], timearrhybrid[i], timearr[0]/timearrhybrid[i], timearr[i]/timearrhybrid[i]);
+          }
+        }
+      }
+      // unified TT against two table layout, speedups relative to 1 worker
+      if (unified)
+      {
+        fprintf(stdout,"### unified tt, abdada lock inside TT1\n");
+        fprintf(stdout,"### workers\t#nps\t\t#nps speedup\t#time in s\t#ttd speedup \t#ttd vs current ###\n");
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"### unified tt, abdada lock inside TT1\n");
+          fprintdate(LogFile);
+          fprintf(LogFile,"### workers\t#nps\t\t#nps speedup\t#time in s\t#ttd speedup\t#ttd vs current ###\n");
+        }
+        for (int i=0;i<iter;i++)
+        {
+          fprintf(stdout,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrunified[i], (double)npsarrunified[i]/(double)npsarr[0], timearrunified[i], timearr[0]/timearrunified[i], timearr[i]/timearrunified[i]);
+          if (LogFile)
+          {
+            fprintdate(LogFile);
+            fprintf(LogFile,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrunified[i], (double)npsarrunified[i]/(double)npsarr[0], timearrunified[i], timearr[0]/timearrunified[i], timearr[i]/timearrunified[i]);
+          }
+        }
+      }
+      // specialized against generic kernel build, nps of same worker count
+      if (cpu_threads==0)
+      {
+        fprintf(stdout,"### generic build, session constants as kernel arguments\n");
+        fprintf(stdout,"### workers\t#nps\t\t#nps speedup\t#time in s\t#specialized nps gain\t#ttd vs current ###\n");
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"### generic build, session constants as kernel arguments\n");
+          fprintdate(LogFile);
+          fprintf(LogFile,"### workers\t#nps\t\t#nps speedup\t#time in s\t#specialized nps gain\t#ttd vs current ###\n");
+        }
+        for (int i=0;i<iter;i++)
+        {
+          fprintf(stdout,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrgeneric[i], (double)npsarrgeneric[i]/(double)npsarr[0], timearrgeneric[i], (double)npsarr[i]/(double)((npsarrgeneric[i]>0)?npsarrgeneric[i]:1), timearr[i]/timearrgeneric[i]);
+          if (LogFile)
+          {
+            fprintdate(LogFile);
+            fprintf(LogFile,"### %"PRIu64"\t\t%"PRIu64"\t\t%lf\t%lf\t%lf\t%lf \n",workerssarr[i], npsarrgeneric[i], (double)npsarrgeneric[i]/(double)npsarr[0], timearrgeneric[i], (double)npsarr[i]/(double)((npsarrgeneric[i]>0)?npsarrgeneric[i]:1), timearr[i]/timearrgeneric[i]);
+          }
+        }
+      }
+      opencl_specialize = true;
       //reset 
       release_gameinits();
       state = read_and_init_config(configfile);
@@ -967,7 +1250,8 @@ void xboard(void) {
       }
 
       fflush(stdout);
-      fflush(LogFile);
+      if (LogFile)
+        fflush(LogFile);
   
       continue;
     }
@@ -1088,6 +1372,7 @@ void xboard(void) {
 
             start = get_time();
            
+            input_clearmovenow();
             rootsearch(BOARD, STM, SD);
 
             end = get_time();   
@@ -1195,7 +1480,8 @@ void xboard(void) {
       }
 
       fflush(stdout);
-      fflush(LogFile);
+      if (LogFile)
+        fflush(LogFile);
   
       continue;
     }
@@ -1315,6 +1601,7 @@ void xboard(void) {
 
             start = get_time();
            
+            input_clearmovenow();
             rootsearch(BOARD, STM, SD);
 
             end = get_time();   
@@ -1422,7 +1709,8 @@ void xboard(void) {
       }
 
       fflush(stdout);
-      fflush(LogFile);
+      if (LogFile)
+        fflush(LogFile);
   
       continue;
     }
@@ -1432,6 +1720,53 @@ void xboard(void) {
       selftest();
       continue;
     }
+    // save hash table to file for warm start, tt2 option adds ABDADA table,
+    // in xboard mode too, ponder and analysis were stopped above
+    if (!strcmp(Command, "savett")||!strcmp(Command, "loadtt"))
+    {
+      char ttfile[256] = "";
+      char ttopt[8] = "";
+
+      if (sscanf(Line, "%*s %255s %7s", ttfile, ttopt)<1)
+      {
+        fprintf(stdout,"Error (missing file name): %s\n",Command);
+        continue;
+      }
+
+      start = get_time();
+
+      if (!strcmp(Command, "savett"))
+        state = cl_save_tt(ttfile, (!strcmp(ttopt, "tt2"))?true:false);
+      else
+        state = cl_load_tt(ttfile);
+
+      end = get_time();   
+      elapsed = end-start;
+      elapsed/=1000;
+
+      if (state)
+      {
+        fprintf(stdout,"### %s %s done, seconds: %lf ###\n", Command, ttfile, elapsed);
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"### %s %s done, seconds: %lf ###\n", Command, ttfile, elapsed);
+        }
+      }
+      else
+      {
+        fprintf(stdout,"Error (%s failed): %s\n", Command, ttfile);
+        if (LogFile)
+        {
+          fprintdate(LogFile);
+          fprintf(LogFile,"Error (%s failed): %s\n", Command, ttfile);
+        }
+      }
+      fflush(stdout);
+      if (LogFile)
+        fflush(LogFile);
+      continue;
+    }
     // print help
     if (!xboard_mode && !strcmp(Command, "help"))
     {
@@ -1474,7 +1809,6 @@ void xboard(void) {
       continue;
     }
 		if (
-        !strcmp(Command, "analyze")||
         !strcmp(Command, "pause")||
         !strcmp(Command, "resume")
         )
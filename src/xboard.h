@@ -29,6 +29,7 @@ extern bool xboard_post;
 extern bool xboard_san;
 extern bool xboard_time;
 extern bool xboard_debug;
+extern bool xboard_ponder;
 
 void xboard();                 // xboard protocol command loop
 
@@ -21,6 +21,7 @@
 
 #include <stdio.h>        // for print and scan
 #include <stdlib.h>       // for malloc free
+#include <string.h>       // for memset
 #include <getopt.h>       // for getopt_long
 
 #include "bit.h"          // bit functions
@@ -49,7 +50,12 @@ bool logtoggle = false;       // turn logging on/off
 u64 ABNODECOUNT         = 0;
 u64 TTHITS              = 0;
 u64 TTSCOREHITS         = 0;
+u64 TTPROBES            = 0; // tt loads, for hit rates
+u64 TTPROBEHITS         = 0; // tt loads of stored positions
 u64 IIDHITS             = 0;
+u64 TTFILLS             = 0; // stores into empty tt slots, current search
+u64 TTFILLSTOTAL        = 0; // stores into empty tt slots, since tt reset
+u64 HELPERNODECOUNT     = 0; // nodes of host helper threads, current search
 u64 MOVECOUNT           = 0;
 // config file
 char configfile[256] = "config.txt";
@@ -69,11 +75,29 @@ s32 opencl_user_platform= -1;
 s32 opencl_gpugen       =  0;
 // further config
 s32 search_depth        =  0;
+s32 slice_ms            =  0; // time slice per kernel launch in ms, 0 = off
+s32 opencl_profiling    =  0; // command queue profiling, 0 = off
+s32 opencl_zerocopy     =  0; // stop flag and progress via mapped buffers
+s32 persistent_search   =  0; // iterative deepening on device, 0 = off
+s32 multipv             =  1; // number of reported root move lines
+s32 root_split          =  0; // hand out root moves via global work queue
+s32 cpu_threads         =  0; // native CPU search threads, 0 = OpenCL device
+s32 cpu_helpers         =  0; // host helper threads of OpenCL device search
+s32 tt_buckets          =  0; // TT1 as 64 byte buckets of entries, 0 = flat
+s32 tt2_compact         =  0; // TT2 as packed 64 bit ABDADA entries
+s32 tt_unified          =  0; // ABDADA lock inside TT1 entries, no TT2
+char opencl_options[256]= ""; // additional OpenCL build options
+bool opencl_specialize  = true; // session constants as build options
 // timers
 double start        = 0;
 double end          = 0;
 double elapsed      = 0;
+double hostoverhead = 0;  // host time in OpenCL enqueue calls and read sync, in ms
+// OpenCL profiling of last iteration, in ms per command type and interval
+double clprofile[PROFTYPES][PROFSTAGES];
+u64 clprofilecount[PROFTYPES];
 bool TIMEOUT        = false;  // global value for time control*/
+volatile bool MOVENOW = false;  // move now via ?, set by input thread
 // time control in milli-seconds
 s32 timemode    = 0;      // 0 = single move, 1 = conventional clock, 2 = ics
 s32 MovesLeft   = 1;      // moves left unit nex time increase
@@ -88,6 +112,10 @@ bool STM        = WHITE;  // site to move
 s32 SD          = MAXPLY; // max search depth*/
 s32 GAMEPLY     = 0;      // total ply, considering depth via fen string
 s32 PLY         = 0;      // engine specifix ply counter
+// pondering
+bool pondering  = false;  // background search on expected reply is running
+Move pondermove = MOVENONE; // expected reply, from pv of last search
+Hash ponderhash = HASHNONE; // position of background search
 // game history
 Move *MoveHistory;
 Hash *HashHistory;
@@ -108,17 +136,12 @@ Bitboard BOARD[7];
 */
 // for exchange with OpenCL device
 Bitboard *GLOBAL_BOARD = NULL;
-TTE *TT1ZEROED = NULL;
-ABDADATTE *TT2ZEROED = NULL;
-//TTE *TT3ZEROED = NULL;
 u64 *COUNTERS = NULL;
 u32 *RNUMBERS = NULL;
 u64 *COUNTERSZEROED = NULL;
 Move *PV = NULL;
 Move *PVZEROED = NULL;
-TTMove *KILLERZEROED = NULL;
-TTMove *COUNTERZEROED = NULL;
-Hash *GLOBAL_HASHHISTORY = NULL;
+Bitboard ROOTEXCLUDE[MULTIPVSIZE]; // multipv, root moves excluded from search
 // OpenCL memory buffer objects
 cl_mem   GLOBAL_BOARD_Buffer = NULL;
 cl_mem   GLOBAL_globalbbMoves1_Buffer = NULL;
@@ -136,12 +159,23 @@ cl_mem   GLOBAL_Killer_Buffer = NULL;
 cl_mem   GLOBAL_Counter_Buffer = NULL;
 cl_mem   GLOBAL_RScore_Buffer = NULL;
 cl_mem   GLOBAL_finito_Buffer = NULL;
+cl_mem   GLOBAL_stop_Buffer = NULL;
+cl_mem   GLOBAL_Checkpoint_Buffer = NULL;
+cl_mem   GLOBAL_slicecount_Buffer = NULL;
+cl_mem   GLOBAL_Progress_Buffer = NULL;
+cl_mem   GLOBAL_RootExclude_Buffer = NULL;
+cl_mem   GLOBAL_RootSplit_Buffer = NULL;
+cl_mem   GLOBAL_Merge_Buffer = NULL;
+cl_mem   GLOBAL_Sample_Buffer = NULL;
 // OpenCL runtime objects
 cl_context          context = NULL;
 cl_device_id        *devices = NULL;
 cl_command_queue    commandQueue = NULL;
 cl_program          program = NULL;
 cl_kernel           kernel = NULL;
+cl_kernel           clearkernel = NULL;
+cl_kernel           mergekernel = NULL;
+cl_kernel           samplekernel = NULL;
 // for OpenCL config
 cl_uint numPlatforms;
 cl_platform_id platform;
@@ -276,75 +310,7 @@ bool gameinits(void)
     }
     return false;
   }
-  KILLERZEROED = (Move*)calloc(totalWorkUnits*MAXPLY, sizeof(Move));
-  if (KILLERZEROED==NULL)
-  {
-    fprintf(stdout, "memory alloc, KILLERZEROED, failed\n");
-    if (LogFile)
-    {
-      fprintdate(LogFile);
-      fprintf(LogFile, "memory alloc, KILLERZEROED, failed\n");
-    }
-    return false;
-  }
-  COUNTERZEROED = (Move*)calloc(totalWorkUnits*64*64, sizeof(Move));
-  if (COUNTERZEROED==NULL)
-  {
-    fprintf(stdout, "memory alloc, COUNTERZEROED, failed\n");
-    if (LogFile)
-    {
-      fprintdate(LogFile);
-      fprintf(LogFile, "memory alloc, COUNTERZEROED, failed\n");
-    }
-    return false;
-  }
-  GLOBAL_HASHHISTORY = (Hash*)calloc(totalWorkUnits*MAXGAMEPLY , sizeof(Hash));
-  if (GLOBAL_HASHHISTORY==NULL)
-  {
-    fprintf(stdout, "memory alloc, GLOBAL_HASHHISTORY, failed\n");
-    if (LogFile)
-    {
-      fprintdate(LogFile);
-      fprintf(LogFile, "memory alloc, GLOBAL_HASHHISTORY, failed\n");
-    }
-    return false;
-  }
-  // initialize transposition table, TT1
-  u64 mem = (tt1_memory*1024*1024)/(sizeof(TTE));
-  u64 ttbits = 0;
-  if (tt1_memory>0)
-  {
-    while ( mem >>= 1)   // get msb
-      ttbits++;
-    mem = 1ULL<<ttbits;   // get number of tt entries
-    ttbits=mem;
-  }
-  else
-    mem = 1;
-  TT1ZEROED = (TTE*)calloc(mem,sizeof(TTE));
-  if (TT1ZEROED==NULL)
-  {
-    fprintf(stdout,"Error (tt1 hash table memory allocation on cpu, %" PRIu64 " mb, failed): memory\n", tt1_memory);
-    return false;
-  }
-  // initialize abdada transposition table, TT2
-  mem = (tt2_memory*1024*1024)/(sizeof(ABDADATTE));
-  ttbits = 0;
-  if (tt2_memory>0)
-  {
-    while ( mem >>= 1)   // get msb
-      ttbits++;
-    mem = 1ULL<<ttbits;   // get number of tt entries
-    ttbits=mem;
-  }
-  else
-    mem = 1;
-  TT2ZEROED = (ABDADATTE*)calloc(mem,sizeof(ABDADATTE));
-  if (TT2ZEROED==NULL)
-  {
-    fprintf(stdout,"Error (tt2 hash table memory allocation on cpu, %" PRIu64 " mb, failed): memory\n", tt2_memory);
-    return false;
-  }
+  // device tables TT1, TT2, Killer and Counter are zeroed on device
 /*
   // initialize transposition table, TT3
   mem = (tt3_memory*1024*1024)/(sizeof(TTE));
@@ -367,6 +333,17 @@ bool gameinits(void)
 */
   return true;
 }
+// reset game state for a new game, keeps allocated memory
+void resetgameinits(void)
+{
+  memset(MoveHistory, 0, MAXGAMEPLY*sizeof(Move));
+  memset(HashHistory, 0, MAXGAMEPLY*sizeof(Hash));
+  memset(CRHistory, 0, MAXGAMEPLY*sizeof(Cr));
+  memset(HMCHistory, 0, MAXGAMEPLY*sizeof(Bitboard));
+  memset(COUNTERS, 0, totalWorkUnits*threadsZ*sizeof(u64));
+  memset(PV, 0, MAXPLY*sizeof(Move));
+  TTFILLSTOTAL = 0;
+}
 void release_gameinits()
 {
   // release memory
@@ -381,11 +358,6 @@ void release_gameinits()
   free(COUNTERSZEROED);
   free(PV);
   free(PVZEROED);
-  free(KILLERZEROED);
-  free(COUNTERZEROED);
-  free(GLOBAL_HASHHISTORY);
-  free(TT1ZEROED);
-  free(TT2ZEROED);
 }
 void release_configinits()
 {
@@ -476,6 +448,7 @@ void print_help(void)
   fprintf(stdout,"\n");
   fprintf(stdout,"To play against the engine use an CECP v2 aka. xboard protocol capable chess GUI\n");
   fprintf(stdout,"like Arena, Cutechess, Winboard or Xboard.\n");
+  fprintf(stdout,"UCI capable GUIs are supported too, via the uci command.\n");
   fprintf(stdout,"\n");
   fprintf(stdout,"Alternatively you can use Xboard commmands directly on commmand Line,\n"); 
   fprintf(stdout,"e.g.:\n");
@@ -484,15 +457,16 @@ void print_help(void)
   fprintf(stdout,"go             // let engine play site to move\n");
   fprintf(stdout,"usermove d7d5  // let engine apply usermove in coordinate algebraic\n");
   fprintf(stdout,"               // notation and optionally start thinking\n");
+  fprintf(stdout,"analyze        // analyze position until exit, moves and setboard are\n");
+  fprintf(stdout,"               // applied and analysis restarts, . prints status\n");
+  fprintf(stdout,"?              // move now\n");
+  fprintf(stdout,"hard/easy      // turn on/off pondering\n");
   fprintf(stdout,"\n");
   fprintf(stdout,"The implemented Time Control is a bit shacky, tuned for 40 moves in 4 minutes\n");
   fprintf(stdout,"\n");
   fprintf(stdout,"\n");
   fprintf(stdout,"Not supported Xboard commands:\n");
-  fprintf(stdout,"analyze        // enter analyze mode\n");
-  fprintf(stdout,"?              // move now\n");
   fprintf(stdout,"draw           // handle draw offers\n");
-  fprintf(stdout,"hard/easy      // turn on/off pondering\n");
   fprintf(stdout,"hint           // give user a hint move\n");
   fprintf(stdout,"bk             // book lines\n");
   fprintf(stdout,"\n");
@@ -502,9 +476,13 @@ void print_help(void)
   fprintf(stdout,"help           // print usage info\n");
   fprintf(stdout,"log            // turn log on/of\n");
   fprintf(stdout,"benchsmp       // init with new and sd and st commands\n");
-  fprintf(stdout,"               // runs an benchmark for parallel speedup\n");
+  fprintf(stdout,"               // runs an benchmark for parallel speedup, compares\n");
+  fprintf(stdout,"               // specialized and generic kernel builds too\n");
   fprintf(stdout,"benchhyatt24   // init with sd and st commands\n");
   fprintf(stdout,"               // runs an smp benchmark on Hyatt24 positions\n");
+  fprintf(stdout,"savett file    // save hash table to file, savett file tt2 adds\n");
+  fprintf(stdout,"               // ABDADA table, new clears hash table\n");
+  fprintf(stdout,"loadtt file    // load hash table from file, same config needed\n");
   fprintf(stdout,"\n");
   fprintf(stdout,"################################################################################\n");
   fprintf(stdout,"### Options\n");
@@ -692,7 +670,7 @@ int main(int argc, char* argv[])
   {
     quitengine(EXIT_FAILURE);
   }
-  if (!cl_run_alphabeta(STM, 0, 1))
+  if (!cl_run_alphabeta(STM, 0, 1, -INF, INF, false))
   {
     quitengine(EXIT_FAILURE);
   }
@@ -29,14 +29,27 @@
 // 3rd generation gpgpu devices
 // for collecting bbAttacks and Hash
 #pragma OPENCL EXTENSION cl_khr_int64_extended_atomics            : enable
+// for packed abdada entries, set by host build option TT2COMPACT
+#ifdef TT2COMPACT
+#pragma OPENCL EXTENSION cl_khr_int64_base_atomics                : enable
+#endif
 // otpional
 //#pragma OPENCL EXTENSION cl_khr_byte_addressable_store          : enable
 // hack for nvidia OpenCL 1.0 devices
 #if __OPENCL_VERSION__ < 110
 #define OLDSCHOOL
 #endif
+// device generation set by host build options, restrict atomics path
+#if defined GPUGEN && GPUGEN < 3
+#undef cl_khr_int64_extended_atomics
+#endif
+#if defined GPUGEN && GPUGEN < 2
+#undef cl_khr_local_int32_base_atomics
+#undef cl_khr_local_int32_extended_atomics
+#endif
 
 typedef ulong   u64;
+typedef long    s64;
 typedef uint    u32;
 typedef int     s32;
 typedef short   s16;
@@ -63,7 +76,45 @@ typedef struct
   u8 flag;
   u8 depth;
 } TTE;
+// abdada lock inside TT1 entry instead of TT2, set by host build option
+#ifndef TTUNIFIED
+#define TTUNIFIED 0
+#endif
+#if TTUNIFIED
+// unified TT1 entry, same size as TTE, upper half of hash as key, lower half
+// is the index, abdada generation upper and owner lower 16 bits of lock,
+// lock updated via 32 bit atomics, stores keep lock, consider also types.h
+typedef struct
+{
+  u32 hash;
+  TTMove bestmove;
+  TTScore score;
+  u8 flag;
+  u8 depth;
+  u32 lock;
+} TT1E;
+#define TTKEY(hash,move,score,depth) \
+((u32)(((hash)>>32)^(Hash)(move)^(Hash)(score)^(Hash)(depth)))
+#else
+typedef TTE TT1E;
+#define TTKEY(hash,move,score,depth) \
+((hash)^(Hash)(move)^(Hash)(score)^(Hash)(depth))
+#endif
 // abdada transposition table entry
+#ifdef TT2COMPACT
+// packed into one 64 bit word, updated via one 64 bit atomic,
+// key 16 bits, lock 16 bits, search generation 8 bits,
+// score 16 bits, depth 8 bits, consider also types.h file
+typedef u64 ABDADATTE;
+#define TT2KEY(e)     ((u32)((e)>>48))
+#define TT2LOCK(e)    ((s32)(((e)>>32)&0xFFFF))
+#define TT2GEN(e)     ((u32)(((e)>>24)&0xFF))
+#define TT2SCORE(e)   ((Score)(TTScore)(((e)>>8)&0xFFFF))
+#define TT2DEPTH(e)   ((s32)(s8)((e)&0xFF))
+#define TT2PACK(key,lock,gen,score,depth) \
+(((u64)(key)<<48)|(((u64)(lock)&0xFFFF)<<32)|(((u64)(gen)&0xFF)<<24) \
+ |(((u64)(score)&0xFFFF)<<8)|((u64)(depth)&0xFF))
+#else
 typedef struct
 {
   Hash hash;
@@ -73,12 +124,21 @@ typedef struct
   TTScore score;
   s16 depth;
 } ABDADATTE;
-// tunebale search params
+#endif
+// tunebale search params, can be overridden via host build options
+#ifndef LMRR
 #define LMRR            1 // late move reduction 
+#endif
+#ifndef NULLR
 #define NULLR           2 // null move reduction 
+#endif
 #define RANDBRO         1 // how many brothers searched before randomized order
+#ifndef RMO
 #define RMO             false // apply RMO - randomized move order
+#endif
+#ifndef RANDWORKERS
 #define RANDWORKERS     256 // RMO, at how many workers to randomize move order
+#endif
 // TT node type flags
 #define FAILLOW         0
 #define EXACTSCORE      1
@@ -99,6 +159,53 @@ typedef struct
 // ABDADA modes
 #define ITER1          64
 #define ITER2         128
+// time slice checkpoint layout per work-group, in u64, consider also types.h
+#define CPSIZE       1024
+#define CPSTATE         0   // checkpoint state, see below
+#define CPBOARD         1   // 4 x quad bitboard
+#define CPSTM           5
+#define CPSD            6
+#define CPPLY           7
+#define CPBESTMOVE      8
+#define CPBESTSCORE     9
+#define CPHELPER       10   // root split, work-group helps on split points
+#define CPSTACK        16   // 12 stacks of MAXPLY entries
+#define CPPRN         (CPSTACK+12*MAXPLY) // prn per work-item
+#define CPDONE          0   // work-group has finished search
+#define CPSUSPENDED     1   // work-group yielded, resume from stack
+// persistent search progress layout, in u32, consider also types.h
+#define PROGPV          0   // per depth slot, ready flag, score and pv
+#define PROGSLOT       (MAXPLY+1)
+#define PROGCOUNT      (PROGPV+MAXPLY*PROGSLOT) // per depth counter totals
+#define PROGNCOUNT      8   // counter slots 1 to 8, u64 as two u32
+// multipv root move exclusion layout, consider also types.h
+#define MULTIPVCOUNT   64   // per square excluded moves, followed by count
+// root split work queue layout, in u32, consider also types.h
+#define RSCLAIM         0   // per root move key, claiming work-group+1
+#define RSSCORE      4096   // per root move key, min of partial scores+INF+1
+#define RSMOVE       8192   // per root move key, move
+#define RSSLOT      12288   // per root move key, split point+1
+#define RSOPEN      16384   // per root move key, split point state and joins
+#define RSALPHA     20480   // shared root alpha, stored as score+INF
+#define RSDONE      20481   // work-groups finished with root node
+#define RSNSPLIT    20482   // allocated split points
+#define RSNROOT     20483   // claimed root moves
+#define RSSPLIT     20484   // per split point key, movecount, claimed
+#define RSCHILD     (RSSPLIT+MAXSPLIT*4) // per split point child move claims
+#define RSROOT      (RSCHILD+MAXSPLIT*4096) // keys of claimed root moves
+#define MAXSPLIT      128   // max split points per search, at root children only
+// split point state in low bits, joined helpers above, one word so that a
+// join can not pass the close of the split point by its owner
+#define SPWAIT          0   // young brothers wait, first move in search
+#define SPOPEN          1   // helpers may join
+#define SPCLOSED        2   // owner finished, no more joins
+#define SPSTATE         3
+#define SPJOIN          4
+#ifndef SPLITDEPTH
+#define SPLITDEPTH      2   // min depth of root child to become split point
+#endif
+// root split key of move, from*64+to, promotions mapped to distinct to squares
+#define SPLITKEY(mv) ((s32)GETSQFROM(mv)*64+((s32)GETSQTO(mv)^((GETPTYPE(GETPTO(mv))!=GETPTYPE(GETPFROM(mv)))?((s32)GETPTYPE(GETPTO(mv))%5)<<3:0)))
 // defaults
 #define VERSION      "099m"
 // quad bitboard array index definition
@@ -849,6 +956,101 @@ bool squareunderattack(__private Bitboard *board, bool stm, Square sq)
 // alphabeta search on gpu
 // 64 threads in parallel on one chess position
 // move gen with pawn queen promo only
+// session constants, set by host build options, else from kernel arguments
+#ifndef TTINDEX1
+#define TTINDEX1 ttindex1
+#endif
+#ifndef TTINDEX2
+#define TTINDEX2 ttindex2
+#endif
+#ifndef TOTALWORKERS
+#define TOTALWORKERS (get_global_size(0)*get_global_size(1))
+#endif
+// TT1 entries per bucket, 1 = flat table, 4 = one 64 byte bucket per probe
+// set by host build option, consider also types.h file
+#ifndef TTBUCKET
+#define TTBUCKET 1
+#endif
+// TT occupancy samples of sample_tt, s32 used, age and depth of TT1 and TT2
+// per sample, consider also types.h file
+#define TTSAMPLES     4096
+#define TTSAMPLESIZE  6
+// first TT1 entry of bucket of position
+#define TTBUCKETINDEX(hash) ((hash)&(TTINDEX1-TTBUCKET))
+// load entry of position from TT1 bucket, caller checks via xor trick,
+// first entry of bucket if position not present
+TT1E ttload(__global TT1E *TT1, const u64 ttindex1, const Hash hash)
+{
+  const u64 index = TTBUCKETINDEX(hash);
+  TT1E tt1;
+
+  for (s32 i=0;i<TTBUCKET;i++)
+  {
+    tt1 = TT1[index+i];
+    if (tt1.hash==TTKEY(hash,tt1.bestmove,tt1.score,tt1.depth))
+      return tt1;
+  }
+  return TT1[index];
+}
+// save entry to TT1 bucket, over entry of position by depth, score and ply,
+// else over entry of older search, else over entry of lowest depth,
+// returns true on store into empty slot, for hashfull estimate
+bool ttsave(__global TT1E *TT1, const u64 ttindex1, const Hash hash, const TT1E tte, const u8 ttage)
+{
+  const u64 index = TTBUCKETINDEX(hash);
+  u64 slot = index;
+  s32 rank = 0x7FFFFFFF;
+  s32 tmp;
+  bool found = false;
+  TT1E tt1;
+
+  for (s32 i=0;i<TTBUCKET;i++)
+  {
+    tt1 = TT1[index+i];
+    if (tt1.hash==TTKEY(hash,tt1.bestmove,tt1.score,tt1.depth))
+    {
+      slot  = index+i;
+      found = true;
+      break;
+    }
+    tmp = (s32)tt1.depth-((ttage!=(tt1.flag>>2)&&ttage!=(tt1.flag>>2)+2)?256:0);
+    if (tmp<rank)
+    {
+      rank = tmp;
+      slot = index+i;
+    }
+  }
+
+  tt1 = TT1[slot];
+  if (
+       (!found&&TTBUCKET>1)
+       ||
+       (tte.depth>tt1.depth)
+       ||
+       (tte.depth>=tt1.depth
+        &&tt1.hash==TTKEY(hash,tt1.bestmove,tt1.score,tt1.depth)
+        &&tte.score>tt1.score
+       )
+       ||
+       (ttage!=(tt1.flag>>2)
+        &&ttage!=(tt1.flag>>2)+2
+       )
+     )
+  {
+#if TTUNIFIED
+    // keep abdada lock of slot
+    TT1[slot].hash      = tte.hash;
+    TT1[slot].bestmove  = tte.bestmove;
+    TT1[slot].score     = tte.score;
+    TT1[slot].flag      = tte.flag;
+    TT1[slot].depth     = tte.depth;
+#else
+    TT1[slot] = tte;
+#endif
+    return (tt1.hash==0&&tt1.depth==0)?true:false;
+  }
+  return false;
+}
 __kernel void alphabeta_gpu(
                               const __global Bitboard *BOARD,
                                     __global u64 *COUNTERS,
@@ -856,20 +1058,33 @@ __kernel void alphabeta_gpu(
                                     __global Move *PV,
                                     __global Bitboard *globalbbMoves1,
                                     __global Bitboard *globalbbMoves2,
-                                    __global Hash *HashHistory,
+                              const __global Hash *HashHistory,
                               const __global Bitboard *bbInBetween,
                               const __global Bitboard *bbLine,
-                                    __global TTE *TT1,
+                                    __global TT1E *TT1,
                                     __global ABDADATTE *TT2,
                                     __global Move *Killers,
                                     __global Move *Counters,
                                        const s32 stm_init,
                                        const s32 ply_init,
-                                       const s32 search_depth,
+                                       const s32 search_depth_init,
                                        const u64 max_nodes,
                                        const u64 ttindex1,
                                        const u64 ttindex2,
-                                    __global u32 *finito
+                                    __global u32 *finito,
+                           volatile __global u32 *stopflag,
+                                    __global u64 *Checkpoints,
+                                    __global u32 *slicecount,
+                                       const u64 slice_nodes,
+                                       const s32 resume,
+                                    __global u32 *Progress,
+                                       const s32 persistent,
+                                       const s32 alpha_init,
+                                       const s32 beta_init,
+                              const __global Bitboard *RootExclude,
+                                    __global u32 *RootSplit,
+                                       const s32 rootsplit,
+                                       const u32 ttgen_init
 )
 {
   // Quadbitboard
@@ -883,7 +1098,7 @@ __kernel void alphabeta_gpu(
   __local s32 scrTmp64[64];
 #endif
 
-  __local TTE tt1;
+  __local TT1E tt1;
   __local ABDADATTE tt2;
 
   // iterative var stack
@@ -903,6 +1118,10 @@ __kernel void alphabeta_gpu(
   __local bool brandomize;  // randomize move order flag
   __local bool bresearch;   // late move reduction reseach flag
   __local bool bforward;    // late move reduction reseach flag
+  __local bool bsuspend;    // time slice exhausted flag
+  __local bool bsuspended;  // search stack saved to checkpoint flag
+  __local bool bnextdepth;  // persistent search, run next depth flag
+  __local bool bhelper;     // root split, help on split points of others
 
   __local u8 ttage;
 
@@ -941,14 +1160,21 @@ __kernel void alphabeta_gpu(
 
   s32 sd;
   s32 ply;
+  s32 search_depth;
 
   s32 n;
+  s32 splitkey;
+  s32 splitslot;
 
   Score score;
   Score tmpscore;
 
   // pseudo random numbers, seeded on host
   u32 prn = RNUMBERS[gid*64+(s32)lid];
+  // time slice checkpoint of work-group
+  const u64 cp = (u64)gid*CPSIZE;
+  // node counter at launch, for time slice budget
+  const u64 slicestart = COUNTERS[gid*64+1];
 /*
   // xorshift32 PRNG
 	x ^= x << 13;
@@ -971,6 +1197,25 @@ __kernel void alphabeta_gpu(
   Bitboard bbPro;
   Bitboard bbGen; 
 
+  // termination flag and pv output, per depth in persistent search
+  __global u32 *idfinito;
+  __global Move *pvout;
+
+  // multipv, already reported root moves are not searched again
+  const bool rootexclude = (RootExclude[MULTIPVCOUNT]>0)?true:false;
+
+  // persistent search runs iterative deepening on device, else one depth
+  search_depth = (persistent)?1:search_depth_init;
+
+  bhelper = false;
+
+  // ################################
+  // ####  iterative deepening   ####
+  // ################################
+  do {
+  idfinito = (persistent)?&finito[search_depth]:finito;
+  pvout = (persistent)?&Progress[PROGPV+search_depth*PROGSLOT+1]:PV;
+
   // get init quadbitboard plus plus
   board[QBBBLACK] = BOARD[QBBBLACK];
   board[QBBP1]    = BOARD[QBBP1];
@@ -983,10 +1228,12 @@ __kernel void alphabeta_gpu(
   // inits
   bexit           = false;
   bestmove        = MOVENONE;
-  bestscore       = DRAWSCORE;
+  bestscore       = -INF;     // stays -INF if root fails low
   brandomize      = false;
   bresearch       = false;
   bforward        = false;
+  bsuspend        = false;
+  bsuspended      = false;
   ttage           = (u8)ply_init&0x3F;
 
   // init ab search var stack
@@ -1002,8 +1249,8 @@ __kernel void alphabeta_gpu(
   localDepth[0]                   = search_depth+1;
   localNodeStates[0]              = STATENONE | ITER1;
   localSearchMode[0]              = SEARCH;
-  localAlphaBetaScores[sd*2+ALPHA]=-INF;
-  localAlphaBetaScores[sd*2+BETA] = INF;
+  localAlphaBetaScores[sd*2+ALPHA]= alpha_init; // aspiration window
+  localAlphaBetaScores[sd*2+BETA] = beta_init;
   localMoveCounter[sd]            = 0;
   localTodoIndex[sd]              = 0;
   localMoveHistory[sd]            = MOVENONE;
@@ -1015,6 +1262,46 @@ __kernel void alphabeta_gpu(
   localNodeStates[sd]             = STATENONE | ITER1;
   localSearchMode[sd]             = SEARCH;
 
+  // resume search stack from checkpoint of previous time slice
+  // not again when this launch reruns root as helper
+  if (resume&&!bhelper)
+  {
+    // work-group finished in previous slice, nothing to do
+    if (Checkpoints[cp+CPSTATE]!=CPSUSPENDED)
+      return;
+
+    board[QBBBLACK] = Checkpoints[cp+CPBOARD+QBBBLACK];
+    board[QBBP1]    = Checkpoints[cp+CPBOARD+QBBP1];
+    board[QBBP2]    = Checkpoints[cp+CPBOARD+QBBP2];
+    board[QBBP3]    = Checkpoints[cp+CPBOARD+QBBP3];
+    stm             = (bool)Checkpoints[cp+CPSTM];
+    sd              = (s32)Checkpoints[cp+CPSD];
+    ply             = (s32)Checkpoints[cp+CPPLY];
+    prn             = (u32)Checkpoints[cp+CPPRN+(s32)lid];
+
+    for (n=(s32)lid;n<MAXPLY;n+=64)
+    {
+      localNodeStates[n]          = (u8)Checkpoints[cp+CPSTACK+0*MAXPLY+n];
+      localSearchMode[n]          = (u8)Checkpoints[cp+CPSTACK+1*MAXPLY+n];
+      localDepth[n]               = (s32)(s64)Checkpoints[cp+CPSTACK+2*MAXPLY+n];
+      localAlphaBetaScores[n*2+ALPHA] = (Score)(s64)Checkpoints[cp+CPSTACK+3*MAXPLY+n];
+      localAlphaBetaScores[n*2+BETA]  = (Score)(s64)Checkpoints[cp+CPSTACK+4*MAXPLY+n];
+      localTodoIndex[n]           = (s32)(s64)Checkpoints[cp+CPSTACK+5*MAXPLY+n];
+      localMoveCounter[n]         = (s32)(s64)Checkpoints[cp+CPSTACK+6*MAXPLY+n];
+      localMoveHistory[n]         = (Move)Checkpoints[cp+CPSTACK+7*MAXPLY+n];
+      localIIDMoves[n]            = (Move)Checkpoints[cp+CPSTACK+8*MAXPLY+n];
+      localCrHistory[n]           = (Cr)Checkpoints[cp+CPSTACK+9*MAXPLY+n];
+      localHMCHistory[n]          = (u8)Checkpoints[cp+CPSTACK+10*MAXPLY+n];
+      localHashHistory[n]         = (Hash)Checkpoints[cp+CPSTACK+11*MAXPLY+n];
+    }
+    if (lid==0)
+    {
+      bestmove  = (Move)Checkpoints[cp+CPBESTMOVE];
+      bestscore = (Score)(s64)Checkpoints[cp+CPBESTSCORE];
+      bhelper   = (bool)Checkpoints[cp+CPHELPER];
+    }
+  }
+
   barrier(CLK_LOCAL_MEM_FENCE);
   barrier(CLK_GLOBAL_MEM_FENCE);
   // ################################
@@ -1024,6 +1311,43 @@ __kernel void alphabeta_gpu(
   {
     barrier(CLK_LOCAL_MEM_FENCE);
     barrier(CLK_GLOBAL_MEM_FENCE);
+    // time slice exhausted, save search stack to checkpoint and yield
+    if (bsuspend)
+    {
+      for (n=(s32)lid;n<MAXPLY;n+=64)
+      {
+        Checkpoints[cp+CPSTACK+0*MAXPLY+n]  = (u64)localNodeStates[n];
+        Checkpoints[cp+CPSTACK+1*MAXPLY+n]  = (u64)localSearchMode[n];
+        Checkpoints[cp+CPSTACK+2*MAXPLY+n]  = (u64)(s64)localDepth[n];
+        Checkpoints[cp+CPSTACK+3*MAXPLY+n]  = (u64)(s64)localAlphaBetaScores[n*2+ALPHA];
+        Checkpoints[cp+CPSTACK+4*MAXPLY+n]  = (u64)(s64)localAlphaBetaScores[n*2+BETA];
+        Checkpoints[cp+CPSTACK+5*MAXPLY+n]  = (u64)(s64)localTodoIndex[n];
+        Checkpoints[cp+CPSTACK+6*MAXPLY+n]  = (u64)(s64)localMoveCounter[n];
+        Checkpoints[cp+CPSTACK+7*MAXPLY+n]  = (u64)localMoveHistory[n];
+        Checkpoints[cp+CPSTACK+8*MAXPLY+n]  = (u64)localIIDMoves[n];
+        Checkpoints[cp+CPSTACK+9*MAXPLY+n]  = (u64)localCrHistory[n];
+        Checkpoints[cp+CPSTACK+10*MAXPLY+n] = (u64)localHMCHistory[n];
+        Checkpoints[cp+CPSTACK+11*MAXPLY+n] = (u64)localHashHistory[n];
+      }
+      Checkpoints[cp+CPPRN+(s32)lid] = (u64)prn;
+      if (lid==0)
+      {
+        Checkpoints[cp+CPBOARD+QBBBLACK]  = board[QBBBLACK];
+        Checkpoints[cp+CPBOARD+QBBP1]     = board[QBBP1];
+        Checkpoints[cp+CPBOARD+QBBP2]     = board[QBBP2];
+        Checkpoints[cp+CPBOARD+QBBP3]     = board[QBBP3];
+        Checkpoints[cp+CPSTM]             = (u64)stm;
+        Checkpoints[cp+CPSD]              = (u64)sd;
+        Checkpoints[cp+CPPLY]             = (u64)ply;
+        Checkpoints[cp+CPBESTMOVE]        = (u64)bestmove;
+        Checkpoints[cp+CPBESTSCORE]       = (u64)(s64)bestscore;
+        Checkpoints[cp+CPHELPER]          = (u64)bhelper;
+        bsuspended = true;
+        atom_inc(slicecount);
+      }
+      barrier(CLK_LOCAL_MEM_FENCE);
+      break;
+    }
     // reset vars
     brandomize  = false;
     bresearch   = false;
@@ -1453,6 +1777,9 @@ __kernel void alphabeta_gpu(
     // store move
     bbMoves |= (tmpb&&bbTemp&&!bbMask&&!bbWork)?SETMASKBB(lid+2):BBEMPTY;
 
+    // multipv, exclude root moves of previous lines
+    bbMoves &= (rootexclude&&sd==1)?~RootExclude[lid]:BBFULL;
+
     // store move bitboards in global memory for movepicker
     globalbbMoves1[gid*MAXPLY*64+sd*64+(s32)lid] = bbMoves;
     globalbbMoves2[gid*MAXPLY*64+sd*64+(s32)lid] = BBEMPTY;
@@ -1558,6 +1885,7 @@ __kernel void alphabeta_gpu(
       score = (!qs&&!rootkic&&movecount==0)?STALEMATESCORE:score;
 
       // draw by 3 fold repetition, x1
+      // in-search positions from local history, game positions from shared
       bbWork = localHashHistory[sd];
       for (n=ply+ply_init-2;
                             lid==0
@@ -1568,7 +1896,8 @@ __kernel void alphabeta_gpu(
                             &&n>=ply+ply_init-(s32)localHMCHistory[sd];
                                                                        n-=2)
       {
-        if (bbWork==HashHistory[gid*MAXGAMEPLY+n])
+        if (bbWork==((n>=ply_init)?localHashHistory[n-ply_init+1]
+                                  :HashHistory[n]))
         {
           movecount = 0;
           score = DRAWSCORE;
@@ -1596,6 +1925,90 @@ __kernel void alphabeta_gpu(
       // terminal or leaf node
       if (movecount==0)
         localAlphaBetaScores[sd*2+ALPHA]=score;
+      // root split, claim root move, moves of other work-groups are skipped
+      if (rootsplit&&sd==2)
+      {
+        move = localMoveHistory[sd-1];
+        splitkey = SPLITKEY(move);
+        splitslot = (s32)atom_cmpxchg(&RootSplit[RSSLOT+splitkey],0,0);
+        n = (bhelper)?0:(s32)atom_cmpxchg(&RootSplit[RSCLAIM+splitkey], 0, (u32)gid+1);
+        // owner, publish move and allocate split point for young brothers
+        if (!bhelper&&n==0)
+        {
+          RootSplit[RSMOVE+splitkey] = move;
+          // root move list for the reduce at search end
+          n = (s32)atom_inc(&RootSplit[RSNROOT]);
+          if (n<MAXMOVES)
+            RootSplit[RSROOT+n] = (u32)splitkey;
+          n = 0;
+          if (splitslot==0&&movecount>1&&localDepth[sd]>=SPLITDEPTH)
+          {
+            splitslot = (s32)atom_inc(&RootSplit[RSNSPLIT]);
+            if (splitslot<MAXSPLIT)
+            {
+              RootSplit[RSSPLIT+splitslot*4]   = (u32)splitkey;
+              RootSplit[RSSPLIT+splitslot*4+1] = (u32)movecount;
+              atom_xchg(&RootSplit[RSSLOT+splitkey],(u32)splitslot+1);
+            }
+          }
+        }
+        // helper, join open split point with unclaimed moves left,
+        // count join only while open, atomic against close by owner
+        if (bhelper)
+        {
+          n = 0;
+          if (splitslot>0
+              &&atom_cmpxchg(&RootSplit[RSSPLIT+(splitslot-1)*4+2],0,0)
+                <atom_cmpxchg(&RootSplit[RSSPLIT+(splitslot-1)*4+1],0,0)
+             )
+          {
+            tmpscore = (s32)atom_cmpxchg(&RootSplit[RSOPEN+splitkey],0,0);
+            if ((tmpscore&SPSTATE)==SPOPEN
+                &&atom_cmpxchg(&RootSplit[RSOPEN+splitkey],(u32)tmpscore,(u32)tmpscore+SPJOIN)==(u32)tmpscore)
+              n = gid+1;
+          }
+        }
+        if (n!=gid+1&&(n!=0||bhelper))
+        {
+          movecount = 0;
+          localAlphaBetaScores[sd*2+ALPHA] = INF; // ignore score
+        }
+        else
+        {
+          // load shared root alpha, narrow window of child
+          score = (Score)((s32)atom_cmpxchg(&RootSplit[RSALPHA],0,0)-INF);
+          if (score>localAlphaBetaScores[(sd-1)*2+ALPHA])
+          {
+            localAlphaBetaScores[(sd-1)*2+ALPHA] = score;
+            localAlphaBetaScores[sd*2+BETA] = min(localAlphaBetaScores[sd*2+BETA],-score);
+          }
+        }
+      }
+      // root split, claim move of split point, not in iid pass of split point
+      if (rootsplit
+          &&sd==3
+          &&localMoveHistory[sd-1]!=NULLMOVE
+          &&!(localNodeStates[sd-1]&IID)
+         )
+      {
+        splitslot = (s32)atom_cmpxchg(&RootSplit[RSSLOT+SPLITKEY(localMoveHistory[sd-2])],0,0);
+        if (splitslot>0)
+        {
+          splitkey = SPLITKEY(localMoveHistory[sd-1]);
+          // young brothers wait, open split point after first move
+          if (localTodoIndex[sd-1]>1)
+            atom_cmpxchg(&RootSplit[RSOPEN+SPLITKEY(localMoveHistory[sd-2])],SPWAIT,SPOPEN);
+          n = (s32)atom_cmpxchg(&RootSplit[RSCHILD+(splitslot-1)*4096+splitkey], 0, (u32)gid+1);
+          if (n==0)
+            atom_inc(&RootSplit[RSSPLIT+(splitslot-1)*4+2]);
+          // searched by other work-group
+          if (n!=0&&n!=gid+1)
+          {
+            movecount = 0;
+            localAlphaBetaScores[sd*2+ALPHA] = INF; // ignore score
+          }
+        }
+      }
       // stand pat in qsearch
       // return beta
       if (movecount>0&&qs&&!rootkic&&score>=localAlphaBetaScores[sd*2+BETA])
@@ -1613,14 +2026,17 @@ __kernel void alphabeta_gpu(
           &&!qs
           &&sd>1 // not on root
           &&!(localSearchMode[sd]&NULLMOVESEARCH)
-          &&(ttindex1>1)
+          &&(TTINDEX1>1)
        )
       {
         bbWork = localHashHistory[sd];    
-        bbTemp = bbWork&(ttindex1-1);
         score  = -INF;
 
-        tt1 = TT1[bbTemp];
+        tt1 = ttload(TT1, ttindex1, bbWork);
+        // tt probe counter
+        COUNTERS[gid*64+7]++;
+        if (tt1.hash==TTKEY(bbWork,tt1.bestmove,tt1.score,tt1.depth))
+          COUNTERS[gid*64+8]++;
 
         score = (Score)tt1.score;
 
@@ -1628,7 +2044,7 @@ __kernel void alphabeta_gpu(
         score = (ISMATE(score)&&score>0)?score-ply:score;
         score = (ISMATE(score)&&score<0)?score+ply:score;
 
-        if ((tt1.hash==(bbWork^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+        if ((tt1.hash==TTKEY(bbWork,tt1.bestmove,tt1.score,tt1.depth))
             &&(s32)tt1.depth>=localDepth[sd]
             &&(tt1.flag&0x3)>FAILLOW
             &&!ISINF(score)
@@ -1653,17 +2069,60 @@ __kernel void alphabeta_gpu(
           &&!(localSearchMode[sd]&IIDSEARCH)
           &&localTodoIndex[sd-1]>1 // oldest son searched fully first
           &&localMoveCounter[sd-1]>1
-          &&(ttindex2>1)
+          &&(TTINDEX2>1||(TTUNIFIED&&TTINDEX1>1))
           &&((!RMO)||(RMO&&gid<RANDWORKERS))
+          &&!(rootsplit&&sd<=3) // root and split point moves claimed via queue
           &&localDepth[sd]>0
        )
       {
         move    = localMoveHistory[sd-1];
         bbWork  = localHashHistory[sd];    
-        bbTemp  = bbWork&(ttindex2-1);
+        bbTemp  = bbWork&(TTINDEX2-1);
         score   = -INF;
         n       = 0;
 
+#if TTUNIFIED
+        // lock of first TT1 entry of bucket, score already probed from TT1,
+        // check and set generation, reset lock, get lock, one atomic
+        bbTemp  = TTBUCKETINDEX(bbWork);
+        {
+          u32 lockgen = (ttgen_init+(u32)search_depth)&0xFFFF;
+          u32 lockold = TT1[bbTemp].lock;
+          u32 locknew = ((lockold>>16)!=lockgen)?lockgen<<16:lockold;
+          u32 lockcur;
+          if ((localNodeStates[sd-1]&ITER1)&&(locknew&0xFFFF)==0)
+            locknew |= (u32)gid+1;
+          // on lost race take lock as set by other work-group
+          if (locknew!=lockold)
+          {
+            lockcur = atom_cmpxchg(&TT1[bbTemp].lock, lockold, locknew);
+            locknew = (lockcur==lockold)?locknew:lockcur;
+          }
+          // verify lock
+          if ((localNodeStates[sd-1]&ITER1))
+            n = (s32)(locknew&0xFFFF);
+        }
+#elif defined TT2COMPACT
+        // check and set generation, reset lock, get lock, one atomic
+        ABDADATTE tt2old = TT2[bbTemp];
+        ABDADATTE tt2new = tt2old;
+        if (TT2GEN(tt2new)!=((ttgen_init+(u32)search_depth)&0xFF))
+          tt2new = TT2PACK(TT2KEY(tt2new), 0, ttgen_init+(u32)search_depth, TT2SCORE(tt2new), TT2DEPTH(tt2new));
+        if ((localNodeStates[sd-1]&ITER1)&&TT2LOCK(tt2new)==0)
+          tt2new = TT2PACK(TT2KEY(tt2new), gid+1, TT2GEN(tt2new), TT2SCORE(tt2new), TT2DEPTH(tt2new));
+        tt2 = tt2new;
+        // on lost race take entry as set by other work-group
+        if (tt2new!=tt2old)
+        {
+          tt2new = atom_cmpxchg(&TT2[bbTemp], tt2old, tt2new);
+          tt2 = (tt2new==tt2old)?tt2:tt2new;
+        }
+        // verify lock
+        if ((localNodeStates[sd-1]&ITER1))
+          n = TT2LOCK(tt2);
+
+        score = TT2SCORE(tt2);
+#else
         // check and set ply and sd, reset lock
         if (atom_cmpxchg(&TT2[bbTemp].ply, 0, ply_init+1)!=ply_init+1
             ||atom_cmpxchg(&TT2[bbTemp].sd, 0, search_depth+1)!=search_depth+1
@@ -1684,6 +2143,7 @@ __kernel void alphabeta_gpu(
 
         tt2 = TT2[bbTemp];
         score = (Score)tt2.score;
+#endif
 
         // handle mate scores in TT
         score = (ISMATE(score)&&score>0)?score-ply:score;
@@ -1691,8 +2151,15 @@ __kernel void alphabeta_gpu(
 
         // loaded, update alpha
         if (n!=gid+1
+#if TTUNIFIED
+            &&false
+#elif defined TT2COMPACT
+            &&TT2KEY(tt2)==(u32)(bbWork>>48)
+            &&TT2DEPTH(tt2)>=(s32)localDepth[sd]
+#else
             &&tt2.hash==(bbWork^(Hash)tt2.score^(Hash)tt2.depth)
             &&tt2.depth>=(s16)localDepth[sd]
+#endif
             &&!ISINF(score)
             &&score>localAlphaBetaScores[sd*2+ALPHA]
            )
@@ -1743,13 +2210,13 @@ __kernel void alphabeta_gpu(
       // abdada, set values 
       if (lid==0
           &&sd>1
-          &&ttindex2>1
+          &&TTINDEX2>1
           &&((!RMO)||(RMO&&gid<RANDWORKERS))
           &&(localNodeStates[sd-1]&ITER1)
          )
       {
         bbWork = localHashHistory[sd];    
-        bbTemp = bbWork&(ttindex2-1);
+        bbTemp = bbWork&(TTINDEX2-1);
         score  = localAlphaBetaScores[sd*2+ALPHA];
 
         // handle mate scores in TT, mate in => distance to mate
@@ -1757,7 +2224,12 @@ __kernel void alphabeta_gpu(
         score = (ISMATE(score)&&score<0)?score-ply:score;
 
         // verify lock
+#ifdef TT2COMPACT
+        tt2 = TT2[bbTemp];
+        n   = TT2LOCK(tt2);
+#else
         n = atom_cmpxchg(&TT2[bbTemp].lock, gid+1, gid+1);
+#endif
 
         // set values
         if (n==gid+1
@@ -1767,6 +2239,10 @@ __kernel void alphabeta_gpu(
             &&!(localSearchMode[sd]&IIDSEARCH)
            )
         {
+#ifdef TT2COMPACT
+          // one atomic, entry unchanged since lock check
+          atom_cmpxchg(&TT2[bbTemp], tt2, TT2PACK(bbWork>>48, gid+1, TT2GEN(tt2), score, localDepth[sd]));
+#else
           tt2.hash   = bbWork^(Hash)score^(Hash)localDepth[sd];
           tt2.score  = (TTScore)score;
           tt2.depth  = (s16)localDepth[sd];
@@ -1775,6 +2251,7 @@ __kernel void alphabeta_gpu(
           tt2.sd     = search_depth+1;
 
           TT2[bbTemp]=tt2;
+#endif
 
           // release lock
 //          atom_cmpxchg(&TT2[bbTemp].lock, gid+1, 0);
@@ -1788,8 +2265,45 @@ __kernel void alphabeta_gpu(
       undomove(board, localMoveHistory[sd]);
 
       // early bird
-      if (lid==0&&sd<1)
-       atom_cmpxchg(finito,0,(u32)gid+1);
+      if (lid==0&&sd<1&&!rootsplit)
+       atom_cmpxchg(idfinito,0,(u32)gid+1);
+      // root split, help on open split points with unclaimed moves left
+      if (lid==0&&sd<1&&rootsplit)
+      {
+        bhelper = false;
+        splitslot = (s32)atom_cmpxchg(&RootSplit[RSNSPLIT],0,0);
+        for (n=0;n<splitslot&&n<MAXSPLIT;n++)
+        {
+          if ((atom_cmpxchg(&RootSplit[RSOPEN+RootSplit[RSSPLIT+n*4]],0,0)&SPSTATE)==SPOPEN
+              &&atom_cmpxchg(&RootSplit[RSSPLIT+n*4+2],0,0)
+                <atom_cmpxchg(&RootSplit[RSSPLIT+n*4+1],0,0)
+             )
+            bhelper = true;
+        }
+      }
+      // root split, last finished work-group reduces the root move scores
+      if (lid==0&&sd<1&&rootsplit&&!bhelper)
+      {
+        mem_fence(CLK_GLOBAL_MEM_FENCE);
+        if (atom_inc(&RootSplit[RSDONE])+1==(u32)TOTALWORKERS)
+        {
+          bestscore = -INF;
+          bestmove = MOVENONE;
+          // claimed root moves only, not all keys
+          splitslot = min((s32)atom_cmpxchg(&RootSplit[RSNROOT],0,0),MAXMOVES);
+          for (n=0;n<splitslot;n++)
+          {
+            splitkey = (s32)RootSplit[RSROOT+n];
+            tmpscore = (Score)atom_cmpxchg(&RootSplit[RSSCORE+splitkey],0,0);
+            if (tmpscore>0&&tmpscore-INF-1>bestscore)
+            {
+              bestscore = tmpscore-INF-1;
+              bestmove = (Move)RootSplit[RSMOVE+splitkey];
+            }
+          }
+          atom_cmpxchg(idfinito,0,(u32)gid+1);
+        }
+      }
 
       if (sd<1)
         break;
@@ -1811,6 +2325,26 @@ __kernel void alphabeta_gpu(
         if (move==NULLMOVE&&score<localAlphaBetaScores[sd*2+BETA])
           score = -INF;  // ignore score
 
+        // root split, merge partial score of root move, min over participants
+        if (rootsplit&&sd==1&&move!=MOVENONE&&!ISINF(score))
+        {
+          splitkey = SPLITKEY(move);
+          splitslot = (s32)atom_cmpxchg(&RootSplit[RSSLOT+splitkey],0,0);
+          tmpb = bhelper;
+          // owner closes split point, joins counted before close searched
+          // parts of it, later joins fail
+          if (splitslot>0&&!bhelper)
+            tmpb = (atom_xchg(&RootSplit[RSOPEN+splitkey],SPCLOSED)>=SPJOIN)?true:tmpb;
+          tmpscore = 0;
+          do {
+            n = tmpscore;
+            tmpscore = (Score)atom_cmpxchg(&RootSplit[RSSCORE+splitkey],(u32)n,(u32)(score+INF+1));
+          } while (tmpscore!=n&&tmpscore>score+INF+1);
+          // partial score, no root alpha
+          if (tmpb)
+            score = -INF;  // ignore score
+        }
+
         // late move reductions hack, init research
         if ((localNodeStates[sd]&LMR)&&score>localAlphaBetaScores[sd*2+ALPHA])
         {
@@ -1831,6 +2365,10 @@ __kernel void alphabeta_gpu(
           {
             bestscore = score;
             bestmove = move;
+            // root split, publish raised alpha to other work-groups
+            n = (rootsplit)?(s32)atom_cmpxchg(&RootSplit[RSALPHA],0,0):INF*2;
+            while (n<score+INF)
+              n = (s32)atom_cmpxchg(&RootSplit[RSALPHA],(u32)n,(u32)(score+INF));
           }
         }
         if (score>=localAlphaBetaScores[sd*2+BETA])
@@ -1877,41 +2415,28 @@ __kernel void alphabeta_gpu(
             &&localDepth[sd]>=0
             &&!bforward
             &&!bresearch
-            &&(ttindex1>1)
+            &&(TTINDEX1>1)
+            &&!(rootexclude&&sd==1) // keep root entry of first line
+            &&!(rootsplit&&sd==2&&atom_cmpxchg(&RootSplit[RSSLOT+SPLITKEY(localMoveHistory[sd-1])],0,0)>0) // partial score
            )
         {
           bbWork = localHashHistory[sd];    
-          bbTemp = bbWork&(ttindex1-1);
 
           // handle mate scores in TT, mate in => distance to mate
           score = (ISMATE(score)&&score>0)?score+ply:score;
           score = (ISMATE(score)&&score<0)?score-ply:score;
 
+          tt1.bestmove  = (TTMove)move;
+          tt1.score     = (TTScore)score;
+          tt1.flag      = flag | (ttage&0x3F)<<2;
+          tt1.depth     = (u8)localDepth[sd];
           // xor trick for avoiding race conditions
-          bbMask = bbWork^(Hash)move^(Hash)score^(Hash)localDepth[sd];
+          tt1.hash      = TTKEY(bbWork,tt1.bestmove,tt1.score,tt1.depth);
 
-          // slot 1, depth, score and ply replace
-          tt1 = TT1[bbTemp]; 
-          if (
-               ((u8)localDepth[sd]>tt1.depth)
-               ||
-               ((u8)localDepth[sd]>=tt1.depth
-                &&tt1.hash==(bbWork^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth)
-                &&score>(Score)tt1.score
-               )
-               ||
-               (ttage!=(tt1.flag>>2)
-                &&ttage!=(tt1.flag>>2)+2
-               )
-             ) 
-          {
-              tt1.hash      = bbMask;
-              tt1.bestmove  = (TTMove)move;
-              tt1.score     = (TTScore)score;
-              tt1.flag      = flag | (ttage&0x3F)<<2;
-              tt1.depth     = (u8)localDepth[sd];
-              TT1[bbTemp]   = tt1;
-          }
+          // bucket, depth, score and ply replace
+          // count stores into empty slots, for hashfull estimate
+          if (ttsave(TT1, ttindex1, bbWork, tt1, ttage))
+            COUNTERS[gid*64+6]++;
         } // end save to hash table
         // save killer and counter move heuristic for quiet moves
         if (
@@ -1944,7 +2469,11 @@ __kernel void alphabeta_gpu(
       // nodecount based termination
       bexit = (COUNTERS[1]>max_nodes)?true:bexit;
       // termination flag for helper threads
-      bexit = (atom_cmpxchg(finito,0,0)>0)?true:bexit;
+      bexit = (atom_cmpxchg(idfinito,0,0)>0)?true:bexit;
+      // stop flag set by host, wall clock time control
+      bexit = (*stopflag>0)?true:bexit;
+      // time slice node budget, checkpoint on next main loop entry
+      bsuspend = (slice_nodes>0&&COUNTERS[gid*64+1]-slicestart>=slice_nodes)?true:bsuspend;
     }
     barrier(CLK_LOCAL_MEM_FENCE);
     if (bexit)
@@ -1982,10 +2511,10 @@ __kernel void alphabeta_gpu(
           lmove==MOVENONE
           &&(
              // single slot, randomize
-             ((ttindex1>1&&ttindex2<=1)&&gid>0)
+             ((TTINDEX1>1&&TTINDEX2<=1&&!TTUNIFIED)&&gid>0)
              ||
              // RMO, randomize > n
-             (RMO&&gid>=RANDWORKERS)
+             (RMO&&TOTALWORKERS>RANDWORKERS&&gid>=RANDWORKERS)
             )
           &&!(localNodeStates[sd]&QS)
           &&!(localNodeStates[sd]&KIC)
@@ -2015,11 +2544,10 @@ __kernel void alphabeta_gpu(
     // load move from transposition table
     Move ttmove = MOVENONE;
     bbWork = localHashHistory[sd];    
-    bbTemp = bbWork&(ttindex1-1);
-    if (ttindex1>1)
+    if (TTINDEX1>1)
     {
-      tt1 = TT1[bbTemp];
-      if (tt1.hash==(bbWork^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+      tt1 = ttload(TT1, ttindex1, bbWork);
+      if (tt1.hash==TTKEY(bbWork,tt1.bestmove,tt1.score,tt1.depth))
         ttmove = tt1.bestmove;
     }
     move    = MOVENONE;
@@ -2355,9 +2883,8 @@ __kernel void alphabeta_gpu(
       // compute hash nullmove
       if (move==NULLMOVE)
         bbWork ^= 0x1UL;
-      // set new zobrist hash
+      // set new zobrist hash, in-search history stays in local memory
       localHashHistory[sd]=bbWork;
-      HashHistory[gid*MAXGAMEPLY+ply+ply_init]=bbWork;
       // halfmove clock
       localHMCHistory[sd]=localHMCHistory[sd-1]+1; // increase
       // reset hmc
@@ -2452,8 +2979,11 @@ __kernel void alphabeta_gpu(
   // ################################
   barrier(CLK_LOCAL_MEM_FENCE);
   barrier(CLK_GLOBAL_MEM_FENCE);
+  // mark time slice checkpoint state
+  if (lid==0)
+    Checkpoints[cp+CPSTATE] = (bsuspended)?CPSUSPENDED:CPDONE;
   // collect pv for gui output
-  if (lid==0&&atom_cmpxchg(finito,(u32)gid+1,(u32)gid+1)==(u32)gid+1)
+  if (lid==0&&atom_cmpxchg(idfinito,(u32)gid+1,(u32)gid+1)==(u32)gid+1)
   {
     // get init quadbitboard plus plus
     board[QBBBLACK] = BOARD[QBBBLACK];
@@ -2462,14 +2992,13 @@ __kernel void alphabeta_gpu(
     board[QBBP3]    = BOARD[QBBP3];
     bbWork          = BOARD[QBBHASH]; // hash
     bbMask          = BOARD[QBBPMVD]; // bb castle rights
-    bbTemp          = bbWork&(ttindex1-1);
     stm             = (bool)stm_init;
     n               = 1;
-    PV[0]           = (Score)bestscore;
+    pvout[0]        = (Score)bestscore;
     while(n<MAXPLY)
     {
 
-      PV[n] = bestmove;
+      pvout[n] = bestmove;
 
       domove(board, bestmove);
       stm = !stm;
@@ -2486,17 +3015,15 @@ __kernel void alphabeta_gpu(
         bbMask &= CLRMASKBB(sqep);
       // compute hash x1
       bbWork = computehash(board, stm, bbMask);
-      bbTemp = bbWork&(ttindex1-1);
 
       bestmove = MOVENONE;
       bestscore = -INF;
 
       // load ttmove from hash table
-      if (ttindex1>1)
+      if (TTINDEX1>1)
       {
-        tt1 = TT1[bbTemp];
-        if (tt1.hash==
-              (bbWork^(Hash)tt1.bestmove^(Hash)tt1.score^(Hash)tt1.depth))
+        tt1 = ttload(TT1, ttindex1, bbWork);
+        if (tt1.hash==TTKEY(bbWork,tt1.bestmove,tt1.score,tt1.depth))
         {
           bestscore = (Score)tt1.score;
           bestmove = (Move)tt1.bestmove;
@@ -2508,6 +3035,126 @@ __kernel void alphabeta_gpu(
 
       n++;
     }
+    // persistent search, publish depth and counter totals to host, plain
+    // stores only, progress buffer lives in host memory
+    if (persistent)
+    {
+      for (n=0;n<PROGNCOUNT;n++)
+      {
+        bbTemp = 0;
+        for (u64 i=0;i<TOTALWORKERS;i++)
+          bbTemp += COUNTERS[i*64+n+1];
+        Progress[PROGCOUNT+(search_depth*PROGNCOUNT+n)*2]   = (u32)bbTemp;
+        Progress[PROGCOUNT+(search_depth*PROGNCOUNT+n)*2+1] = (u32)(bbTemp>>32);
+      }
+      mem_fence(CLK_GLOBAL_MEM_FENCE);
+      *(volatile __global u32 *)&Progress[PROGPV+search_depth*PROGSLOT] = 1;
+    }
   } // end collect pv
+  // persistent search, next depth until max depth, node limit or host stop
+  if (lid==0)
+  {
+    bnextdepth = (persistent
+                  &&!bsuspended
+                  &&search_depth<search_depth_init
+                  &&COUNTERS[1]<=max_nodes
+                  &&*stopflag==0)?true:false;
+    // root split, rerun root of same depth as helper
+    bnextdepth = (rootsplit&&bhelper&&sd<1&&!bsuspended)?true:bnextdepth;
+  }
+  barrier(CLK_LOCAL_MEM_FENCE);
+  barrier(CLK_GLOBAL_MEM_FENCE);
+  // root split runs one depth per launch, not persistent
+  search_depth = (rootsplit)?search_depth:search_depth+1;
+  } while (bnextdepth); // end iterative deepening
 } // end kernel alphabeta_gpu
 
+// zero out device memory, used to reset hash tables and move tables per game
+__kernel void clear_buffer(
+                            __global u32 *buffer,
+                               const u64 offset,
+                               const u64 size
+)
+{
+  const u64 i = offset+(u64)get_global_id(0);
+
+  if (i<size)
+    buffer[i] = 0;
+}
+// sample TT1 and TT2 at even strides for host occupancy statistics, per
+// sample used flag, age in plies and depth of each table, -1 if no sample,
+// packed TT2 returns the search generation, mapped to plies by host,
+// consider also types.h
+__kernel void sample_tt(
+                  __global const TT1E *TT1,
+             __global const ABDADATTE *TT2,
+                        __global s32 *Samples,
+                           const u64 ttindex1,
+                           const u64 ttindex2,
+                           const s32 ply_init
+)
+{
+  const u64 i = (u64)get_global_id(0);
+  const u64 stride1 = (TTINDEX1>TTSAMPLES)?TTINDEX1/TTSAMPLES:1;
+  const u64 stride2 = (TTINDEX2>TTSAMPLES)?TTINDEX2/TTSAMPLES:1;
+  __global s32 *sample = &Samples[i*TTSAMPLESIZE];
+  TT1E tt1;
+  ABDADATTE tt2;
+
+  if (i>=TTSAMPLES)
+    return;
+
+  for (s32 j=0;j<TTSAMPLESIZE;j++)
+    sample[j] = -1;
+
+  // rotate through slots of bucket, slot 0 alone overstates occupancy
+  if (TTINDEX1>1&&i*stride1<TTINDEX1)
+  {
+    tt1 = TT1[i*stride1+((stride1>=TTBUCKET)?i%TTBUCKET:0)];
+    sample[0] = (tt1.hash!=0||tt1.depth!=0)?1:0;
+    sample[1] = (s32)(((u32)ply_init-(u32)(tt1.flag>>2))&0x3F);
+    sample[2] = (s32)tt1.depth;
+  }
+  if (TTINDEX2>1&&i*stride2<TTINDEX2)
+  {
+    tt2 = TT2[i*stride2];
+#ifdef TT2COMPACT
+    sample[3] = (tt2!=0)?1:0;
+    sample[4] = (s32)TT2GEN(tt2);
+    sample[5] = TT2DEPTH(tt2);
+#else
+    sample[3] = (tt2.hash!=0||tt2.depth!=0)?1:0;
+    sample[4] = ply_init+1-tt2.ply;
+    sample[5] = (s32)tt2.depth;
+#endif
+  }
+}
+// merge TT entries of host helper threads into TT1, before search kernel
+// runs in same in-order queue, replacement scheme of alphabeta_gpu
+__kernel void merge_tt(
+                        __global TT1E *TT1,
+                  __global const TTE *entries,
+                           const u64 count,
+                           const u64 ttindex1
+)
+{
+  const u64 i = (u64)get_global_id(0);
+  Hash hash;
+  TTE tte;
+  TT1E tt1;
+
+  if (i>=count||TTINDEX1<=1)
+    return;
+
+  tte   = entries[i];
+  // recover position hash via xor trick
+  hash  = tte.hash^(Hash)tte.bestmove^(Hash)tte.score^(Hash)tte.depth;
+
+  tt1.bestmove  = tte.bestmove;
+  tt1.score     = tte.score;
+  tt1.flag      = tte.flag;
+  tt1.depth     = tte.depth;
+  tt1.hash      = TTKEY(hash,tt1.bestmove,tt1.score,tt1.depth);
+
+  ttsave(TT1, ttindex1, hash, tt1, tte.flag>>2);
+}
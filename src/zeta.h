@@ -27,6 +27,7 @@
 void quitengine(s32 flag);
 bool engineinits(void);
 bool gameinits(void);
+void resetgameinits(void);
 void release_gameinits();
 void release_configinits();
 void release_engineinits();
@@ -41,7 +42,12 @@ extern bool logtoggle;
 extern u64 ABNODECOUNT;
 extern u64 TTHITS;
 extern u64 TTSCOREHITS;
+extern u64 TTPROBES;
+extern u64 TTPROBEHITS;
 extern u64 IIDHITS;
+extern u64 TTFILLS;
+extern u64 TTFILLSTOTAL;
+extern u64 HELPERNODECOUNT;
 extern u64 MOVECOUNT;
 // config file
 extern char configfile[256];
@@ -61,11 +67,28 @@ extern s32 opencl_user_platform;
 extern s32 opencl_gpugen;
 // further config
 extern s32 search_depth;
+extern s32 slice_ms;
+extern s32 opencl_profiling;
+extern s32 opencl_zerocopy;
+extern s32 persistent_search;
+extern s32 multipv;
+extern s32 root_split;
+extern s32 cpu_threads;
+extern s32 cpu_helpers;
+extern s32 tt_buckets;
+extern s32 tt2_compact;
+extern s32 tt_unified;
+extern char opencl_options[256];
+extern bool opencl_specialize;
 // timers
 extern double start;
 extern double end;
 extern double elapsed;
+extern double hostoverhead;
+extern double clprofile[PROFTYPES][PROFSTAGES];
+extern u64 clprofilecount[PROFTYPES];
 extern bool TIMEOUT;
+extern volatile bool MOVENOW;
 extern s32 timemode;
 extern s32 MovesLeft;
 extern s32 MaxMoves;
@@ -79,6 +102,10 @@ extern bool STM;
 extern s32 SD;
 extern s32 GAMEPLY;
 extern s32 PLY;
+// pondering
+extern bool pondering;
+extern Move pondermove;
+extern Hash ponderhash;
 // game histories
 extern Move *MoveHistory;
 extern Hash *HashHistory;
@@ -96,14 +123,9 @@ extern u32 *RNUMBERS;
 extern u64 *COUNTERSZEROED;
 extern Move *PV;
 extern Move *PVZEROED;
-extern TTMove *KILLERZEROED;
-extern TTMove *COUNTERZEROED;
-extern Hash *GLOBAL_HASHHISTORY;
+extern Bitboard ROOTEXCLUDE[MULTIPVSIZE];
 extern Bitboard bbInBetween[64*64];
 extern Bitboard bbLine[64*64];
-extern TTE *TT1ZEROED;
-extern ABDADATTE *TT2ZEROED;
-//extern TTE *TT3ZEROED;
 // OpenCL memory buffer objects
 extern cl_mem  GLOBAL_BOARD_Buffer;
 extern cl_mem  GLOBAL_globalbbMoves1_Buffer;
@@ -120,6 +142,14 @@ extern cl_mem  GLOBAL_TT2_Buffer;
 extern cl_mem  GLOBAL_Killer_Buffer;
 extern cl_mem  GLOBAL_Counter_Buffer;
 extern cl_mem  GLOBAL_finito_Buffer;
+extern cl_mem  GLOBAL_stop_Buffer;
+extern cl_mem  GLOBAL_Checkpoint_Buffer;
+extern cl_mem  GLOBAL_slicecount_Buffer;
+extern cl_mem  GLOBAL_Progress_Buffer;
+extern cl_mem  GLOBAL_RootExclude_Buffer;
+extern cl_mem  GLOBAL_RootSplit_Buffer;
+extern cl_mem  GLOBAL_Merge_Buffer;
+extern cl_mem  GLOBAL_Sample_Buffer;
 extern cl_mem  GLOBAL_RScore_Buffer;
 // OpenCL runtime objects
 extern cl_context          context;
@@ -127,6 +157,9 @@ extern cl_device_id        *devices;
 extern cl_command_queue    commandQueue;
 extern cl_program          program;
 extern cl_kernel           kernel;
+extern cl_kernel           clearkernel;
+extern cl_kernel           mergekernel;
+extern cl_kernel           samplekernel;
 // for OpenCL config
 extern cl_uint numPlatforms;
 extern cl_platform_id platform;
@@ -103,23 +103,61 @@ const char zeta_cl[] = {
   0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65,
   0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20, 0x65,
-  0x6e, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x2f, 0x2f, 0x20, 0x6f, 0x74, 0x70,
-  0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x0a, 0x2f, 0x2f, 0x23, 0x70, 0x72, 0x61,
-  0x67, 0x6d, 0x61, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x43, 0x4c, 0x20, 0x45,
-  0x58, 0x54, 0x45, 0x4e, 0x53, 0x49, 0x4f, 0x4e, 0x20, 0x63, 0x6c, 0x5f,
-  0x6b, 0x68, 0x72, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x5f, 0x61, 0x64, 0x64,
-  0x72, 0x65, 0x73, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x6f,
-  0x72, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3a, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x2f, 0x2f, 0x20,
-  0x68, 0x61, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x76, 0x69,
-  0x64, 0x69, 0x61, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x43, 0x4c, 0x20, 0x31,
-  0x2e, 0x30, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x73, 0x0a, 0x23,
-  0x69, 0x66, 0x20, 0x5f, 0x5f, 0x4f, 0x50, 0x45, 0x4e, 0x43, 0x4c, 0x5f,
-  0x56, 0x45, 0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x5f, 0x20, 0x3c, 0x20,
-  0x31, 0x31, 0x30, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
-  0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x23, 0x65,
-  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
-  0x66, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x20, 0x75, 0x36,
+  0x6e, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x2f, 0x2f, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x61, 0x62, 0x64, 0x61,
+  0x64, 0x61, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x2c, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20,
+  0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+  0x20, 0x54, 0x54, 0x32, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a,
+  0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x32, 0x43, 0x4f,
+  0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a, 0x23, 0x70, 0x72, 0x61, 0x67, 0x6d,
+  0x61, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x43, 0x4c, 0x20, 0x45, 0x58, 0x54,
+  0x45, 0x4e, 0x53, 0x49, 0x4f, 0x4e, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68,
+  0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x62, 0x61, 0x73, 0x65,
+  0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3a, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x6f, 0x74, 0x70, 0x69, 0x6f,
+  0x6e, 0x61, 0x6c, 0x0a, 0x2f, 0x2f, 0x23, 0x70, 0x72, 0x61, 0x67, 0x6d,
+  0x61, 0x20, 0x4f, 0x50, 0x45, 0x4e, 0x43, 0x4c, 0x20, 0x45, 0x58, 0x54,
+  0x45, 0x4e, 0x53, 0x49, 0x4f, 0x4e, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68,
+  0x72, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x5f, 0x61, 0x64, 0x64, 0x72, 0x65,
+  0x73, 0x73, 0x61, 0x62, 0x6c, 0x65, 0x5f, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x20,
+  0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x2f, 0x2f, 0x20, 0x68, 0x61,
+  0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x76, 0x69, 0x64, 0x69,
+  0x61, 0x20, 0x4f, 0x70, 0x65, 0x6e, 0x43, 0x4c, 0x20, 0x31, 0x2e, 0x30,
+  0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x73, 0x0a, 0x23, 0x69, 0x66,
+  0x20, 0x5f, 0x5f, 0x4f, 0x50, 0x45, 0x4e, 0x43, 0x4c, 0x5f, 0x56, 0x45,
+  0x52, 0x53, 0x49, 0x4f, 0x4e, 0x5f, 0x5f, 0x20, 0x3c, 0x20, 0x31, 0x31,
+  0x30, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x4f, 0x4c,
+  0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x23, 0x65, 0x6e, 0x64,
+  0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65,
+  0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20,
+  0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x74, 0x72, 0x69, 0x63, 0x74, 0x20,
+  0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x70, 0x61, 0x74, 0x68,
+  0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
+  0x20, 0x47, 0x50, 0x55, 0x47, 0x45, 0x4e, 0x20, 0x26, 0x26, 0x20, 0x47,
+  0x50, 0x55, 0x47, 0x45, 0x4e, 0x20, 0x3c, 0x20, 0x33, 0x0a, 0x23, 0x75,
+  0x6e, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f,
+  0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64,
+  0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x0a, 0x23,
+  0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x47, 0x50, 0x55, 0x47, 0x45, 0x4e,
+  0x20, 0x26, 0x26, 0x20, 0x47, 0x50, 0x55, 0x47, 0x45, 0x4e, 0x20, 0x3c,
+  0x20, 0x32, 0x0a, 0x23, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x63, 0x6c,
+  0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69,
+  0x6e, 0x74, 0x33, 0x32, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x74,
+  0x6f, 0x6d, 0x69, 0x63, 0x73, 0x0a, 0x23, 0x75, 0x6e, 0x64, 0x65, 0x66,
+  0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x65, 0x78, 0x74, 0x65,
+  0x6e, 0x64, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x74, 0x79, 0x70,
+  0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20,
+  0x20, 0x75, 0x36, 0x34, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+  0x66, 0x20, 0x6c, 0x6f, 0x6e, 0x67, 0x20, 0x20, 0x20, 0x20, 0x73, 0x36,
   0x34, 0x3b, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x75,
   0x69, 0x6e, 0x74, 0x20, 0x20, 0x20, 0x20, 0x75, 0x33, 0x32, 0x3b, 0x0a,
   0x74, 0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x69, 0x6e, 0x74, 0x20,
@@ -157,98 +195,451 @@ const char zeta_cl[] = {
   0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x66, 0x6c,
   0x61, 0x67, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x64, 0x65, 0x70,
   0x74, 0x68, 0x3b, 0x0a, 0x7d, 0x20, 0x54, 0x54, 0x45, 0x3b, 0x0a, 0x2f,
-  0x2f, 0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61, 0x20, 0x74, 0x72, 0x61,
-  0x6e, 0x73, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74,
-  0x61, 0x62, 0x6c, 0x65, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x0a, 0x74,
+  0x2f, 0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61, 0x20, 0x6c, 0x6f, 0x63,
+  0x6b, 0x20, 0x69, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x20, 0x54, 0x54, 0x31,
+  0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x65,
+  0x61, 0x64, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x54, 0x32, 0x2c, 0x20, 0x73,
+  0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x62,
+  0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x55, 0x4e,
+  0x49, 0x46, 0x49, 0x45, 0x44, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x54, 0x54, 0x55, 0x4e, 0x49, 0x46, 0x49, 0x45, 0x44, 0x20,
+  0x30, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23, 0x69, 0x66,
+  0x20, 0x54, 0x54, 0x55, 0x4e, 0x49, 0x46, 0x49, 0x45, 0x44, 0x0a, 0x2f,
+  0x2f, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x69, 0x65, 0x64, 0x20, 0x54, 0x54,
+  0x31, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x2c, 0x20, 0x73, 0x61, 0x6d,
+  0x65, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x61, 0x73, 0x20, 0x54, 0x54,
+  0x45, 0x2c, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x20, 0x68, 0x61, 0x6c,
+  0x66, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x61, 0x73,
+  0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x72, 0x20,
+  0x68, 0x61, 0x6c, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x69, 0x73, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c, 0x20, 0x61, 0x62,
+  0x64, 0x61, 0x64, 0x61, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74,
+  0x69, 0x6f, 0x6e, 0x20, 0x75, 0x70, 0x70, 0x65, 0x72, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x20, 0x6c, 0x6f, 0x77, 0x65,
+  0x72, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x66,
+  0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x0a, 0x2f, 0x2f, 0x20, 0x6c, 0x6f,
+  0x63, 0x6b, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x64, 0x20, 0x76,
+  0x69, 0x61, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74,
+  0x6f, 0x6d, 0x69, 0x63, 0x73, 0x2c, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x73, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x2c,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6c,
+  0x73, 0x6f, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x0a, 0x74,
   0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63,
-  0x74, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x68,
-  0x61, 0x73, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x6c,
-  0x6f, 0x63, 0x6b, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x73, 0x33, 0x32, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x61, 0x74,
-  0x6f, 0x6d, 0x69, 0x63, 0x73, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20,
-  0x70, 0x6c, 0x79, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x73, 0x33, 0x32, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x61,
-  0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32,
-  0x20, 0x73, 0x64, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x73, 0x33, 0x32, 0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x0a, 0x20, 0x20, 0x54, 0x54,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x73, 0x31, 0x36, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x3b, 0x0a, 0x7d, 0x20, 0x41, 0x42, 0x44, 0x41, 0x44, 0x41, 0x54, 0x54,
-  0x45, 0x3b, 0x0a, 0x2f, 0x2f, 0x20, 0x74, 0x75, 0x6e, 0x65, 0x62, 0x61,
-  0x6c, 0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x70, 0x61,
-  0x72, 0x61, 0x6d, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x20, 0x4c, 0x4d, 0x52, 0x52, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61,
-  0x74, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75,
-  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
-  0x6e, 0x65, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x52, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x20, 0x2f, 0x2f, 0x20,
-  0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x65,
-  0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x0a, 0x23, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x41, 0x4e, 0x44, 0x42, 0x52, 0x4f,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x20, 0x2f,
-  0x2f, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20, 0x62,
-  0x72, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20,
-  0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x6f,
-  0x72, 0x64, 0x65, 0x72, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x20, 0x52, 0x4d, 0x4f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20, 0x2f,
-  0x2f, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x52, 0x4d, 0x4f, 0x20,
-  0x2d, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x64,
+  0x74, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x75, 0x33, 0x32, 0x20, 0x68, 0x61,
+  0x73, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x54, 0x54, 0x4d, 0x6f, 0x76, 0x65,
+  0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20,
+  0x20, 0x54, 0x54, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x66, 0x6c, 0x61,
+  0x67, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x33, 0x32, 0x20, 0x6c, 0x6f, 0x63,
+  0x6b, 0x3b, 0x0a, 0x7d, 0x20, 0x54, 0x54, 0x31, 0x45, 0x3b, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x54, 0x4b, 0x45, 0x59,
+  0x28, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2c, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x20,
+  0x5c, 0x0a, 0x28, 0x28, 0x75, 0x33, 0x32, 0x29, 0x28, 0x28, 0x28, 0x68,
+  0x61, 0x73, 0x68, 0x29, 0x3e, 0x3e, 0x33, 0x32, 0x29, 0x5e, 0x28, 0x48,
+  0x61, 0x73, 0x68, 0x29, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x5e, 0x28,
+  0x48, 0x61, 0x73, 0x68, 0x29, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29,
+  0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x28, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x29, 0x29, 0x29, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x74,
+  0x79, 0x70, 0x65, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x45, 0x20, 0x54,
+  0x54, 0x31, 0x45, 0x3b, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x54, 0x54, 0x4b, 0x45, 0x59, 0x28, 0x68, 0x61, 0x73, 0x68, 0x2c,
+  0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x29, 0x20, 0x5c, 0x0a, 0x28, 0x28, 0x68, 0x61,
+  0x73, 0x68, 0x29, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x28, 0x6d,
+  0x6f, 0x76, 0x65, 0x29, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x28,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68,
+  0x29, 0x28, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x23, 0x65,
+  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x61, 0x62, 0x64, 0x61,
+  0x64, 0x61, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x65,
+  0x6e, 0x74, 0x72, 0x79, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20,
+  0x54, 0x54, 0x32, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a, 0x2f,
+  0x2f, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x74,
+  0x6f, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x36, 0x34, 0x20, 0x62, 0x69, 0x74,
+  0x20, 0x77, 0x6f, 0x72, 0x64, 0x2c, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74,
+  0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x36,
+  0x34, 0x20, 0x62, 0x69, 0x74, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
+  0x2c, 0x0a, 0x2f, 0x2f, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x31, 0x36, 0x20,
+  0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x31,
+  0x36, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x38, 0x20, 0x62, 0x69, 0x74, 0x73, 0x2c, 0x0a, 0x2f, 0x2f,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x31, 0x36, 0x20, 0x62, 0x69,
+  0x74, 0x73, 0x2c, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x38, 0x20,
+  0x62, 0x69, 0x74, 0x73, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x72, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x73, 0x2e, 0x68, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x74, 0x79, 0x70,
+  0x65, 0x64, 0x65, 0x66, 0x20, 0x75, 0x36, 0x34, 0x20, 0x41, 0x42, 0x44,
+  0x41, 0x44, 0x41, 0x54, 0x54, 0x45, 0x3b, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x54, 0x54, 0x32, 0x4b, 0x45, 0x59, 0x28, 0x65,
+  0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x75, 0x33, 0x32, 0x29,
+  0x28, 0x28, 0x65, 0x29, 0x3e, 0x3e, 0x34, 0x38, 0x29, 0x29, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x54, 0x32, 0x4c, 0x4f,
+  0x43, 0x4b, 0x28, 0x65, 0x29, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x73,
+  0x33, 0x32, 0x29, 0x28, 0x28, 0x28, 0x65, 0x29, 0x3e, 0x3e, 0x33, 0x32,
+  0x29, 0x26, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x29, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x54, 0x32, 0x47, 0x45,
+  0x4e, 0x28, 0x65, 0x29, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x75,
+  0x33, 0x32, 0x29, 0x28, 0x28, 0x28, 0x65, 0x29, 0x3e, 0x3e, 0x32, 0x34,
+  0x29, 0x26, 0x30, 0x78, 0x46, 0x46, 0x29, 0x29, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x54, 0x32, 0x53, 0x43, 0x4f, 0x52,
+  0x45, 0x28, 0x65, 0x29, 0x20, 0x20, 0x20, 0x28, 0x28, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x29, 0x28, 0x54, 0x54, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29,
+  0x28, 0x28, 0x28, 0x65, 0x29, 0x3e, 0x3e, 0x38, 0x29, 0x26, 0x30, 0x78,
+  0x46, 0x46, 0x46, 0x46, 0x29, 0x29, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x54, 0x54, 0x32, 0x44, 0x45, 0x50, 0x54, 0x48, 0x28,
+  0x65, 0x29, 0x20, 0x20, 0x20, 0x28, 0x28, 0x73, 0x33, 0x32, 0x29, 0x28,
+  0x73, 0x38, 0x29, 0x28, 0x28, 0x65, 0x29, 0x26, 0x30, 0x78, 0x46, 0x46,
+  0x29, 0x29, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54,
+  0x54, 0x32, 0x50, 0x41, 0x43, 0x4b, 0x28, 0x6b, 0x65, 0x79, 0x2c, 0x6c,
+  0x6f, 0x63, 0x6b, 0x2c, 0x67, 0x65, 0x6e, 0x2c, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x2c, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x20, 0x5c, 0x0a, 0x28,
+  0x28, 0x28, 0x75, 0x36, 0x34, 0x29, 0x28, 0x6b, 0x65, 0x79, 0x29, 0x3c,
+  0x3c, 0x34, 0x38, 0x29, 0x7c, 0x28, 0x28, 0x28, 0x75, 0x36, 0x34, 0x29,
+  0x28, 0x6c, 0x6f, 0x63, 0x6b, 0x29, 0x26, 0x30, 0x78, 0x46, 0x46, 0x46,
+  0x46, 0x29, 0x3c, 0x3c, 0x33, 0x32, 0x29, 0x7c, 0x28, 0x28, 0x28, 0x75,
+  0x36, 0x34, 0x29, 0x28, 0x67, 0x65, 0x6e, 0x29, 0x26, 0x30, 0x78, 0x46,
+  0x46, 0x29, 0x3c, 0x3c, 0x32, 0x34, 0x29, 0x20, 0x5c, 0x0a, 0x20, 0x7c,
+  0x28, 0x28, 0x28, 0x75, 0x36, 0x34, 0x29, 0x28, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x29, 0x26, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3c, 0x3c,
+  0x38, 0x29, 0x7c, 0x28, 0x28, 0x75, 0x36, 0x34, 0x29, 0x28, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x29, 0x26, 0x30, 0x78, 0x46, 0x46, 0x29, 0x29, 0x0a,
+  0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x74, 0x79, 0x70, 0x65, 0x64, 0x65,
+  0x66, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x0a, 0x7b, 0x0a, 0x20,
+  0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x68, 0x61, 0x73, 0x68, 0x3b, 0x0a,
+  0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x33, 0x32, 0x20, 0x6e,
+  0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73,
+  0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x70, 0x6c, 0x79, 0x3b, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x33, 0x32, 0x20,
+  0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
+  0x73, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x64, 0x3b, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x33, 0x32,
+  0x20, 0x6e, 0x65, 0x65, 0x64, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69,
+  0x63, 0x73, 0x0a, 0x20, 0x20, 0x54, 0x54, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x31,
+  0x36, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a, 0x7d, 0x20, 0x41,
+  0x42, 0x44, 0x41, 0x44, 0x41, 0x54, 0x54, 0x45, 0x3b, 0x0a, 0x23, 0x65,
+  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x74, 0x75, 0x6e, 0x65,
+  0x62, 0x61, 0x6c, 0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20,
+  0x70, 0x61, 0x72, 0x61, 0x6d, 0x73, 0x2c, 0x20, 0x63, 0x61, 0x6e, 0x20,
+  0x62, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x64, 0x65,
+  0x6e, 0x20, 0x76, 0x69, 0x61, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x62,
+  0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x4c, 0x4d, 0x52,
+  0x52, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x4c, 0x4d,
+  0x52, 0x52, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69,
+  0x6f, 0x6e, 0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23,
+  0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x52,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x4e, 0x55, 0x4c,
+  0x4c, 0x52, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x32, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x20, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x41, 0x4e, 0x44, 0x42, 0x52,
+  0x4f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x20,
+  0x2f, 0x2f, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20,
+  0x62, 0x72, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65,
+  0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x64, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65,
+  0x66, 0x20, 0x52, 0x4d, 0x4f, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x52, 0x4d, 0x4f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x20,
+  0x2f, 0x2f, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x52, 0x4d, 0x4f,
+  0x20, 0x2d, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65,
+  0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23, 0x69, 0x66, 0x6e,
+  0x64, 0x65, 0x66, 0x20, 0x52, 0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52, 0x4b,
+  0x45, 0x52, 0x53, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x52, 0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x32, 0x35, 0x36, 0x20, 0x2f, 0x2f, 0x20, 0x52,
+  0x4d, 0x4f, 0x2c, 0x20, 0x61, 0x74, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6d,
+  0x61, 0x6e, 0x79, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x20,
+  0x74, 0x6f, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65,
   0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a,
-  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x41, 0x4e, 0x44,
-  0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x32, 0x35, 0x36, 0x20, 0x2f, 0x2f, 0x20, 0x52, 0x4d, 0x4f, 0x2c, 0x20,
-  0x61, 0x74, 0x20, 0x68, 0x6f, 0x77, 0x20, 0x6d, 0x61, 0x6e, 0x79, 0x20,
-  0x77, 0x6f, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x72,
-  0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a, 0x2f, 0x2f, 0x20, 0x54,
-  0x54, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20,
-  0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
-  0x65, 0x20, 0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x0a, 0x23, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x20, 0x45, 0x58, 0x41, 0x43, 0x54, 0x53, 0x43, 0x4f,
-  0x52, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x23, 0x64,
-  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x46, 0x41, 0x49, 0x4c, 0x48, 0x49,
-  0x47, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0a,
-  0x2f, 0x2f, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65,
-  0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x6d, 0x6f, 0x64, 0x65,
-  0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x45,
-  0x41, 0x52, 0x43, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x54,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66,
+  0x6c, 0x61, 0x67, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x45, 0x58, 0x41, 0x43, 0x54, 0x53, 0x43, 0x4f, 0x52,
+  0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x46, 0x41, 0x49, 0x4c, 0x48, 0x49, 0x47,
+  0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0a, 0x2f,
+  0x2f, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x45, 0x41,
+  0x52, 0x43, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x31, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x4e,
+  0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43,
+  0x48, 0x20, 0x20, 0x32, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x4c, 0x4d, 0x52, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x34, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x0a, 0x2f, 0x2f, 0x20,
+  0x6e, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x54, 0x41, 0x54,
+  0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x4b, 0x49,
+  0x43, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x31, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
-  0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52,
-  0x43, 0x48, 0x20, 0x20, 0x32, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
-  0x65, 0x20, 0x4c, 0x4d, 0x52, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x20,
+  0x51, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x32, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x45, 0x58, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x34, 0x0a, 0x23, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x20, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52, 0x43,
-  0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x0a, 0x2f, 0x2f,
-  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x73,
-  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x54, 0x41,
-  0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x30, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x4b,
-  0x49, 0x43, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x31, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x20, 0x51, 0x53, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
-  0x6e, 0x65, 0x20, 0x45, 0x58, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x34, 0x0a, 0x23, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x20, 0x4c, 0x4d, 0x52, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x0a, 0x23,
-  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x49, 0x44, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x36,
-  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x49, 0x44,
-  0x44, 0x4f, 0x4e, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x33, 0x32, 0x0a, 0x2f, 0x2f, 0x20, 0x41, 0x42, 0x44, 0x41, 0x44, 0x41,
-  0x20, 0x6d, 0x6f, 0x64, 0x65, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
-  0x6e, 0x65, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x36, 0x34, 0x0a, 0x23, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x54, 0x45, 0x52, 0x32, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x32, 0x38, 0x0a, 0x2f,
+  0x69, 0x6e, 0x65, 0x20, 0x4c, 0x4d, 0x52, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x49, 0x44, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x36, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x49, 0x49, 0x44, 0x44,
+  0x4f, 0x4e, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x33,
+  0x32, 0x0a, 0x2f, 0x2f, 0x20, 0x41, 0x42, 0x44, 0x41, 0x44, 0x41, 0x20,
+  0x6d, 0x6f, 0x64, 0x65, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x36, 0x34, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x49, 0x54, 0x45, 0x52, 0x32, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x32, 0x38, 0x0a, 0x2f, 0x2f,
+  0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6c,
+  0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x70, 0x65, 0x72, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x2c, 0x20, 0x69, 0x6e,
+  0x20, 0x75, 0x36, 0x34, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x72, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x73, 0x2e, 0x68, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x43, 0x50, 0x53, 0x49, 0x5a, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x31, 0x30, 0x32, 0x34, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x43, 0x50, 0x53, 0x54, 0x41, 0x54, 0x45, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x74, 0x61, 0x74, 0x65, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x62,
+  0x65, 0x6c, 0x6f, 0x77, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x43, 0x50, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x34, 0x20, 0x78, 0x20, 0x71, 0x75, 0x61, 0x64, 0x20, 0x62, 0x69, 0x74,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x43, 0x50, 0x53, 0x54, 0x4d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x35, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x43, 0x50, 0x53, 0x44, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x36, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x43, 0x50, 0x50, 0x4c, 0x59, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x37, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x43, 0x50, 0x42, 0x45,
+  0x53, 0x54, 0x4d, 0x4f, 0x56, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x38, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x43, 0x50,
+  0x42, 0x45, 0x53, 0x54, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x39, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x43, 0x50, 0x48, 0x45, 0x4c, 0x50, 0x45, 0x52, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x31, 0x30, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72,
+  0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x2c, 0x20, 0x77,
+  0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x68, 0x65,
+  0x6c, 0x70, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x36, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x31, 0x32, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x20, 0x65,
+  0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x43, 0x50, 0x50, 0x52, 0x4e, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43,
+  0x4b, 0x2b, 0x31, 0x32, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x29,
+  0x20, 0x2f, 0x2f, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x20,
+  0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x69, 0x74, 0x65, 0x6d, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x43, 0x50, 0x44, 0x4f, 0x4e, 0x45,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x20, 0x68, 0x61, 0x73, 0x20, 0x66, 0x69, 0x6e, 0x69,
+  0x73, 0x68, 0x65, 0x64, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x43, 0x50, 0x53, 0x55,
+  0x53, 0x50, 0x45, 0x4e, 0x44, 0x45, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x31, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d,
+  0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x79, 0x69, 0x65, 0x6c, 0x64, 0x65,
+  0x64, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x0a, 0x2f, 0x2f, 0x20,
+  0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65,
+  0x73, 0x73, 0x20, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x2c, 0x20, 0x69,
+  0x6e, 0x20, 0x75, 0x33, 0x32, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69,
+  0x64, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x79, 0x70,
+  0x65, 0x73, 0x2e, 0x68, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x50, 0x52, 0x4f, 0x47, 0x50, 0x56, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x73, 0x6c,
+  0x6f, 0x74, 0x2c, 0x20, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x66, 0x6c,
+  0x61, 0x67, 0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x70, 0x76, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x50, 0x52, 0x4f, 0x47, 0x53, 0x4c, 0x4f, 0x54, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x28, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b,
+  0x31, 0x29, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x50,
+  0x52, 0x4f, 0x47, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x28, 0x50, 0x52, 0x4f, 0x47, 0x50, 0x56, 0x2b, 0x4d, 0x41,
+  0x58, 0x50, 0x4c, 0x59, 0x2a, 0x50, 0x52, 0x4f, 0x47, 0x53, 0x4c, 0x4f,
+  0x54, 0x29, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x20, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20,
+  0x74, 0x6f, 0x74, 0x61, 0x6c, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x50, 0x52, 0x4f, 0x47, 0x4e, 0x43, 0x4f, 0x55, 0x4e,
+  0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x38, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x73, 0x6c,
+  0x6f, 0x74, 0x73, 0x20, 0x31, 0x20, 0x74, 0x6f, 0x20, 0x38, 0x2c, 0x20,
+  0x75, 0x36, 0x34, 0x20, 0x61, 0x73, 0x20, 0x74, 0x77, 0x6f, 0x20, 0x75,
+  0x33, 0x32, 0x0a, 0x2f, 0x2f, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70,
+  0x76, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x65, 0x78, 0x63, 0x6c, 0x75, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x61,
+  0x79, 0x6f, 0x75, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x72, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x73, 0x2e, 0x68, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x4d, 0x55, 0x4c, 0x54, 0x49, 0x50, 0x56, 0x43, 0x4f, 0x55, 0x4e, 0x54,
+  0x20, 0x20, 0x20, 0x36, 0x34, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70,
+  0x65, 0x72, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x65, 0x78,
+  0x63, 0x6c, 0x75, 0x64, 0x65, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x2c, 0x20, 0x66, 0x6f, 0x6c, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x62,
+  0x79, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x2f, 0x2f, 0x20, 0x72,
+  0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x20, 0x71, 0x75, 0x65, 0x75, 0x65, 0x20, 0x6c, 0x61, 0x79,
+  0x6f, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x33, 0x32, 0x2c,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6c,
+  0x73, 0x6f, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x43, 0x4c, 0x41,
+  0x49, 0x4d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x6f,
+  0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x2c,
+  0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x77, 0x6f,
+  0x72, 0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x2b, 0x31, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x53, 0x43, 0x4f,
+  0x52, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x34, 0x30, 0x39, 0x36,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x20, 0x72, 0x6f,
+  0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6b, 0x65, 0x79, 0x2c,
+  0x20, 0x6d, 0x69, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x61, 0x72, 0x74,
+  0x69, 0x61, 0x6c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x2b, 0x49,
+  0x4e, 0x46, 0x2b, 0x31, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x52, 0x53, 0x4d, 0x4f, 0x56, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x38, 0x31, 0x39, 0x32, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x53, 0x4c,
+  0x4f, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x32, 0x32, 0x38,
+  0x38, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x20, 0x72,
+  0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6b, 0x65, 0x79,
+  0x2c, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x2b, 0x31, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x52, 0x53, 0x4f, 0x50, 0x45, 0x4e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x31, 0x36, 0x33, 0x38, 0x34, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70,
+  0x65, 0x72, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x6b, 0x65, 0x79, 0x2c, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20,
+  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x73, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x41, 0x4c, 0x50, 0x48,
+  0x41, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x34, 0x38, 0x30, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20,
+  0x72, 0x6f, 0x6f, 0x74, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x2c, 0x20,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x2b, 0x49, 0x4e, 0x46, 0x0a, 0x23, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x44, 0x4f, 0x4e, 0x45, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x34, 0x38, 0x31, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75,
+  0x70, 0x73, 0x20, 0x66, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x65, 0x64, 0x20,
+  0x77, 0x69, 0x74, 0x68, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52,
+  0x53, 0x4e, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x20, 0x20, 0x20, 0x20, 0x32,
+  0x30, 0x34, 0x38, 0x32, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x6c,
+  0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x64, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x0a, 0x23, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x4e, 0x52, 0x4f, 0x4f, 0x54,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x34, 0x38, 0x33, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20,
+  0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x53, 0x50, 0x4c,
+  0x49, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x34, 0x38, 0x34,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6b, 0x65,
+  0x79, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x2c, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x52, 0x53, 0x43, 0x48, 0x49, 0x4c,
+  0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x52, 0x53, 0x53, 0x50, 0x4c,
+  0x49, 0x54, 0x2b, 0x4d, 0x41, 0x58, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x2a,
+  0x34, 0x29, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x63, 0x68,
+  0x69, 0x6c, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6c, 0x61,
+  0x69, 0x6d, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20,
+  0x52, 0x53, 0x52, 0x4f, 0x4f, 0x54, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x28, 0x52, 0x53, 0x43, 0x48, 0x49, 0x4c, 0x44, 0x2b, 0x4d, 0x41, 0x58,
+  0x53, 0x50, 0x4c, 0x49, 0x54, 0x2a, 0x34, 0x30, 0x39, 0x36, 0x29, 0x20,
+  0x2f, 0x2f, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x4d, 0x41, 0x58, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x31, 0x32, 0x38, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x6d, 0x61, 0x78, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x2c, 0x20, 0x61, 0x74, 0x20, 0x72, 0x6f, 0x6f,
+  0x74, 0x20, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x20, 0x6f,
+  0x6e, 0x6c, 0x79, 0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65,
+  0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x62, 0x69, 0x74, 0x73,
+  0x2c, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x68, 0x65, 0x6c,
+  0x70, 0x65, 0x72, 0x73, 0x20, 0x61, 0x62, 0x6f, 0x76, 0x65, 0x2c, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x20, 0x73, 0x6f, 0x20,
+  0x74, 0x68, 0x61, 0x74, 0x20, 0x61, 0x0a, 0x2f, 0x2f, 0x20, 0x6a, 0x6f,
+  0x69, 0x6e, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70,
+  0x61, 0x73, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x6f, 0x73,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x79, 0x20,
+  0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x0a, 0x23, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x50, 0x57, 0x41, 0x49, 0x54,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x79, 0x6f, 0x75, 0x6e, 0x67, 0x20, 0x62,
+  0x72, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 0x77, 0x61, 0x69, 0x74,
+  0x2c, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x69, 0x6e, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x50, 0x4f, 0x50, 0x45,
+  0x4e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x73, 0x20, 0x6d, 0x61, 0x79, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x50, 0x43, 0x4c, 0x4f,
+  0x53, 0x45, 0x44, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x20,
+  0x66, 0x69, 0x6e, 0x69, 0x73, 0x68, 0x65, 0x64, 0x2c, 0x20, 0x6e, 0x6f,
+  0x20, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x73, 0x0a,
+  0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x50, 0x53, 0x54,
+  0x41, 0x54, 0x45, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x33, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x50,
+  0x4a, 0x4f, 0x49, 0x4e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x34, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20,
+  0x53, 0x50, 0x4c, 0x49, 0x54, 0x44, 0x45, 0x50, 0x54, 0x48, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x53, 0x50, 0x4c, 0x49, 0x54,
+  0x44, 0x45, 0x50, 0x54, 0x48, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x69, 0x6e, 0x20, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+  0x63, 0x68, 0x69, 0x6c, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x62, 0x65, 0x63,
+  0x6f, 0x6d, 0x65, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x2f,
+  0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x20, 0x6b, 0x65, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x2c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x2a, 0x36, 0x34, 0x2b, 0x74, 0x6f,
+  0x2c, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e, 0x73,
+  0x20, 0x6d, 0x61, 0x70, 0x70, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x64,
+  0x69, 0x73, 0x74, 0x69, 0x6e, 0x63, 0x74, 0x20, 0x74, 0x6f, 0x20, 0x73,
+  0x71, 0x75, 0x61, 0x72, 0x65, 0x73, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x4b, 0x45, 0x59, 0x28,
+  0x6d, 0x76, 0x29, 0x20, 0x28, 0x28, 0x73, 0x33, 0x32, 0x29, 0x47, 0x45,
+  0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x76, 0x29, 0x2a,
+  0x36, 0x34, 0x2b, 0x28, 0x28, 0x73, 0x33, 0x32, 0x29, 0x47, 0x45, 0x54,
+  0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x76, 0x29, 0x5e, 0x28, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50,
+  0x54, 0x4f, 0x28, 0x6d, 0x76, 0x29, 0x29, 0x21, 0x3d, 0x47, 0x45, 0x54,
+  0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52,
+  0x4f, 0x4d, 0x28, 0x6d, 0x76, 0x29, 0x29, 0x29, 0x3f, 0x28, 0x28, 0x73,
+  0x33, 0x32, 0x29, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
+  0x47, 0x45, 0x54, 0x50, 0x54, 0x4f, 0x28, 0x6d, 0x76, 0x29, 0x29, 0x25,
+  0x35, 0x29, 0x3c, 0x3c, 0x33, 0x3a, 0x30, 0x29, 0x29, 0x29, 0x0a, 0x2f,
   0x2f, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x73, 0x0a, 0x23,
   0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x56, 0x45, 0x52, 0x53, 0x49,
   0x4f, 0x4e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x22, 0x30, 0x39, 0x39,
@@ -2834,137 +3225,419 @@ const char zeta_cl[] = {
   0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65,
   0x20, 0x67, 0x65, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x61,
   0x77, 0x6e, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x20, 0x70, 0x72, 0x6f,
-  0x6d, 0x6f, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x5f, 0x5f, 0x6b, 0x65,
-  0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61, 0x6c,
-  0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x61, 0x5f, 0x67, 0x70, 0x75, 0x28,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x6f, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x2f, 0x2f, 0x20, 0x73,
+  0x65, 0x73, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x61, 0x6e, 0x74, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 0x79,
+  0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20,
+  0x6f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2c, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65,
+  0x6c, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x0a,
+  0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x31, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
+  0x20, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x20, 0x74, 0x74,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
+  0x66, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54,
+  0x49, 0x4e, 0x44, 0x45, 0x58, 0x32, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x20, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x32, 0x20,
+  0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x32, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x20,
+  0x54, 0x4f, 0x54, 0x41, 0x4c, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53,
+  0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x4f, 0x54,
+  0x41, 0x4c, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x20, 0x28, 0x67,
+  0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x69,
+  0x7a, 0x65, 0x28, 0x30, 0x29, 0x2a, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x31, 0x29,
+  0x29, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20,
+  0x54, 0x54, 0x31, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20,
+  0x31, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x2c, 0x20, 0x34, 0x20, 0x3d, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x36, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x20, 0x62, 0x75, 0x63, 0x6b,
+  0x65, 0x74, 0x20, 0x70, 0x65, 0x72, 0x20, 0x70, 0x72, 0x6f, 0x62, 0x65,
+  0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x68,
+  0x6f, 0x73, 0x74, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x20, 0x6f, 0x70,
+  0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x72, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20, 0x74, 0x79, 0x70, 0x65,
+  0x73, 0x2e, 0x68, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x0a, 0x23, 0x69, 0x66,
+  0x6e, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x42, 0x55, 0x43, 0x4b, 0x45,
+  0x54, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x54,
+  0x42, 0x55, 0x43, 0x4b, 0x45, 0x54, 0x20, 0x31, 0x0a, 0x23, 0x65, 0x6e,
+  0x64, 0x69, 0x66, 0x0a, 0x2f, 0x2f, 0x20, 0x54, 0x54, 0x20, 0x6f, 0x63,
+  0x63, 0x75, 0x70, 0x61, 0x6e, 0x63, 0x79, 0x20, 0x73, 0x61, 0x6d, 0x70,
+  0x6c, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+  0x65, 0x5f, 0x74, 0x74, 0x2c, 0x20, 0x73, 0x33, 0x32, 0x20, 0x75, 0x73,
+  0x65, 0x64, 0x2c, 0x20, 0x61, 0x67, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x54, 0x54, 0x31,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x54, 0x54, 0x32, 0x0a, 0x2f, 0x2f, 0x20,
+  0x70, 0x65, 0x72, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x73,
+  0x6f, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x20, 0x66, 0x69,
+  0x6c, 0x65, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54,
+  0x54, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x34, 0x30, 0x39, 0x36, 0x0a, 0x23, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x20, 0x54, 0x54, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x49,
+  0x5a, 0x45, 0x20, 0x20, 0x36, 0x0a, 0x2f, 0x2f, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x54, 0x54, 0x31, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79,
+  0x20, 0x6f, 0x66, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x6f,
+  0x66, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x23,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x54, 0x54, 0x42, 0x55, 0x43,
+  0x4b, 0x45, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x28, 0x68, 0x61, 0x73,
+  0x68, 0x29, 0x20, 0x28, 0x28, 0x68, 0x61, 0x73, 0x68, 0x29, 0x26, 0x28,
+  0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x2d, 0x54, 0x54, 0x42,
+  0x55, 0x43, 0x4b, 0x45, 0x54, 0x29, 0x29, 0x0a, 0x2f, 0x2f, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f, 0x66,
+  0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x54, 0x54, 0x31, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65,
+  0x74, 0x2c, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x78, 0x6f, 0x72,
+  0x20, 0x74, 0x72, 0x69, 0x63, 0x6b, 0x2c, 0x0a, 0x2f, 0x2f, 0x20, 0x66,
+  0x69, 0x72, 0x73, 0x74, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f,
+  0x66, 0x20, 0x62, 0x75, 0x63, 0x6b, 0x65, 0x74, 0x20, 0x69, 0x66, 0x20,
+  0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x0a, 0x54, 0x54, 0x31,
+  0x45, 0x20, 0x74, 0x74, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x2a,
+  0x54, 0x54, 0x31, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+  0x36, 0x34, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2c,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20,
+  0x68, 0x61, 0x73, 0x68, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x42, 0x55, 0x43, 0x4b, 0x45, 0x54,
+  0x49, 0x4e, 0x44, 0x45, 0x58, 0x28, 0x68, 0x61, 0x73, 0x68, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x74, 0x74, 0x31, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x73, 0x33, 0x32,
+  0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x54, 0x54, 0x42, 0x55, 0x43,
+  0x4b, 0x45, 0x54, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x54,
+  0x54, 0x31, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x69, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x31,
+  0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54, 0x54, 0x4b, 0x45, 0x59,
+  0x28, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65,
+  0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72,
+  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x74, 0x31, 0x3b, 0x0a, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x54, 0x54, 0x31, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x5d, 0x3b, 0x0a,
+  0x7d, 0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x65, 0x6e,
+  0x74, 0x72, 0x79, 0x20, 0x74, 0x6f, 0x20, 0x54, 0x54, 0x31, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20,
+  0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x70, 0x6c, 0x79, 0x2c, 0x0a, 0x2f, 0x2f, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x65, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x6c, 0x64, 0x65, 0x72, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x2c, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20,
+  0x6f, 0x76, 0x65, 0x72, 0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f,
+  0x66, 0x20, 0x6c, 0x6f, 0x77, 0x65, 0x73, 0x74, 0x20, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x2c, 0x0a, 0x2f, 0x2f, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72,
+  0x6e, 0x73, 0x20, 0x74, 0x72, 0x75, 0x65, 0x20, 0x6f, 0x6e, 0x20, 0x73,
+  0x74, 0x6f, 0x72, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x65, 0x6d,
+  0x70, 0x74, 0x79, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x68, 0x61, 0x73, 0x68, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x65,
+  0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x0a, 0x62, 0x6f, 0x6f, 0x6c,
+  0x20, 0x74, 0x74, 0x73, 0x61, 0x76, 0x65, 0x28, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x2a, 0x54,
+  0x54, 0x31, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36,
+  0x34, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2c, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x68,
+  0x61, 0x73, 0x68, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x54,
+  0x54, 0x31, 0x45, 0x20, 0x74, 0x74, 0x65, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x75, 0x38, 0x20, 0x74, 0x74, 0x61, 0x67, 0x65, 0x29,
+  0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+  0x36, 0x34, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x20, 0x3d, 0x20, 0x54,
+  0x54, 0x42, 0x55, 0x43, 0x4b, 0x45, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58,
+  0x28, 0x68, 0x61, 0x73, 0x68, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36,
+  0x34, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x64,
+  0x65, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x72, 0x61,
+  0x6e, 0x6b, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x37, 0x46, 0x46, 0x46, 0x46,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x74,
+  0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x66,
+  0x6f, 0x75, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65,
+  0x3b, 0x0a, 0x20, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x74, 0x74, 0x31,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x73, 0x33,
+  0x32, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x54, 0x54, 0x42, 0x55,
+  0x43, 0x4b, 0x45, 0x54, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20,
+  0x54, 0x54, 0x31, 0x5b, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x69, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74,
+  0x31, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54, 0x54, 0x4b, 0x45,
+  0x59, 0x28, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x62,
+  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x20,
+  0x3d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b, 0x69, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x20, 0x3d,
+  0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x20, 0x3d, 0x20,
+  0x28, 0x73, 0x33, 0x32, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x2d, 0x28, 0x28, 0x74, 0x74, 0x61, 0x67, 0x65, 0x21, 0x3d,
+  0x28, 0x74, 0x74, 0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32,
+  0x29, 0x26, 0x26, 0x74, 0x74, 0x61, 0x67, 0x65, 0x21, 0x3d, 0x28, 0x74,
+  0x74, 0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32, 0x29, 0x2b,
+  0x32, 0x29, 0x3f, 0x32, 0x35, 0x36, 0x3a, 0x30, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x3c, 0x72,
+  0x61, 0x6e, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x61, 0x6e, 0x6b, 0x20, 0x3d, 0x20,
+  0x74, 0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2b,
+  0x69, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x7d,
+  0x0a, 0x0a, 0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x54, 0x54,
+  0x31, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x21, 0x66, 0x6f, 0x75, 0x6e, 0x64, 0x26, 0x26, 0x54, 0x54, 0x42, 0x55,
+  0x43, 0x4b, 0x45, 0x54, 0x3e, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x28, 0x74, 0x74, 0x65, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3e,
+  0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x28, 0x74, 0x74, 0x65, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x3e, 0x3d, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54, 0x54,
+  0x4b, 0x45, 0x59, 0x28, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x74, 0x74, 0x31,
+  0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74, 0x74,
+  0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x74, 0x74, 0x65, 0x2e, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3e, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x28, 0x74, 0x74, 0x61, 0x67, 0x65, 0x21, 0x3d, 0x28,
+  0x74, 0x74, 0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x74,
+  0x74, 0x61, 0x67, 0x65, 0x21, 0x3d, 0x28, 0x74, 0x74, 0x31, 0x2e, 0x66,
+  0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32, 0x29, 0x2b, 0x32, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x29, 0x0a, 0x20, 0x20, 0x7b, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x54, 0x54,
+  0x55, 0x4e, 0x49, 0x46, 0x49, 0x45, 0x44, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x61, 0x62, 0x64, 0x61,
+  0x64, 0x61, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x6f, 0x66, 0x20, 0x73,
+  0x6c, 0x6f, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x54, 0x31, 0x5b,
+  0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x65, 0x2e, 0x68, 0x61,
+  0x73, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x54, 0x31, 0x5b,
+  0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x65, 0x2e, 0x62, 0x65,
+  0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x54, 0x54, 0x31, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2e, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x74,
+  0x65, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x54, 0x54, 0x31, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2e, 0x66,
+  0x6c, 0x61, 0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74,
+  0x74, 0x65, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x54, 0x54, 0x31, 0x5b, 0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x2e, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74,
+  0x74, 0x65, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a, 0x23, 0x65,
+  0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x54, 0x54, 0x31, 0x5b,
+  0x73, 0x6c, 0x6f, 0x74, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x65, 0x3b,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x74, 0x74, 0x31, 0x2e,
+  0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x74, 0x74, 0x31,
+  0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3d, 0x3d, 0x30, 0x29, 0x3f, 0x74,
+  0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20,
+  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x5f, 0x5f, 0x6b,
+  0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61,
+  0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x61, 0x5f, 0x67, 0x70, 0x75,
+  0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-  0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69,
-  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x2a, 0x42, 0x4f, 0x41, 0x52,
-  0x44, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42,
+  0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x2a, 0x42, 0x4f, 0x41,
+  0x52, 0x44, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x36, 0x34, 0x20, 0x2a, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52,
-  0x53, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x36, 0x34, 0x20, 0x2a, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45,
+  0x52, 0x53, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x74, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x75, 0x33, 0x32, 0x20, 0x2a, 0x52, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52,
-  0x53, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x33, 0x32, 0x20, 0x2a, 0x52, 0x4e, 0x55, 0x4d, 0x42, 0x45,
+  0x52, 0x53, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
-  0x4d, 0x6f, 0x76, 0x65, 0x20, 0x2a, 0x50, 0x56, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x2a, 0x50, 0x56, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x20, 0x2a, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x31, 0x2c, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f,
   0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f,
   0x61, 0x72, 0x64, 0x20, 0x2a, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62,
-  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67,
+  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x2a,
+  0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69,
+  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x2a, 0x62, 0x62, 0x49, 0x6e,
+  0x42, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5f, 0x5f, 0x67,
   0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x20, 0x2a, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62,
-  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x64, 0x20, 0x2a, 0x62, 0x62, 0x4c, 0x69, 0x6e, 0x65, 0x2c, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x2a, 0x48,
-  0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x54, 0x54, 0x31,
+  0x45, 0x20, 0x2a, 0x54, 0x54, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
-  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x2a, 0x62, 0x62, 0x49, 0x6e, 0x42,
-  0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x41, 0x42, 0x44, 0x41, 0x44, 0x41, 0x54,
+  0x54, 0x45, 0x20, 0x2a, 0x54, 0x54, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5f, 0x5f, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x20, 0x2a, 0x62, 0x62, 0x4c, 0x69, 0x6e, 0x65, 0x2c, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x2a,
+  0x4b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f,
-  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x54, 0x54, 0x45, 0x20,
-  0x2a, 0x54, 0x54, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x2a,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
-  0x61, 0x6c, 0x20, 0x41, 0x42, 0x44, 0x41, 0x44, 0x41, 0x54, 0x54, 0x45,
-  0x20, 0x2a, 0x54, 0x54, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x2a, 0x4b, 0x69,
-  0x6c, 0x6c, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73,
+  0x74, 0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x2a, 0x43, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x70, 0x6c,
+  0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x74, 0x6d,
-  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x20, 0x75, 0x36, 0x34, 0x20, 0x6d, 0x61, 0x78, 0x5f, 0x6e, 0x6f, 0x64,
+  0x65, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x20, 0x75, 0x36, 0x34, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78,
+  0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x75, 0x36, 0x34, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x32,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x33, 0x32, 0x20, 0x2a, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x76, 0x6f, 0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x33, 0x32,
+  0x20, 0x2a, 0x73, 0x74, 0x6f, 0x70, 0x66, 0x6c, 0x61, 0x67, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x36, 0x34,
+  0x20, 0x2a, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x75, 0x33, 0x32, 0x20, 0x2a, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x5f,
+  0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x70, 0x6c, 0x79, 0x5f,
-  0x69, 0x6e, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x72, 0x65, 0x73, 0x75,
+  0x6d, 0x65, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
-  0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x20, 0x75, 0x33, 0x32, 0x20, 0x2a, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x65,
+  0x73, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x20, 0x73, 0x33, 0x32, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74,
+  0x65, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x6d, 0x61,
-  0x78, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x2c, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x74, 0x74,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x62, 0x65, 0x74, 0x61, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x74, 0x74, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62,
+  0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20,
+  0x2a, 0x52, 0x6f, 0x6f, 0x74, 0x45, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x20, 0x75, 0x33, 0x32, 0x20, 0x2a, 0x66, 0x69, 0x6e,
-  0x69, 0x74, 0x6f, 0x0a, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x51, 0x75, 0x61, 0x64, 0x62, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74,
-  0x65, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x34, 0x5d, 0x3b, 0x20, 0x0a, 0x0a, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72,
-  0x79, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x68, 0x6f, 0x6c, 0x64,
-  0x65, 0x72, 0x73, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x21, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f,
-  0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64,
-  0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x7c,
-  0x7c, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c,
-  0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x5f, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x36,
-  0x34, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23,
-  0x69, 0x66, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
-  0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f,
-  0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x7c, 0x7c, 0x20, 0x64,
-  0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43,
-  0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d,
-  0x70, 0x36, 0x34, 0x5b, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e,
-  0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x20, 0x54, 0x54, 0x45, 0x20, 0x74, 0x74, 0x31, 0x3b, 0x0a,
+  0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75,
+  0x33, 0x32, 0x20, 0x2a, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69,
+  0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x73, 0x33, 0x32, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x75, 0x33, 0x32, 0x20, 0x74, 0x74, 0x67, 0x65, 0x6e, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x0a, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x51, 0x75, 0x61, 0x64, 0x62, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+  0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x34, 0x5d, 0x3b, 0x20, 0x0a, 0x0a, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79,
+  0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x20, 0x68, 0x6f, 0x6c, 0x64, 0x65,
+  0x72, 0x73, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x69,
+  0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65,
+  0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x7c, 0x7c,
+  0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44,
+  0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x36, 0x34,
+  0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x23, 0x69,
+  0x66, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63,
+  0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f,
+  0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x61,
+  0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x7c, 0x7c, 0x20, 0x64, 0x65,
+  0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48,
+  0x4f, 0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70,
+  0x36, 0x34, 0x5b, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64,
+  0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x74, 0x74, 0x31, 0x3b, 0x0a,
   0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x41, 0x42,
   0x44, 0x41, 0x44, 0x41, 0x54, 0x54, 0x45, 0x20, 0x74, 0x74, 0x32, 0x3b,
   0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61,
@@ -3025,188 +3698,293 @@ const char zeta_cl[] = {
   0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d,
   0x6f, 0x76, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f,
   0x6e, 0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x63, 0x68, 0x20, 0x66, 0x6c,
-  0x61, 0x67, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x20, 0x75, 0x38, 0x20, 0x74, 0x74, 0x61, 0x67, 0x65, 0x3b, 0x0a,
-  0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x53,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x73, 0x71, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x65, 0x72, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x20, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x65, 0x76,
-  0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x5f,
-  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x53, 0x63, 0x6f, 0x72, 0x65,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x73, 0x33,
-  0x32, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x6c, 0x6d, 0x6f,
-  0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d,
-  0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x20, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x3b, 0x0a,
+  0x61, 0x67, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x62, 0x73, 0x75, 0x73, 0x70, 0x65,
+  0x6e, 0x64, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69,
+  0x6d, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x20, 0x65, 0x78, 0x68,
+  0x61, 0x75, 0x73, 0x74, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x0a,
+  0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x62, 0x6f,
+  0x6f, 0x6c, 0x20, 0x62, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6e, 0x64, 0x65,
+  0x64, 0x3b, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x20, 0x73, 0x61, 0x76, 0x65,
+  0x64, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x0a, 0x20, 0x20, 0x5f,
+  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
+  0x62, 0x6e, 0x65, 0x78, 0x74, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+  0x6e, 0x74, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2c, 0x20, 0x72,
+  0x75, 0x6e, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x62, 0x68,
+  0x65, 0x6c, 0x70, 0x65, 0x72, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x2c, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x20, 0x6f, 0x6e, 0x20, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x0a, 0x0a, 0x20, 0x20,
+  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x75, 0x38, 0x20, 0x74,
+  0x74, 0x61, 0x67, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20,
+  0x73, 0x71, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x53, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x20, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x73, 0x33, 0x32, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x5f, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x4d, 0x6f,
+  0x76, 0x65, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x4d, 0x6f, 0x76, 0x65,
+  0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x0a,
   0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x42, 0x69,
-  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x43, 0x68, 0x65,
-  0x63, 0x6b, 0x65, 0x72, 0x73, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32, 0x20, 0x67, 0x69, 0x64, 0x20,
-  0x3d, 0x20, 0x28, 0x75, 0x33, 0x32, 0x29, 0x28, 0x67, 0x65, 0x74, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30, 0x29,
-  0x2a, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f,
-  0x73, 0x69, 0x7a, 0x65, 0x28, 0x31, 0x29, 0x2b, 0x67, 0x65, 0x74, 0x5f,
-  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x31, 0x29,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x53,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x6c, 0x69, 0x64, 0x20, 0x3d, 0x20,
-  0x28, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x29, 0x67, 0x65, 0x74, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x32, 0x29, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x74, 0x6d, 0x70,
-  0x62, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x63, 0x6f,
-  0x6c, 0x6f, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
-  0x6b, 0x69, 0x63, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20,
-  0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x3b, 0x0a, 0x20, 0x20, 0x62,
-  0x6f, 0x6f, 0x6c, 0x20, 0x71, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f,
-  0x6f, 0x6c, 0x20, 0x73, 0x74, 0x6d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x53,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67,
-  0x3b, 0x0a, 0x20, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x73,
-  0x71, 0x74, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72,
-  0x65, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x3b, 0x20, 0x20, 0x20, 0x0a,
-  0x20, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x73, 0x71, 0x65,
-  0x70, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x50, 0x69, 0x65, 0x63, 0x65, 0x20,
-  0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x50, 0x69, 0x65,
-  0x63, 0x65, 0x20, 0x70, 0x74, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x50, 0x69,
-  0x65, 0x63, 0x65, 0x20, 0x70, 0x63, 0x70, 0x74, 0x3b, 0x0a, 0x0a, 0x20,
-  0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x73,
-  0x33, 0x32, 0x20, 0x70, 0x6c, 0x79, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x73,
-  0x33, 0x32, 0x20, 0x6e, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x53, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x73,
-  0x65, 0x75, 0x64, 0x6f, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x20,
-  0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x65,
-  0x64, 0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x0a,
-  0x20, 0x20, 0x75, 0x33, 0x32, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x3d, 0x20,
-  0x52, 0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x53, 0x5b, 0x67, 0x69, 0x64,
-  0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c, 0x69, 0x64,
-  0x5d, 0x3b, 0x0a, 0x2f, 0x2a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x78,
-  0x6f, 0x72, 0x73, 0x68, 0x69, 0x66, 0x74, 0x33, 0x32, 0x20, 0x50, 0x52,
-  0x4e, 0x47, 0x0a, 0x09, 0x78, 0x20, 0x5e, 0x3d, 0x20, 0x78, 0x20, 0x3c,
-  0x3c, 0x20, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x78, 0x20, 0x5e, 0x3d, 0x20,
-  0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x3b, 0x0a, 0x09, 0x78, 0x20,
-  0x5e, 0x3d, 0x20, 0x78, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x3b, 0x0a, 0x2a,
-  0x2f, 0x0a, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x6d,
-  0x70, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x42, 0x69,
-  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f,
-  0x63, 0x6b, 0x65, 0x72, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x4d, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62,
-  0x62, 0x4f, 0x70, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b,
-  0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69,
-  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73,
-  0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x3b, 0x0a, 0x0a,
+  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x41, 0x74, 0x74,
+  0x61, 0x63, 0x6b, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x20, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x33,
+  0x32, 0x20, 0x67, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x33, 0x32,
+  0x29, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x5f, 0x69, 0x64, 0x28, 0x30, 0x29, 0x2a, 0x67, 0x65, 0x74, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x28, 0x31,
+  0x29, 0x2b, 0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
+  0x5f, 0x69, 0x64, 0x28, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x63,
+  0x6f, 0x6e, 0x73, 0x74, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20,
+  0x6c, 0x69, 0x64, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x71, 0x75, 0x61, 0x72,
+  0x65, 0x29, 0x67, 0x65, 0x74, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f,
+  0x69, 0x64, 0x28, 0x32, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x62, 0x6f,
+  0x6f, 0x6c, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x62,
+  0x6f, 0x6f, 0x6c, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x0a, 0x20,
+  0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6b, 0x69, 0x63, 0x3b, 0x0a, 0x20,
+  0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69,
+  0x63, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x71, 0x73,
+  0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x73, 0x74, 0x6d,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20,
+  0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x3b, 0x0a, 0x20, 0x20, 0x53, 0x71,
+  0x75, 0x61, 0x72, 0x65, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x3b, 0x0a, 0x20,
+  0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x73, 0x71, 0x63, 0x70,
+  0x74, 0x3b, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x53, 0x71, 0x75, 0x61,
+  0x72, 0x65, 0x20, 0x73, 0x71, 0x65, 0x70, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x50, 0x69, 0x65, 0x63, 0x65, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b,
+  0x0a, 0x20, 0x20, 0x50, 0x69, 0x65, 0x63, 0x65, 0x20, 0x70, 0x74, 0x6f,
+  0x3b, 0x0a, 0x20, 0x20, 0x50, 0x69, 0x65, 0x63, 0x65, 0x20, 0x70, 0x63,
+  0x70, 0x74, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73,
+  0x64, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x70, 0x6c, 0x79,
+  0x3b, 0x0a, 0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x73, 0x33, 0x32, 0x20, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x33,
+  0x32, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x3b, 0x0a,
+  0x20, 0x20, 0x73, 0x33, 0x32, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73,
+  0x6c, 0x6f, 0x74, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x53,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x73, 0x65,
+  0x75, 0x64, 0x6f, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x20, 0x6e,
+  0x75, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x64,
+  0x65, 0x64, 0x20, 0x6f, 0x6e, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x0a, 0x20,
+  0x20, 0x75, 0x33, 0x32, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x3d, 0x20, 0x52,
+  0x4e, 0x55, 0x4d, 0x42, 0x45, 0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a,
+  0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c, 0x69, 0x64, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20,
+  0x73, 0x6c, 0x69, 0x63, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x77, 0x6f, 0x72, 0x6b,
+  0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x63, 0x70, 0x20, 0x3d, 0x20,
+  0x28, 0x75, 0x36, 0x34, 0x29, 0x67, 0x69, 0x64, 0x2a, 0x43, 0x50, 0x53,
+  0x49, 0x5a, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x6f,
+  0x64, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x61,
+  0x74, 0x20, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x2c, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65,
+  0x20, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x0a, 0x20, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x73, 0x6c, 0x69, 0x63,
+  0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3d, 0x20, 0x43, 0x4f, 0x55,
+  0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34,
+  0x2b, 0x31, 0x5d, 0x3b, 0x0a, 0x2f, 0x2a, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x78, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x66, 0x74, 0x33, 0x32, 0x20,
+  0x50, 0x52, 0x4e, 0x47, 0x0a, 0x09, 0x78, 0x20, 0x5e, 0x3d, 0x20, 0x78,
+  0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x78, 0x20, 0x5e,
+  0x3d, 0x20, 0x78, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x3b, 0x0a, 0x09,
+  0x78, 0x20, 0x5e, 0x3d, 0x20, 0x78, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x3b,
+  0x0a, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20,
+  0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x42,
+  0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x42,
+  0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x4d, 0x65,
+  0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x20, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69,
+  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x70, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+  0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x4d,
+  0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x20, 0x62, 0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x3b, 0x0a, 0x0a,
   0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62,
-  0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x42, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x3b, 0x20, 0x0a, 0x0a,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x69,
-  0x74, 0x20, 0x71, 0x75, 0x61, 0x64, 0x62, 0x69, 0x74, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x20, 0x70, 0x6c, 0x75, 0x73,
+  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x42, 0x69, 0x74, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x3b, 0x20,
+  0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x69,
+  0x6e, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x70, 0x76, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75,
+  0x74, 0x2c, 0x20, 0x70, 0x65, 0x72, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x20, 0x69, 0x6e, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+  0x6e, 0x74, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20,
+  0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x75, 0x33, 0x32,
+  0x20, 0x2a, 0x69, 0x64, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x3b, 0x0a,
+  0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x4d,
+  0x6f, 0x76, 0x65, 0x20, 0x2a, 0x70, 0x76, 0x6f, 0x75, 0x74, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70,
+  0x76, 0x2c, 0x20, 0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x72,
+  0x65, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64, 0x20, 0x72, 0x6f, 0x6f, 0x74,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x6e,
+  0x6f, 0x74, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x20,
+  0x61, 0x67, 0x61, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x65,
+  0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x52, 0x6f,
+  0x6f, 0x74, 0x45, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5b, 0x4d, 0x55,
+  0x4c, 0x54, 0x49, 0x50, 0x56, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x5d, 0x3e,
+  0x30, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73,
+  0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72,
+  0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x69, 0x74, 0x65, 0x72,
+  0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x65, 0x65, 0x70, 0x65, 0x6e,
+  0x69, 0x6e, 0x67, 0x20, 0x6f, 0x6e, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63,
+  0x65, 0x2c, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x3d, 0x20, 0x28,
+  0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x29, 0x3f,
+  0x31, 0x3a, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x66, 0x61,
+  0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61,
+  0x74, 0x69, 0x76, 0x65, 0x20, 0x64, 0x65, 0x65, 0x70, 0x65, 0x6e, 0x69,
+  0x6e, 0x67, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a,
+  0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x64, 0x66,
+  0x69, 0x6e, 0x69, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x28, 0x70, 0x65, 0x72,
+  0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x29, 0x3f, 0x26, 0x66, 0x69,
+  0x6e, 0x69, 0x74, 0x6f, 0x5b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x5d, 0x3a, 0x66, 0x69, 0x6e, 0x69, 0x74,
+  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x76, 0x6f, 0x75, 0x74, 0x20, 0x3d,
+  0x20, 0x28, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74,
+  0x29, 0x3f, 0x26, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5b,
+  0x50, 0x52, 0x4f, 0x47, 0x50, 0x56, 0x2b, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2a, 0x50, 0x52, 0x4f, 0x47,
+  0x53, 0x4c, 0x4f, 0x54, 0x2b, 0x31, 0x5d, 0x3a, 0x50, 0x56, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x69, 0x6e,
+  0x69, 0x74, 0x20, 0x71, 0x75, 0x61, 0x64, 0x62, 0x69, 0x74, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x20, 0x70, 0x6c, 0x75,
+  0x73, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
+  0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x20, 0x3d, 0x20, 0x42, 0x4f,
+  0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
+  0x42, 0x42, 0x50, 0x31, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42,
+  0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x3b,
   0x0a, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
-  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41,
-  0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d,
-  0x3b, 0x0a, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
-  0x42, 0x50, 0x31, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f,
-  0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x3b, 0x0a,
-  0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
-  0x32, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52,
-  0x44, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x74,
-  0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x73, 0x74,
-  0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x70, 0x6c,
-  0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x64, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x69, 0x6e, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x78, 0x69,
-  0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x50, 0x32, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41,
+  0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33,
+  0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44,
+  0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x73,
+  0x74, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x73,
+  0x74, 0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x70,
+  0x6c, 0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x64,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x69, 0x6e, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x78,
+  0x69, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x73, 0x74, 0x61, 0x79, 0x73, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x20,
+  0x69, 0x66, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6c,
+  0x73, 0x20, 0x6c, 0x6f, 0x77, 0x0a, 0x20, 0x20, 0x62, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x62,
-  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e,
-  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x44,
-  0x52, 0x41, 0x57, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20,
-  0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c,
-  0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x66, 0x6f, 0x72, 0x77, 0x61,
-  0x72, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
-  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x74, 0x61,
-  0x67, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x70, 0x6c, 0x79, 0x5f, 0x69,
-  0x6e, 0x69, 0x74, 0x26, 0x30, 0x78, 0x33, 0x46, 0x3b, 0x0a, 0x0a, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x61, 0x62, 0x20,
-  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73,
-  0x74, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
-  0x72, 0x65, 0x73, 0x5b, 0x30, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48,
-  0x41, 0x5d, 0x20, 0x3d, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65,
-  0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x2a, 0x32,
-  0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x49, 0x4e,
-  0x46, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f,
-  0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x30, 0x5d,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x30,
-  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74,
-  0x6f, 0x72, 0x79, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x62, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6e,
+  0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66,
+  0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x73, 0x75, 0x73,
+  0x70, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x74,
+  0x74, 0x61, 0x67, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x70, 0x6c, 0x79,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x26, 0x30, 0x78, 0x33, 0x46, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x61,
+  0x62, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x76, 0x61, 0x72,
+  0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
+  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x30, 0x2a, 0x32, 0x2b, 0x41, 0x4c,
+  0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
+  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x30,
+  0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x20, 0x3d, 0x20,
+  0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78,
+  0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69,
+  0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d,
+  0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73,
+  0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56,
   0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b, 0x30,
-  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e,
-  0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x43, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x30, 0x5d,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51,
-  0x42, 0x42, 0x50, 0x4d, 0x56, 0x44, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f,
-  0x72, 0x79, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x38,
-  0x29, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x48, 0x4d,
-  0x43, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48,
-  0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x30,
+  0x61, 0x6c, 0x43, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b,
+  0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44,
+  0x5b, 0x51, 0x42, 0x42, 0x50, 0x4d, 0x56, 0x44, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x75, 0x38, 0x29, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42,
+  0x48, 0x4d, 0x43, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+  0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b,
+  0x51, 0x42, 0x42, 0x48, 0x41, 0x53, 0x48, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x30,
   0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42,
-  0x42, 0x48, 0x41, 0x53, 0x48, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x30, 0x5d, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31,
+  0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
+  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31, 0x3b, 0x0a,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
-  0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x7c, 0x20,
-  0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-  0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x41, 0x52, 0x43,
-  0x48, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
-  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
-  0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
-  0x5d, 0x3d, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b,
-  0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x3b,
+  0x3d, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x20,
+  0x7c, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f,
+  0x64, 0x65, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x41,
+  0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50,
+  0x48, 0x41, 0x5d, 0x3d, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x73, 0x70, 0x69,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f,
+  0x77, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
+  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20,
+  0x3d, 0x20, 0x62, 0x65, 0x74, 0x61, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x3b,
   0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65,
   0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
@@ -3247,6 +4025,164 @@ const char zeta_cl[] = {
   0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x3d, 0x20, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x20,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x65, 0x76,
+  0x69, 0x6f, 0x75, 0x73, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73, 0x6c,
+  0x69, 0x63, 0x65, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20,
+  0x74, 0x68, 0x69, 0x73, 0x20, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x20,
+  0x72, 0x65, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+  0x61, 0x73, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73, 0x75, 0x6d, 0x65, 0x26, 0x26,
+  0x21, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x29, 0x0a, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x72,
+  0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x66, 0x69, 0x6e, 0x69,
+  0x73, 0x68, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x70, 0x72, 0x65, 0x76,
+  0x69, 0x6f, 0x75, 0x73, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x2c, 0x20,
+  0x6e, 0x6f, 0x74, 0x68, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x20, 0x64,
+  0x6f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x43, 0x68,
+  0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70,
+  0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x54, 0x45, 0x5d, 0x21, 0x3d, 0x43,
+  0x50, 0x53, 0x55, 0x53, 0x50, 0x45, 0x4e, 0x44, 0x45, 0x44, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x20, 0x3d,
+  0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73,
+  0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x2b,
+  0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
+  0x50, 0x31, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x43, 0x68, 0x65,
+  0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b,
+  0x43, 0x50, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x2b, 0x51, 0x42, 0x42, 0x50,
+  0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x4f, 0x41, 0x52, 0x44,
+  0x2b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33,
+  0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b,
+  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50,
+  0x42, 0x4f, 0x41, 0x52, 0x44, 0x2b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53,
+  0x54, 0x4d, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x64, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x53, 0x44, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c,
+  0x79, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x43, 0x68, 0x65,
+  0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b,
+  0x43, 0x50, 0x50, 0x4c, 0x59, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x70, 0x72, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x33, 0x32, 0x29, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x50, 0x52, 0x4e, 0x2b, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x6c, 0x69, 0x64, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x28, 0x6e, 0x3d, 0x28, 0x73, 0x33, 0x32, 0x29,
+  0x6c, 0x69, 0x64, 0x3b, 0x6e, 0x3c, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59,
+  0x3b, 0x6e, 0x2b, 0x3d, 0x36, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
+  0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53,
+  0x54, 0x41, 0x43, 0x4b, 0x2b, 0x30, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d,
+  0x6f, 0x64, 0x65, 0x5b, 0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x43, 0x68,
+  0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70,
+  0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x31, 0x2a, 0x4d,
+  0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70,
+  0x74, 0x68, 0x5b, 0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x73,
+  0x33, 0x32, 0x29, 0x28, 0x73, 0x36, 0x34, 0x29, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x32, 0x2a, 0x4d, 0x41, 0x58,
+  0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
+  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x6e,
+  0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20,
+  0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x28, 0x73, 0x36, 0x34, 0x29,
+  0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b,
+  0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x33,
+  0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x6e, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d,
+  0x20, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x28,
+  0x73, 0x36, 0x34, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41,
+  0x43, 0x4b, 0x2b, 0x34, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b,
+  0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78,
+  0x5b, 0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x28, 0x73, 0x36,
+  0x34, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b,
+  0x2b, 0x35, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
+  0x5b, 0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x28, 0x73, 0x36, 0x34, 0x29,
+  0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b,
+  0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x36,
+  0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
+  0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e,
+  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53,
+  0x54, 0x41, 0x43, 0x4b, 0x2b, 0x37, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65,
+  0x73, 0x5b, 0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29,
+  0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b,
+  0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x38,
+  0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43,
+  0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x5d, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x28, 0x43, 0x72, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41,
+  0x43, 0x4b, 0x2b, 0x39, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b,
+  0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
+  0x79, 0x5b, 0x6e, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x31, 0x30, 0x2a, 0x4d, 0x41,
+  0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68,
+  0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x48, 0x61,
+  0x73, 0x68, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43,
+  0x4b, 0x2b, 0x31, 0x31, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b,
+  0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20,
+  0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x42, 0x45, 0x53, 0x54, 0x4d, 0x4f, 0x56, 0x45, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x29, 0x28, 0x73, 0x36, 0x34, 0x29, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42,
+  0x45, 0x53, 0x54, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x48, 0x45, 0x4c, 0x50, 0x45, 0x52, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x0a,
   0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
   0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
   0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x61,
@@ -3269,570 +4205,798 @@ const char zeta_cl[] = {
   0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
   0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f,
   0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72,
-  0x65, 0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x72, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65,
-  0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x44, 0x52, 0x41, 0x57,
-  0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x3d,
-  0x20, 0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f,
-  0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x68,
-  0x65, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x78,
-  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x41, 0x74, 0x74,
-  0x61, 0x63, 0x6b, 0x73, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45,
-  0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x20, 0x3d, 0x20,
-  0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x20, 0x20,
+  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74,
+  0x69, 0x6d, 0x65, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x20, 0x65, 0x78,
+  0x68, 0x61, 0x75, 0x73, 0x74, 0x65, 0x64, 0x2c, 0x20, 0x73, 0x61, 0x76,
+  0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x73, 0x74, 0x61,
+  0x63, 0x6b, 0x20, 0x74, 0x6f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x79, 0x69, 0x65,
+  0x6c, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62,
+  0x73, 0x75, 0x73, 0x70, 0x65, 0x6e, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x28, 0x6e, 0x3d, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c, 0x69, 0x64,
+  0x3b, 0x6e, 0x3c, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x3b, 0x6e, 0x2b,
+  0x3d, 0x36, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65,
+  0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b,
+  0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x30, 0x2a, 0x4d, 0x41,
+  0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x75, 0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
+  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x31, 0x2a, 0x4d, 0x41, 0x58,
+  0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75,
+  0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b,
+  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50,
+  0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x32, 0x2a, 0x4d, 0x41, 0x58, 0x50,
+  0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36,
+  0x34, 0x29, 0x28, 0x73, 0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53,
+  0x54, 0x41, 0x43, 0x4b, 0x2b, 0x33, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34,
+  0x29, 0x28, 0x73, 0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x6e, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x34, 0x2a,
+  0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d,
+  0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x28, 0x73, 0x36, 0x34, 0x29, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
+  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x6e, 0x2a, 0x32, 0x2b,
+  0x42, 0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43,
+  0x4b, 0x2b, 0x35, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e,
+  0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x28, 0x73,
+  0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f,
+  0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53,
+  0x54, 0x41, 0x43, 0x4b, 0x2b, 0x36, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34,
+  0x29, 0x28, 0x73, 0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
+  0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x6e,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x37, 0x2a,
+  0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d,
+  0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
+  0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x38, 0x2a,
+  0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d,
+  0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x49,
+  0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x53, 0x54, 0x41, 0x43, 0x4b, 0x2b, 0x39, 0x2a, 0x4d, 0x41, 0x58,
+  0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75,
+  0x36, 0x34, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43, 0x72, 0x48, 0x69,
+  0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53,
+  0x54, 0x41, 0x43, 0x4b, 0x2b, 0x31, 0x30, 0x2a, 0x4d, 0x41, 0x58, 0x50,
+  0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34,
+  0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54,
+  0x41, 0x43, 0x4b, 0x2b, 0x31, 0x31, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2b, 0x6e, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x50, 0x52, 0x4e, 0x2b, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34,
+  0x29, 0x70, 0x72, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x4f, 0x41,
+  0x52, 0x44, 0x2b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d,
+  0x20, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
+  0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x4f,
+  0x41, 0x52, 0x44, 0x2b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
+  0x42, 0x42, 0x50, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x4f, 0x41, 0x52,
+  0x44, 0x2b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
+  0x50, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73,
+  0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x2b,
+  0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63,
+  0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x4d, 0x5d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x75, 0x36, 0x34, 0x29, 0x73, 0x74, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x44,
+  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x73, 0x64,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68,
+  0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70,
+  0x2b, 0x43, 0x50, 0x50, 0x4c, 0x59, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75,
+  0x36, 0x34, 0x29, 0x70, 0x6c, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x45, 0x53,
+  0x54, 0x4d, 0x4f, 0x56, 0x45, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x62, 0x65, 0x73,
+  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x42, 0x45, 0x53, 0x54,
+  0x53, 0x43, 0x4f, 0x52, 0x45, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x28, 0x73, 0x36, 0x34,
+  0x29, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x68, 0x65, 0x63,
+  0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43,
+  0x50, 0x48, 0x45, 0x4c, 0x50, 0x45, 0x52, 0x5d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34,
+  0x29, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x73, 0x75, 0x73, 0x70, 0x65,
+  0x6e, 0x64, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
+  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
+  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65,
+  0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x76,
+  0x61, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x61,
+  0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x66,
+  0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x66,
+  0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f,
+  0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x4d,
+  0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x71, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x20,
   0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65,
+  0x72, 0x73, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54,
+  0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x69, 0x6e,
+  0x6e, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45,
+  0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x78,
-  0x36, 0x34, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x67, 0x65, 0x6e, 0x65, 0x72,
+  0x61, 0x74, 0x6f, 0x72, 0x20, 0x78, 0x36, 0x34, 0x20, 0x20, 0x23, 0x23,
+  0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x69, 0x74,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x30, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
-  0x65, 0x72, 0x73, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x7c, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x7c, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x20, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41,
-  0x43, 0x4b, 0x5d, 0x3a, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
-  0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x5e, 0x62, 0x62, 0x42,
-  0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x28, 0x21, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6e, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x20, 0x3d,
+  0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31,
+  0x5d, 0x7c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
+  0x32, 0x5d, 0x7c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
+  0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d,
+  0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x20,
+  0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
+  0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3a, 0x28, 0x62,
   0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43,
-  0x4b, 0x5d, 0x3a, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
-  0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x5e, 0x62, 0x62, 0x42, 0x6c,
-  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x65, 0x64, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x4d, 0x65, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
-  0x42, 0x50, 0x31, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
-  0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67,
-  0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x66, 0x69, 0x72,
-  0x73, 0x74, 0x31, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x61, 0x6c,
-  0x63, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x67, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6e, 0x6e,
-  0x65, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x73, 0x75, 0x70,
-  0x65, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x72, 0x6f, 0x6f, 0x6b,
-  0x73, 0x20, 0x6e, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x73, 0x20, 0x76,
-  0x69, 0x61, 0x20, 0x64, 0x75, 0x6d, 0x62, 0x37, 0x66, 0x69, 0x6c, 0x6c,
+  0x4b, 0x5d, 0x5e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72,
+  0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4f, 0x70,
+  0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x21,
+  0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
+  0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3a, 0x28, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b,
+  0x5d, 0x5e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
+  0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67,
+  0x65, 0x74, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x65, 0x64, 0x20, 0x6b,
+  0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26,
+  0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65,
+  0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67,
+  0x20, 0x3d, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x63, 0x61, 0x6c, 0x63, 0x20, 0x73, 0x75, 0x70, 0x65,
+  0x72, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x67, 0x65,
+  0x74, 0x20, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x70, 0x69, 0x65,
+  0x63, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67,
+  0x65, 0x74, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x6b, 0x69, 0x6e, 0x67,
+  0x2c, 0x20, 0x72, 0x6f, 0x6f, 0x6b, 0x73, 0x20, 0x6e, 0x20, 0x71, 0x75,
+  0x65, 0x65, 0x6e, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x64, 0x75, 0x6d,
+  0x62, 0x37, 0x66, 0x69, 0x6c, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d,
+  0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c,
+  0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49,
+  0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
+  0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
+  0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42,
+  0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20,
+  0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
+  0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20,
-  0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d,
-  0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42,
-  0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x31,
-  0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49,
-  0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c,
+  0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20,
+  0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20,
+  0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d,
+  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54,
+  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e,
+  0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
+  0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e,
+  0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48,
+  0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55,
+  0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
+  0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
+  0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
+  0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
+  0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x26, 0x3d, 0x20,
+  0x28, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x28, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d,
+  0x29, 0x29, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x62,
+  0x62, 0x4f, 0x70, 0x70, 0x26, 0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x29,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65,
+  0x74, 0x20, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x70, 0x69, 0x65,
+  0x63, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c,
+  0x65, 0x20, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x71, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x70, 0x6f, 0x70, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x31, 0x28, 0x26, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x49, 0x6e, 0x42, 0x65, 0x74,
+  0x77, 0x65, 0x65, 0x6e, 0x5b, 0x73, 0x71, 0x74, 0x6f, 0x2a, 0x36, 0x34,
+  0x2b, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x5d, 0x26, 0x62, 0x62, 0x42,
+  0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x31, 0x73, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3d, 0x3d,
+  0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
+  0x20, 0x73, 0x75, 0x70, 0x65, 0x72, 0x6b, 0x69, 0x6e, 0x67, 0x2c, 0x20,
+  0x62, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x73, 0x20, 0x6e, 0x20, 0x71, 0x75,
+  0x65, 0x65, 0x6d, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x64, 0x75, 0x6d,
+  0x62, 0x37, 0x66, 0x69, 0x6c, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d,
+  0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c,
+  0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49,
+  0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
+  0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
+  0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20,
+  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42,
+  0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20,
+  0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e,
+  0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62,
+  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
+  0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
+  0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
+  0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c,
+  0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26,
+  0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45,
   0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
   0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53,
   0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b,
   0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
   0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
   0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
   0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38,
+  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39,
   0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
   0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20,
+  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20,
   0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
   0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
   0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
   0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38,
+  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39,
   0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20,
+  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20,
   0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x3c, 0x3c, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46,
-  0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48,
-  0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42,
-  0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+  0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f,
+  0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42,
+  0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54,
+  0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
+  0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
+  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26,
+  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
+  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20,
+  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
+  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26,
+  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
+  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20,
+  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c,
+  0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26,
+  0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
+  0x20, 0x26, 0x3d, 0x20, 0x28, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26,
+  0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
+  0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
+  0x42, 0x50, 0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
+  0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x20, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7c, 0x20, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x28, 0x7e,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d,
+  0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32,
+  0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
+  0x33, 0x5d, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6e, 0x6e, 0x65,
+  0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x62, 0x62, 0x57, 0x6f,
+  0x72, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x70,
+  0x6f, 0x70, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x26, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62,
+  0x49, 0x6e, 0x42, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x5b, 0x73, 0x71,
+  0x74, 0x6f, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67,
+  0x5d, 0x26, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x29, 0x3d, 0x3d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64,
+  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f,
+  0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x6f, 0x70, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x65, 0x20, 0x61, 0x74,
+  0x74, 0x61, 0x63, 0x6b, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49,
+  0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c,
+  0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c,
+  0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20,
+  0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x64, 0x75, 0x6d, 0x62, 0x37, 0x66, 0x69, 0x6c,
+  0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x38, 0x20, 0x64, 0x69, 0x72, 0x65,
+  0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c,
+  0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62,
+  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62,
+  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69,
+  0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54,
+  0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
+  0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42,
+  0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
+  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20,
+  0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
+  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26,
+  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
+  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20,
+  0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
+  0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26,
+  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x70, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e,
+  0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f,
+  0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a,
+  0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
+  0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
+  0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42,
+  0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f,
+  0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
   0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
+  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
   0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
   0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
   0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
   0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31,
   0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
   0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
+  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
   0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
   0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
   0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
   0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31,
+  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31,
   0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
-  0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a,
+  0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
+  0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20,
-  0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41,
+  0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74,
+  0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
+  0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
+  0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
+  0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d,
+  0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62,
+  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54,
+  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
+  0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
+  0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
+  0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x37, 0x29,
+  0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c,
+  0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d,
+  0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f,
+  0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c,
+  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41,
   0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x38,
-  0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x28, 0x62, 0x62, 0x4f, 0x70,
-  0x70, 0x26, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
-  0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
-  0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x20, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7c, 0x20, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x28,
-  0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31,
-  0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
-  0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
-  0x50, 0x33, 0x5d, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x70, 0x69, 0x6e, 0x6e,
-  0x65, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x62, 0x62, 0x57,
-  0x6f, 0x72, 0x6b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x3d, 0x20,
-  0x70, 0x6f, 0x70, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x26, 0x62,
-  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x49, 0x6e, 0x42, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x5b, 0x73,
-  0x71, 0x74, 0x6f, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x71, 0x6b, 0x69, 0x6e,
-  0x67, 0x5d, 0x26, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72,
-  0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x29, 0x3d, 0x3d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65,
-  0x64, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x73, 0x75, 0x70, 0x65, 0x72,
-  0x6b, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x62, 0x69, 0x73, 0x68, 0x6f, 0x70,
-  0x73, 0x20, 0x6e, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6d, 0x73, 0x20, 0x76,
-  0x69, 0x61, 0x20, 0x64, 0x75, 0x6d, 0x62, 0x37, 0x66, 0x69, 0x6c, 0x6c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20,
-  0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d,
-  0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42,
-  0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x39,
-  0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49,
-  0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20,
-  0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c,
-  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
   0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71,
-  0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53,
+  0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
   0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
   0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20,
-  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
   0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26,
   0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
   0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
   0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
   0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
   0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20,
-  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
-  0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26,
+  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26,
   0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e,
-  0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x42,
-  0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f,
-  0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
-  0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x3b, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
-  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20,
-  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
-  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
-  0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
-  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20,
-  0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
-  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
-  0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20,
-  0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20,
-  0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x20, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d,
-  0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
-  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x53, 0x45,
-  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69,
-  0x6e, 0x67, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
+  0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f,
+  0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20,
+  0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50,
+  0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c,
+  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42,
+  0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d,
+  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67,
+  0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72,
+  0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46,
+  0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
+  0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c,
+  0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
   0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
   0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e,
-  0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
   0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
   0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29,
   0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
   0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62,
   0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
   0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
   0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e,
-  0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
   0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
   0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29,
   0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62,
   0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
   0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e,
-  0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54,
-  0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x28,
-  0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29,
-  0x29, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x20, 0x28, 0x62, 0x62,
-  0x4f, 0x70, 0x70, 0x26, 0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x29, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
-  0x20, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63,
-  0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65,
-  0x20, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71,
-  0x74, 0x6f, 0x20, 0x3d, 0x20, 0x70, 0x6f, 0x70, 0x66, 0x69, 0x72, 0x73,
-  0x74, 0x31, 0x28, 0x26, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x49, 0x6e, 0x42, 0x65, 0x74, 0x77,
-  0x65, 0x65, 0x6e, 0x5b, 0x73, 0x71, 0x74, 0x6f, 0x2a, 0x36, 0x34, 0x2b,
-  0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x5d, 0x26, 0x62, 0x62, 0x42, 0x6c,
-  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31,
-  0x73, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3d, 0x3d, 0x31,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e, 0x65,
-  0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x70, 0x70, 0x6f, 0x73,
-  0x69, 0x74, 0x65, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x20, 0x3d,
-  0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x20, 0x3d, 0x20,
-  0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72,
-  0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54,
-  0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x75,
-  0x6d, 0x62, 0x37, 0x66, 0x69, 0x6c, 0x6c, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x38, 0x20, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20,
-  0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74,
-  0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
-  0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
-  0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d,
-  0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
-  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62,
-  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54,
-  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29,
-  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
-  0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29,
-  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
-  0x3c, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x39, 0x29,
-  0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c,
-  0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d,
-  0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f,
-  0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c,
-  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49,
-  0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26,
-  0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69,
-  0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54,
+  0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62,
+  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28,
+  0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53,
+  0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b,
+  0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f,
+  0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
+  0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
+  0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
   0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
   0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
   0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20,
   0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62,
   0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
+  0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
   0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
   0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c,
+  0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e,
   0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
-  0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20,
+  0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20,
   0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62,
-  0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c,
-  0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41,
-  0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62,
-  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62,
-  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45,
-  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69,
-  0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54,
-  0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
-  0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42,
-  0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20,
-  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
-  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26,
-  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20,
-  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
-  0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26,
-  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x3c, 0x3c, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e,
-  0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28,
-  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f,
-  0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a,
-  0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
-  0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
-  0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63,
-  0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
-  0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
-  0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29,
-  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
-  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c,
-  0x3c, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x38, 0x29,
-  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42,
+  0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20,
   0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29,
   0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
@@ -3840,865 +5004,786 @@ const char zeta_cl[] = {
   0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28,
   0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42,
-  0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20,
+  0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20,
   0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c,
   0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41,
   0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
   0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26,
   0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
   0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
   0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
   0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
   0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20,
-  0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
   0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26,
+  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26,
   0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
   0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
+  0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
   0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
   0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20,
-  0x39, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
+  0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c,
   0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x39, 0x29, 0x20, 0x26,
-  0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45, 0x3b,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26,
+  0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b,
   0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20,
   0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73,
   0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
   0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63,
   0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
   0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x26,
-  0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49, 0x4c, 0x45,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45,
-  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d,
-  0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31,
-  0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
-  0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x31,
-  0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x48, 0x46, 0x49,
-  0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
-  0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x42, 0x6c,
-  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28, 0x62, 0x62, 0x42,
-  0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53, 0x45, 0x54, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67,
-  0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x50, 0x72,
-  0x6f, 0x20, 0x26, 0x3d, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54, 0x41, 0x46,
-  0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73,
-  0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c,
-  0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e,
-  0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62,
+  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54,
+  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29,
+  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
+  0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
+  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
+  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e,
+  0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
   0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
   0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29,
+  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29,
   0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
   0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
-  0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e,
-  0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
-  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20,
-  0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29,
-  0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47,
-  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x62,
+  0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62,
   0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e,
-  0x3e, 0x20, 0x37, 0x29, 0x20, 0x26, 0x20, 0x42, 0x42, 0x4e, 0x4f, 0x54,
-  0x41, 0x46, 0x49, 0x4c, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x50, 0x72, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f,
-  0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x7e, 0x62,
-  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x3a, 0x7e, 0x28,
-  0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x5e, 0x53,
-  0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b,
-  0x69, 0x6e, 0x67, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65,
-  0x6e, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
-  0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42,
-  0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20,
-  0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
-  0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26,
-  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
-  0x47, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e,
-  0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50,
-  0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20,
-  0x3d, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20,
-  0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c,
-  0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62,
-  0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x20, 0x26,
-  0x20, 0x62, 0x62, 0x50, 0x72, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x3e, 0x3e, 0x20, 0x38, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72,
-  0x20, 0x6b, 0x6e, 0x69, 0x67, 0x68, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x47, 0x65, 0x6e, 0x20, 0x3e,
+  0x3e, 0x20, 0x38, 0x29, 0x20, 0x26, 0x20, 0x62, 0x62, 0x50, 0x72, 0x6f,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
+  0x20, 0x7c, 0x3d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x20, 0x38, 0x29,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x6b, 0x6e, 0x69, 0x67, 0x68,
+  0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
+  0x6b, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
+  0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x4b,
+  0x4e, 0x49, 0x47, 0x48, 0x54, 0x29, 0x3f, 0x42, 0x42, 0x46, 0x55, 0x4c,
+  0x4c, 0x3a, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20,
+  0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f,
+  0x28, 0x73, 0x33, 0x32, 0x29, 0x73, 0x74, 0x6d, 0x3a, 0x28, 0x73, 0x33,
+  0x32, 0x29, 0x21, 0x73, 0x74, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x29, 0x3f, 0x6e, 0x3a,
   0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72,
-  0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x4b, 0x4e, 0x49, 0x47, 0x48, 0x54, 0x29,
-  0x3f, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3a, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76,
-  0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72,
-  0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d,
-  0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x28, 0x73, 0x33, 0x32, 0x29, 0x73,
-  0x74, 0x6d, 0x3a, 0x28, 0x73, 0x33, 0x32, 0x29, 0x21, 0x73, 0x74, 0x6d,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50,
-  0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41,
-  0x57, 0x4e, 0x29, 0x3f, 0x6e, 0x3a, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
-  0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d,
-  0x20, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x54, 0x61, 0x62, 0x6c, 0x65,
-  0x73, 0x5b, 0x6e, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29,
-  0x6c, 0x69, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c,
-  0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x28, 0x62, 0x62,
-  0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26,
-  0x62, 0x62, 0x4f, 0x70, 0x70, 0x29, 0x3a, 0x28, 0x62, 0x62, 0x4d, 0x61,
-  0x73, 0x6b, 0x26, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3b, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d,
-  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x23,
-  0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63,
-  0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f,
-  0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f,
-  0x6d, 0x69, 0x63, 0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f,
-  0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
-  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x70, 0x70, 0x20, 0x61, 0x74,
-  0x74, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6f, 0x72, 0x28, 0x26, 0x62,
-  0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x28, 0x63,
-  0x6f, 0x6c, 0x6f, 0x72, 0x21, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62,
-  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50,
-  0x54, 0x59, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67,
-  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x78, 0x36,
-  0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6f,
-  0x72, 0x28, 0x26, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72,
-  0x73, 0x2c, 0x20, 0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26,
-  0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71,
-  0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x3f, 0x53, 0x45, 0x54, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3a, 0x42, 0x42,
-  0x45, 0x4d, 0x50, 0x54, 0x59, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x78, 0x36, 0x34,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x62, 0x4d,
-  0x6f, 0x76, 0x65, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
-  0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x23,
-  0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
-  0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20,
-  0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x21, 0x3d, 0x73, 0x74, 0x6d, 0x29,
-  0x3f, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x3a, 0x42, 0x42, 0x45,
-  0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63,
-  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6f, 0x70, 0x70, 0x20, 0x61,
-  0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36,
-  0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73,
-  0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b,
-  0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72,
-  0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41,
-  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
+  0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d,
+  0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x41, 0x74, 0x74, 0x61, 0x63,
+  0x6b, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x5b, 0x6e, 0x2a, 0x36, 0x34,
+  0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c, 0x69, 0x64, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20,
+  0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74,
+  0x6d, 0x29, 0x3f, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x29,
+  0x3a, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f,
+  0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64,
+  0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x26,
+  0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f,
+  0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20,
+  0x6f, 0x70, 0x70, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x20,
+  0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d,
+  0x5f, 0x6f, 0x72, 0x28, 0x26, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63,
+  0x6b, 0x73, 0x2c, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x21, 0x3d,
+  0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73,
+  0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
+  0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x65, 0x72, 0x73, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6f, 0x72, 0x28, 0x26, 0x62, 0x62, 0x43,
+  0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x2c, 0x20, 0x28, 0x62, 0x62,
+  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29,
+  0x3f, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c,
+  0x69, 0x64, 0x29, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x29,
   0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
   0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65,
-  0x72, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70,
-  0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x42, 0x42,
-  0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x72, 0x73, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
   0x66, 0x20, 0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26, 0x53,
   0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x6b,
-  0x69, 0x6e, 0x67, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34,
-  0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63,
-  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x78, 0x31, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d,
-  0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69,
-  0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b,
-  0x65, 0x72, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70,
-  0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
-  0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65,
-  0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f,
-  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x20, 0x63,
-  0x68, 0x65, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 0x6f,
-  0x74, 0x6b, 0x69, 0x63, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x43, 0x68,
-  0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65,
-  0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x4c, 0x4d, 0x52, 0x2c, 0x20, 0x6e, 0x6f, 0x20,
-  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x67, 0x69, 0x76, 0x69, 0x6e, 0x67,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x72,
-  0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x29, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b,
-  0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b,
-  0x3d, 0x20, 0x4c, 0x4d, 0x52, 0x52, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x20,
-  0x5e, 0x3d, 0x20, 0x4c, 0x4d, 0x52, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x65, 0x78,
-  0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e,
-  0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
-  0x26, 0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x47, 0x45, 0x54,
-  0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52,
-  0x4f, 0x4d, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65,
-  0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31,
-  0x5d, 0x29, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47,
-  0x45, 0x54, 0x50, 0x54, 0x4f, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
-  0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73,
-  0x64, 0x2d, 0x31, 0x5d, 0x29, 0x29, 0x3d, 0x3d, 0x51, 0x55, 0x45, 0x45,
-  0x4e, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64,
-  0x5d, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x45, 0x58,
-  0x54, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+  0x69, 0x6e, 0x67, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x71, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x3d, 0x20,
+  0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c,
+  0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x21, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62, 0x62, 0x4d, 0x6f, 0x76,
+  0x65, 0x73, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
+  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74,
+  0x20, 0x6f, 0x70, 0x70, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73,
+  0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69,
+  0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x41,
+  0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x62, 0x62,
+  0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
   0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
-  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x71, 0x75,
-  0x69, 0x65, 0x73, 0x63, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x73, 0x65, 0x61,
-  0x72, 0x63, 0x68, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x71, 0x73, 0x20,
-  0x3d, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74,
-  0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3c, 0x3d, 0x30, 0x29, 0x3f, 0x74, 0x72,
-  0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79,
-  0x20, 0x6e, 0x6f, 0x6e, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
-  0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50,
-  0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41,
-  0x57, 0x4e, 0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x41, 0x74,
-  0x74, 0x61, 0x63, 0x6b, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x50, 0x61,
-  0x77, 0x6e, 0x50, 0x75, 0x73, 0x68, 0x65, 0x73, 0x5b, 0x73, 0x74, 0x6d,
-  0x2a, 0x36, 0x34, 0x2b, 0x6c, 0x69, 0x64, 0x5d, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3a, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x7c, 0x3d, 0x20,
-  0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x26,
-  0x26, 0x21, 0x71, 0x73, 0x29, 0x3f, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73,
-  0x6b, 0x26, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x7e, 0x62, 0x62,
-  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3a, 0x42, 0x42,
-  0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x20, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20,
-  0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76,
-  0x65, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d,
-  0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65,
-  0x73, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e,
-  0x74, 0x31, 0x73, 0x28, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65,
-  0x72, 0x73, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x2c, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74,
-  0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x6e, 0x3e, 0x3d, 0x32, 0x26,
-  0x26, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66,
-  0x72, 0x6f, 0x6d, 0x29, 0x21, 0x3d, 0x4b, 0x49, 0x4e, 0x47, 0x29, 0x3f,
-  0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20,
-  0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x29, 0x3f, 0x42, 0x42, 0x45,
-  0x4d, 0x50, 0x54, 0x59, 0x3a, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x70, 0x69, 0x6e, 0x6e, 0x65,
-  0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x45, 0x54,
-  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x26,
-  0x62, 0x62, 0x50, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x29, 0x3f, 0x74, 0x72,
-  0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x26, 0x3d,
-  0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x29, 0x3f, 0x62, 0x62, 0x4c, 0x69,
-  0x6e, 0x65, 0x5b, 0x6c, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x71,
-  0x6b, 0x69, 0x6e, 0x67, 0x5d, 0x3a, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
-  0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x6f, 0x70, 0x70, 0x20, 0x61, 0x74, 0x74, 0x61,
-  0x63, 0x6b, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62,
-  0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45,
-  0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x4b, 0x49, 0x4e,
-  0x47, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73,
-  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76,
-  0x65, 0x73, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x29,
-  0x3f, 0x7e, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x3a,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64,
+  0x5d, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x62, 0x4d,
+  0x6f, 0x76, 0x65, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
+  0x42, 0x42, 0x28, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x29, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x71, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x3d, 0x20,
+  0x6c, 0x69, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20,
+  0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28,
+  0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
+  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74,
+  0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65,
+  0x72, 0x73, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74,
+  0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b,
+  0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x7c, 0x3d,
+  0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x20, 0x3d,
+  0x20, 0x28, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73,
+  0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4c, 0x4d,
+  0x52, 0x2c, 0x20, 0x6e, 0x6f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x67, 0x69, 0x76, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64,
+  0x3d, 0x3d, 0x30, 0x26, 0x26, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63,
+  0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
+  0x26, 0x4c, 0x4d, 0x52, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x3d, 0x20, 0x4c, 0x4d, 0x52, 0x52,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x20, 0x5e, 0x3d, 0x20, 0x4c, 0x4d, 0x52,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b,
+  0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
+  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x20, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x73, 0x69, 0x6f,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69,
+  0x64, 0x3d, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74,
+  0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x51, 0x53, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69,
+  0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x28, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
+  0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
+  0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x29, 0x29, 0x3d, 0x3d, 0x50,
+  0x41, 0x57, 0x4e, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x47, 0x45, 0x54, 0x50,
+  0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x4f, 0x28,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x29, 0x29,
+  0x3d, 0x3d, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
+  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x2b, 0x2b, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f,
+  0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d,
+  0x20, 0x7c, 0x3d, 0x20, 0x45, 0x58, 0x54, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72,
+  0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41,
+  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e,
+  0x74, 0x65, 0x72, 0x20, 0x71, 0x75, 0x69, 0x65, 0x73, 0x63, 0x65, 0x6e,
+  0x63, 0x65, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x3f, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x71, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3c,
+  0x3d, 0x30, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c,
+  0x73, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x6e, 0x6f, 0x6e, 0x20, 0x63,
+  0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x29, 0x3f, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x28, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x54, 0x61,
+  0x62, 0x6c, 0x65, 0x73, 0x50, 0x61, 0x77, 0x6e, 0x50, 0x75, 0x73, 0x68,
+  0x65, 0x73, 0x5b, 0x73, 0x74, 0x6d, 0x2a, 0x36, 0x34, 0x2b, 0x6c, 0x69,
+  0x64, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x62, 0x62, 0x4d, 0x61,
+  0x73, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f,
+  0x76, 0x65, 0x73, 0x7c, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x26, 0x26, 0x21, 0x71, 0x73, 0x29, 0x3f,
+  0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x57, 0x6f,
+  0x72, 0x6b, 0x26, 0x7e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
+  0x72, 0x73, 0x29, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b,
+  0x20, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x78,
+  0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f,
+  0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x28,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d, 0x73, 0x74, 0x6d, 0x29, 0x3f,
+  0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x3a, 0x42, 0x42, 0x45, 0x4d,
+  0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20,
+  0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x62,
+  0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c,
+  0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x2c, 0x20, 0x6b, 0x69, 0x6e,
+  0x67, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20,
+  0x28, 0x6e, 0x3e, 0x3d, 0x32, 0x26, 0x26, 0x47, 0x45, 0x54, 0x50, 0x54,
+  0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x21, 0x3d,
+  0x4b, 0x49, 0x4e, 0x47, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66,
+  0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70,
+  0x62, 0x29, 0x3f, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3a, 0x62,
+  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72,
+  0x20, 0x70, 0x69, 0x6e, 0x6e, 0x65, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63,
+  0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20,
+  0x3d, 0x20, 0x28, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42,
+  0x28, 0x6c, 0x69, 0x64, 0x29, 0x26, 0x62, 0x62, 0x50, 0x69, 0x6e, 0x6e,
+  0x65, 0x64, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c,
+  0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f,
+  0x76, 0x65, 0x73, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62,
+  0x29, 0x3f, 0x62, 0x62, 0x4c, 0x69, 0x6e, 0x65, 0x5b, 0x6c, 0x69, 0x64,
+  0x2a, 0x36, 0x34, 0x2b, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x5d, 0x3a,
   0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72,
-  0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62,
-  0x20, 0x3d, 0x20, 0x28, 0x6e, 0x3d, 0x3d, 0x31, 0x26, 0x26, 0x47, 0x45,
+  0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6f, 0x70,
+  0x70, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45,
   0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d,
-  0x29, 0x21, 0x3d, 0x4b, 0x49, 0x4e, 0x47, 0x29, 0x3f, 0x74, 0x72, 0x75,
+  0x29, 0x3d, 0x3d, 0x4b, 0x49, 0x4e, 0x47, 0x29, 0x3f, 0x74, 0x72, 0x75,
   0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x26, 0x3d, 0x20,
-  0x28, 0x74, 0x6d, 0x70, 0x62, 0x29, 0x3f, 0x28, 0x62, 0x62, 0x49, 0x6e,
-  0x42, 0x65, 0x74, 0x77, 0x65, 0x65, 0x6e, 0x5b, 0x73, 0x71, 0x63, 0x68,
-  0x65, 0x63, 0x6b, 0x65, 0x72, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x71, 0x6b,
-  0x69, 0x6e, 0x67, 0x5d, 0x7c, 0x62, 0x62, 0x43, 0x68, 0x65, 0x63, 0x6b,
-  0x65, 0x72, 0x73, 0x29, 0x3a, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e,
-  0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x2c, 0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a,
-  0x20, 0x72, 0x65, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74,
-  0x20, 0x61, 0x73, 0x20, 0x78, 0x36, 0x34, 0x3f, 0x0a, 0x20, 0x20, 0x20,
+  0x28, 0x74, 0x6d, 0x70, 0x62, 0x29, 0x3f, 0x7e, 0x62, 0x62, 0x41, 0x74,
+  0x74, 0x61, 0x63, 0x6b, 0x73, 0x3a, 0x42, 0x42, 0x46, 0x55, 0x4c, 0x4c,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c,
+  0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x6e, 0x3d,
+  0x3d, 0x31, 0x26, 0x26, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45,
+  0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x21, 0x3d, 0x4b, 0x49, 0x4e,
+  0x47, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76,
+  0x65, 0x73, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x29,
+  0x3f, 0x28, 0x62, 0x62, 0x49, 0x6e, 0x42, 0x65, 0x74, 0x77, 0x65, 0x65,
+  0x6e, 0x5b, 0x73, 0x71, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x2a,
+  0x36, 0x34, 0x2b, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x5d, 0x7c, 0x62,
+  0x62, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3a, 0x42,
+  0x42, 0x46, 0x55, 0x4c, 0x4c, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61,
+  0x73, 0x73, 0x61, 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x2c,
+  0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x72, 0x65, 0x69, 0x6d, 0x70,
+  0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x73, 0x20, 0x78, 0x36,
+  0x34, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x64, 0x6f, 0x75, 0x62,
+  0x6c, 0x65, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x20, 0x70, 0x75, 0x73, 0x68,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20,
+  0x20, 0x3d, 0x20, 0x7e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43, 0x72, 0x48,
+  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x26,
+  0x3d, 0x20, 0x30, 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46,
+  0x46, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x71, 0x65, 0x70, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3f, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x31, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3a,
+  0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x73, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20,
+  0x3d, 0x20, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x28, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x7e,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d,
+  0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6f, 0x75,
+  0x72, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x73,
+  0x74, 0x6d, 0x29, 0x3f, 0x30, 0x78, 0x46, 0x46, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x55, 0x4c, 0x3a, 0x30, 0x78, 0x46, 0x46, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x55, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20, 0x62,
+  0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x28, 0x53, 0x45, 0x54, 0x4d, 0x41,
+  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x65, 0x70, 0x2b, 0x31, 0x29,
+  0x7c, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
+  0x71, 0x65, 0x70, 0x2d, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x77,
-  0x6e, 0x20, 0x70, 0x75, 0x73, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20, 0x7e, 0x6c, 0x6f,
+  0x72, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73, 0x73, 0x61, 0x6e, 0x74,
+  0x20, 0x70, 0x61, 0x77, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x26, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x73,
+  0x71, 0x65, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
+  0x63, 0x70, 0x74, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54,
+  0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c,
+  0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x20, 0x73, 0x71, 0x65, 0x70,
+  0x2d, 0x38, 0x3a, 0x73, 0x71, 0x65, 0x70, 0x2b, 0x38, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x61, 0x63, 0x6b,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x33,
+  0x32, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d,
+  0x41, 0x4b, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x28, 0x28, 0x4d, 0x6f, 0x76,
+  0x65, 0x29, 0x6c, 0x69, 0x64, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65,
+  0x29, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65,
+  0x29, 0x73, 0x71, 0x63, 0x70, 0x74, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76,
+  0x65, 0x29, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2c, 0x20, 0x28, 0x4d, 0x6f,
+  0x76, 0x65, 0x29, 0x70, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76,
+  0x65, 0x29, 0x70, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x71,
+  0x75, 0x69, 0x63, 0x6b, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6b, 0x69, 0x63, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72,
+  0x65, 0x75, 0x6e, 0x64, 0x65, 0x72, 0x61, 0x74, 0x74, 0x61, 0x63, 0x6b,
+  0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x21, 0x73, 0x74, 0x6d,
+  0x2c, 0x20, 0x67, 0x65, 0x74, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x71, 0x28,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x73, 0x74, 0x6d, 0x29, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x6e, 0x64, 0x6f,
+  0x6d, 0x6f, 0x76, 0x65, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x28, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x6b,
+  0x69, 0x63, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f,
+  0x76, 0x65, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41,
+  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e,
+  0x20, 0x63, 0x61, 0x73, 0x6c, 0x74, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x73, 0x2c, 0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x73, 0x70, 0x65,
+  0x65, 0x64, 0x75, 0x70, 0x2c, 0x20, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x72,
+  0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x73, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x6c, 0x6f,
   0x63, 0x61, 0x6c, 0x43, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
-  0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x26, 0x3d, 0x20, 0x30, 0x78, 0x30, 0x30,
-  0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x46, 0x46, 0x30, 0x30, 0x30, 0x30,
-  0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x65, 0x70,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x29, 0x3f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x29, 0x3a, 0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
-  0x70, 0x61, 0x77, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x4d, 0x65,
-  0x26, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
-  0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
-  0x42, 0x50, 0x32, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
-  0x67, 0x65, 0x74, 0x20, 0x6f, 0x75, 0x72, 0x20, 0x70, 0x61, 0x77, 0x6e,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
-  0x20, 0x26, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x30, 0x78,
-  0x46, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x55, 0x4c, 0x3a, 0x30,
-  0x78, 0x46, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x55,
-  0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26,
-  0x28, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
-  0x71, 0x65, 0x70, 0x2b, 0x31, 0x29, 0x7c, 0x53, 0x45, 0x54, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x65, 0x70, 0x2d, 0x31, 0x29,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68,
-  0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6e, 0x20, 0x70,
-  0x61, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x73,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x6f, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x65, 0x70, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74,
-  0x6f, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x6d, 0x29,
-  0x3f, 0x20, 0x73, 0x71, 0x65, 0x70, 0x2d, 0x38, 0x3a, 0x73, 0x71, 0x65,
-  0x70, 0x2b, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
-  0x69, 0x6e, 0x74, 0x6f, 0x20, 0x33, 0x32, 0x20, 0x62, 0x69, 0x74, 0x73,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x4d, 0x4f, 0x56,
-  0x45, 0x28, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x6c, 0x69, 0x64, 0x2c,
-  0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x73, 0x71, 0x74, 0x6f, 0x2c,
-  0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x73, 0x71, 0x63, 0x70, 0x74,
-  0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x66, 0x72, 0x6f,
-  0x6d, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x74, 0x6f,
-  0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x63, 0x70, 0x74,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x6c, 0x65, 0x67, 0x61, 0x6c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20,
-  0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64,
-  0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x71, 0x75, 0x69, 0x63, 0x6b, 0x28, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6b, 0x69, 0x63, 0x20, 0x3d,
-  0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x75, 0x6e, 0x64, 0x65, 0x72,
-  0x61, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x2c, 0x20, 0x21, 0x73, 0x74, 0x6d, 0x2c, 0x20, 0x67, 0x65, 0x74, 0x6b,
-  0x69, 0x6e, 0x67, 0x73, 0x71, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c,
-  0x20, 0x73, 0x74, 0x6d, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x71, 0x75,
-  0x69, 0x63, 0x6b, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x21, 0x6b, 0x69, 0x63, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x7c, 0x3d,
-  0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73,
-  0x71, 0x74, 0x6f, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e, 0x20, 0x63, 0x61, 0x73, 0x6c, 0x74,
-  0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x2c, 0x20, 0x54, 0x4f, 0x44,
-  0x4f, 0x3a, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x75, 0x70, 0x2c, 0x20,
-  0x6c, 0x65, 0x73, 0x73, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65,
-  0x72, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43, 0x72, 0x48,
-  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20,
-  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c,
-  0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x76, 0x69, 0x61,
-  0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64,
-  0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x67, 0x65, 0x6e, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6e,
-  0x73, 0x69, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70,
-  0x62, 0x20, 0x3d, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x73, 0x71,
-  0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x71, 0x73, 0x0a, 0x20,
+  0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
+  0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68,
+  0x74, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e, 0x20,
+  0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x6c,
+  0x69, 0x64, 0x3d, 0x3d, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x26, 0x53, 0x4d, 0x43,
-  0x52, 0x41, 0x4c, 0x4c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x28, 0x73, 0x74,
-  0x6d, 0x26, 0x26, 0x28, 0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b,
-  0x51, 0x29, 0x3d, 0x3d, 0x53, 0x4d, 0x43, 0x52, 0x42, 0x4c, 0x41, 0x43,
-  0x4b, 0x51, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x28,
-  0x21, 0x73, 0x74, 0x6d, 0x26, 0x26, 0x28, 0x28, 0x28, 0x7e, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x57, 0x48,
-  0x49, 0x54, 0x45, 0x51, 0x29, 0x3d, 0x3d, 0x53, 0x4d, 0x43, 0x52, 0x57,
-  0x48, 0x49, 0x54, 0x45, 0x51, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f,
-  0x6b, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20,
-  0x28, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64, 0x2d, 0x34, 0x29, 0x3d,
-  0x3d, 0x4d, 0x41, 0x4b, 0x45, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x52,
-  0x4f, 0x4f, 0x4b, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52,
-  0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x29, 0x29, 0x3f, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a,
-  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
-  0x20, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63,
-  0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
-  0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x31, 0x29, 0x29, 0x0a, 0x20,
+  0x26, 0x21, 0x71, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x41, 0x4c, 0x4c, 0x29, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7c, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
-  0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x32, 0x29, 0x29, 0x0a, 0x20, 0x20,
+  0x26, 0x26, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x26, 0x26, 0x28, 0x28, 0x28,
+  0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43,
+  0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x51, 0x29, 0x3d, 0x3d, 0x53, 0x4d,
+  0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x51, 0x29, 0x29, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7c, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
-  0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42,
-  0x28, 0x6c, 0x69, 0x64, 0x2d, 0x33, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65,
-  0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x73, 0x71,
-  0x75, 0x61, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x68, 0x65,
-  0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x3d, 0x20, 0x20, 0x28, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61,
-  0x63, 0x6b, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c,
-  0x28, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x26, 0x53,
+  0x20, 0x20, 0x20, 0x7c, 0x7c, 0x28, 0x21, 0x73, 0x74, 0x6d, 0x26, 0x26,
+  0x28, 0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26,
+  0x53, 0x4d, 0x43, 0x52, 0x57, 0x48, 0x49, 0x54, 0x45, 0x51, 0x29, 0x3d,
+  0x3d, 0x53, 0x4d, 0x43, 0x52, 0x57, 0x48, 0x49, 0x54, 0x45, 0x51, 0x29,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65,
+  0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x6b, 0x20, 0x70, 0x72, 0x65, 0x73,
+  0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
+  0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x49,
+  0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c,
+  0x69, 0x64, 0x2d, 0x34, 0x29, 0x3d, 0x3d, 0x4d, 0x41, 0x4b, 0x45, 0x50,
+  0x49, 0x45, 0x43, 0x45, 0x28, 0x52, 0x4f, 0x4f, 0x4b, 0x2c, 0x47, 0x45,
+  0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d,
+  0x29, 0x29, 0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x75,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20,
+  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x28,
+  0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53,
   0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64,
   0x2d, 0x31, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x28, 0x62,
+  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d,
+  0x32, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x28, 0x62, 0x62,
-  0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x32, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20,
-  0x7c, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x26, 0x26, 0x21, 0x62, 0x62, 0x4d, 0x61, 0x73,
-  0x6b, 0x26, 0x26, 0x21, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3f,
-  0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69,
-  0x64, 0x2d, 0x32, 0x29, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43, 0x72, 0x48,
-  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20,
-  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c,
-  0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x20, 0x76, 0x69, 0x61,
-  0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64,
-  0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x67, 0x65, 0x6e, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x73,
-  0x69, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62,
-  0x20, 0x3d, 0x20, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x73, 0x71,
-  0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x71, 0x73, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x26, 0x53,
-  0x4d, 0x43, 0x52, 0x41, 0x4c, 0x4c, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28,
-  0x28, 0x73, 0x74, 0x6d, 0x26, 0x26, 0x28, 0x28, 0x28, 0x7e, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x42, 0x4c,
-  0x41, 0x43, 0x4b, 0x4b, 0x29, 0x3d, 0x3d, 0x53, 0x4d, 0x43, 0x52, 0x42,
-  0x4c, 0x41, 0x43, 0x4b, 0x4b, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7c, 0x7c, 0x28, 0x21, 0x73, 0x74, 0x6d, 0x26, 0x26, 0x28, 0x28, 0x28,
-  0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43,
-  0x52, 0x57, 0x48, 0x49, 0x54, 0x45, 0x4b, 0x29, 0x3d, 0x3d, 0x53, 0x4d,
-  0x43, 0x52, 0x57, 0x48, 0x49, 0x54, 0x45, 0x4b, 0x29, 0x29, 0x0a, 0x20,
+  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54,
+  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x33,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x6d,
+  0x70, 0x74, 0x79, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x20, 0x28,
+  0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x26, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x28, 0x62, 0x62, 0x41, 0x74, 0x74,
+  0x61, 0x63, 0x6b, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
+  0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x31, 0x29, 0x29, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a,
-  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x6b, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65,
-  0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
-  0x70, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45,
-  0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69,
-  0x64, 0x2b, 0x33, 0x29, 0x3d, 0x3d, 0x4d, 0x41, 0x4b, 0x45, 0x50, 0x49,
-  0x45, 0x43, 0x45, 0x28, 0x52, 0x4f, 0x4f, 0x4b, 0x2c, 0x47, 0x45, 0x54,
-  0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29,
-  0x29, 0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x72, 0x75, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x62,
-  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45,
-  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b,
-  0x31, 0x29, 0x29, 0x7c, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
-  0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x32, 0x29, 0x29, 0x29, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x6b, 0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x73, 0x71, 0x75, 0x61,
-  0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20,
-  0x3d, 0x20, 0x20, 0x28, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b,
+  0x20, 0x20, 0x7c, 0x28, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b,
   0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28,
-  0x6c, 0x69, 0x64, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x28,
-  0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x26, 0x53, 0x45,
+  0x6c, 0x69, 0x64, 0x2d, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x74, 0x6d,
+  0x70, 0x62, 0x26, 0x26, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x26, 0x26,
+  0x21, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x26, 0x21, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3f, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x32, 0x29, 0x3a, 0x42,
+  0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x43, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+  0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
+  0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68,
+  0x74, 0x73, 0x20, 0x76, 0x69, 0x61, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x6e, 0x20,
+  0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x20, 0x6b, 0x69, 0x6e, 0x67, 0x73, 0x69, 0x64, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x20, 0x28, 0x6c,
+  0x69, 0x64, 0x3d, 0x3d, 0x73, 0x71, 0x6b, 0x69, 0x6e, 0x67, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x21, 0x71, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x41, 0x4c, 0x4c,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x26, 0x26,
+  0x28, 0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26,
+  0x53, 0x4d, 0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x4b, 0x29, 0x3d,
+  0x3d, 0x53, 0x4d, 0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x4b, 0x29,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x28, 0x21, 0x73, 0x74,
+  0x6d, 0x26, 0x26, 0x28, 0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x57, 0x48, 0x49, 0x54, 0x45,
+  0x4b, 0x29, 0x3d, 0x3d, 0x53, 0x4d, 0x43, 0x52, 0x57, 0x48, 0x49, 0x54,
+  0x45, 0x4b, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
+  0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x6b,
+  0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64, 0x2b, 0x33, 0x29, 0x3d, 0x3d,
+  0x4d, 0x41, 0x4b, 0x45, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x52, 0x4f,
+  0x4f, 0x4b, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28,
+  0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x29, 0x29, 0x3f, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x72, 0x75, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x66,
+  0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65,
+  0x6d, 0x70, 0x74, 0x79, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x73,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20,
+  0x20, 0x3d, 0x20, 0x28, 0x28, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
+  0x65, 0x72, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
+  0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x29, 0x7c, 0x28, 0x62,
+  0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x26, 0x53, 0x45,
   0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b,
-  0x31, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x28, 0x62, 0x62,
+  0x32, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6b,
+  0x69, 0x6e, 0x67, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x65, 0x6d, 0x70, 0x74,
+  0x79, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e,
+  0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x20, 0x28, 0x62, 0x62,
   0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x32, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20,
-  0x7c, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x26, 0x26, 0x21, 0x62, 0x62, 0x4d, 0x61, 0x73,
-  0x6b, 0x26, 0x26, 0x21, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3f,
-  0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69,
-  0x64, 0x2b, 0x32, 0x29, 0x3a, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54, 0x59,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74,
-  0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x62, 0x69, 0x74,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x70, 0x69, 0x63, 0x6b,
-  0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-  0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x31, 0x5b, 0x67, 0x69,
-  0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b,
-  0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c,
-  0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65,
-  0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-  0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x5b, 0x67, 0x69,
-  0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b,
-  0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c,
-  0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d, 0x50, 0x54,
-  0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63,
-  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66,
-  0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f,
-  0x62, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73,
-  0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
-  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20,
-  0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d,
-  0x5f, 0x61, 0x64, 0x64, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73,
-  0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x29, 0x29, 0x3b, 0x0a,
-  0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x63, 0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d,
-  0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62,
-  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b,
-  0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
-  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69,
-  0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b,
-  0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2b,
-  0x3d, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69,
-  0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6e,
-  0x6f, 0x64, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
-  0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69,
-  0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e,
-  0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64,
-  0x5d, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x71, 0x73, 0x29, 0x3f, 0x51,
-  0x53, 0x3a, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x5d, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x72, 0x6f, 0x6f, 0x74,
-  0x6b, 0x69, 0x63, 0x29, 0x3f, 0x4b, 0x49, 0x43, 0x3a, 0x53, 0x54, 0x41,
-  0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x28, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61,
+  0x63, 0x6b, 0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
+  0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7c, 0x28, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b,
+  0x73, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28,
+  0x6c, 0x69, 0x64, 0x2b, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x74, 0x6d,
+  0x70, 0x62, 0x26, 0x26, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x26, 0x26,
+  0x21, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x26, 0x21, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3f, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x32, 0x29, 0x3a, 0x42,
+  0x42, 0x45, 0x4d, 0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x75, 0x6c, 0x74, 0x69, 0x70, 0x76, 0x2c,
+  0x20, 0x65, 0x78, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x72, 0x6f, 0x6f,
+  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x70,
+  0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x6c, 0x69, 0x6e, 0x65,
+  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65,
+  0x73, 0x20, 0x26, 0x3d, 0x20, 0x28, 0x72, 0x6f, 0x6f, 0x74, 0x65, 0x78,
+  0x63, 0x6c, 0x75, 0x64, 0x65, 0x26, 0x26, 0x73, 0x64, 0x3d, 0x3d, 0x31,
+  0x29, 0x3f, 0x7e, 0x52, 0x6f, 0x6f, 0x74, 0x45, 0x78, 0x63, 0x6c, 0x75,
+  0x64, 0x65, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x3a, 0x42, 0x42, 0x46, 0x55,
+  0x4c, 0x4c, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x62,
+  0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x20,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72,
+  0x79, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x70, 0x69,
+  0x63, 0x6b, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x31, 0x5b,
+  0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36,
+  0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x4d, 0x6f,
+  0x76, 0x65, 0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x5b,
+  0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36,
+  0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x42, 0x42, 0x45, 0x4d,
+  0x50, 0x54, 0x59, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68,
+  0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33,
+  0x32, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69,
+  0x63, 0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e,
+  0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c,
+  0x65, 0x63, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x61, 0x64, 0x64, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x31, 0x73, 0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x29, 0x29,
+  0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69,
+  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73,
+  0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36,
+  0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x20, 0x2b, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70, 0x36, 0x34,
+  0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x6d,
+  0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x5d, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x71, 0x73, 0x29,
+  0x3f, 0x51, 0x53, 0x3a, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e,
+  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x72, 0x6f,
+  0x6f, 0x74, 0x6b, 0x69, 0x63, 0x29, 0x3f, 0x4b, 0x49, 0x43, 0x3a, 0x53,
+  0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76,
-  0x61, 0x6c, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x78, 0x36, 0x34,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x76, 0x61, 0x6c, 0x75, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x78,
+  0x36, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45,
-  0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52,
-  0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x47,
-  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f,
-  0x6d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x42, 0x6c,
-  0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x7c, 0x62, 0x6f,
-  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x7c, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20,
-  0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
-  0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
-  0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
-  0x67, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x61, 0x77, 0x6e,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x65, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x29,
-  0x3f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c,
-  0x41, 0x43, 0x4b, 0x5d, 0x3a, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
-  0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x5e, 0x62, 0x62,
-  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x20, 0x20, 0x20, 0x3d,
-  0x20, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x29, 0x3f, 0x28, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43,
-  0x4b, 0x5d, 0x5e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72,
-  0x73, 0x29, 0x3a, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
-  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20,
-  0x73, 0x71, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f,
-  0x6c, 0x6f, 0x72, 0x29, 0x3f, 0x6c, 0x69, 0x64, 0x3a, 0x46, 0x4c, 0x4f,
-  0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x62, 0x6f, 0x6e,
-  0x75, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x21, 0x3d, 0x50,
-  0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x6f, 0x64, 0x20,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d,
-  0x21, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x45, 0x76, 0x61,
-  0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
-  0x5b, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x5d, 0x3a, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20,
-  0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b,
-  0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x21, 0x3d, 0x50, 0x4e,
-  0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x45, 0x76, 0x61, 0x6c, 0x54, 0x61, 0x62,
-  0x6c, 0x65, 0x5b, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2a, 0x36, 0x34, 0x2b,
-  0x73, 0x71, 0x66, 0x72, 0x6f, 0x6d, 0x5d, 0x3a, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x21, 0x3d, 0x50,
-  0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x45, 0x76, 0x61, 0x6c, 0x43, 0x6f,
-  0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5b, 0x73, 0x71, 0x66, 0x72, 0x6f, 0x6d,
-  0x5d, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x20,
-  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x77, 0x68,
-  0x69, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62,
-  0x20, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x3d, 0x50,
-  0x41, 0x57, 0x4e, 0x26, 0x26, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d,
-  0x57, 0x48, 0x49, 0x54, 0x45, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a,
-  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28, 0x74, 0x6d,
-  0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x41, 0x4e, 0x4b, 0x28,
-  0x6c, 0x69, 0x64, 0x29, 0x3c, 0x52, 0x41, 0x4e, 0x4b, 0x5f, 0x38, 0x26,
-  0x26, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x53, 0x45, 0x54, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x38, 0x29,
-  0x29, 0x29, 0x3f, 0x31, 0x35, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x28,
-  0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x46, 0x49, 0x4c,
-  0x45, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3c, 0x46, 0x49, 0x4c, 0x45, 0x5f,
-  0x48, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62,
-  0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x37, 0x29, 0x29, 0x29, 0x3f, 0x31,
-  0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x2b, 0x3d, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47,
-  0x45, 0x54, 0x46, 0x49, 0x4c, 0x45, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3e,
-  0x46, 0x49, 0x4c, 0x45, 0x5f, 0x41, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4d,
-  0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54,
-  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x39,
-  0x29, 0x29, 0x29, 0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x2c,
-  0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x70, 0x6f, 0x70, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x66, 0x6f, 0x72, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x3d, 0x6c,
-  0x69, 0x64, 0x2d, 0x38, 0x3b, 0x73, 0x71, 0x74, 0x6f, 0x3e, 0x37, 0x26,
-  0x26, 0x74, 0x6d, 0x70, 0x62, 0x3b, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x3d,
-  0x38, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x2d, 0x3d, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26,
-  0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
-  0x42, 0x42, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x3f, 0x33, 0x30,
-  0x3a, 0x30, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x20,
-  0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20, 0x62, 0x6c,
-  0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x62,
-  0x20, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3d, 0x3d, 0x50,
-  0x41, 0x57, 0x4e, 0x26, 0x26, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x3d,
-  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a,
-  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28, 0x74, 0x6d,
-  0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x41, 0x4e, 0x4b, 0x28,
-  0x6c, 0x69, 0x64, 0x29, 0x3e, 0x52, 0x41, 0x4e, 0x4b, 0x5f, 0x31, 0x26,
-  0x26, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x53, 0x45, 0x54, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x38, 0x29,
-  0x29, 0x29, 0x3f, 0x31, 0x35, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x61, 0x69, 0x6e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x28,
-  0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x46, 0x49, 0x4c,
-  0x45, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3e, 0x46, 0x49, 0x4c, 0x45, 0x5f,
-  0x41, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62,
-  0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x37, 0x29, 0x29, 0x29, 0x3f, 0x31,
-  0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x2b, 0x3d, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47,
-  0x45, 0x54, 0x46, 0x49, 0x4c, 0x45, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3c,
-  0x46, 0x49, 0x4c, 0x45, 0x5f, 0x48, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4d,
-  0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54,
-  0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x39,
-  0x29, 0x29, 0x29, 0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x2c,
-  0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x70, 0x6f, 0x70, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x66, 0x6f, 0x72, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x3d, 0x6c,
-  0x69, 0x64, 0x2b, 0x38, 0x3b, 0x73, 0x71, 0x74, 0x6f, 0x3c, 0x35, 0x36,
-  0x26, 0x26, 0x74, 0x6d, 0x70, 0x62, 0x3b, 0x73, 0x71, 0x74, 0x6f, 0x2b,
-  0x3d, 0x38, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45,
+  0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69,
+  0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c,
+  0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66,
+  0x72, 0x6f, 0x6d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x20, 0x3d, 0x20, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x7c,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d,
+  0x7c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73,
+  0x6b, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
+  0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x20, 0x2f,
+  0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x70, 0x61,
+  0x77, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x65,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x29, 0x3f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
+  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3a, 0x28, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x5e,
+  0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x29, 0x3f,
+  0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c,
+  0x41, 0x43, 0x4b, 0x5d, 0x5e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b,
+  0x65, 0x72, 0x73, 0x29, 0x3a, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
+  0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x53, 0x71, 0x75, 0x61, 0x72,
+  0x65, 0x20, 0x73, 0x71, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x3d, 0x20, 0x28,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x29, 0x3f, 0x6c, 0x69, 0x64, 0x3a, 0x46,
+  0x4c, 0x4f, 0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x62,
+  0x6f, 0x6e, 0x75, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x21,
+  0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x31, 0x30, 0x3a, 0x30,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x6f,
+  0x64, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72,
+  0x6f, 0x6d, 0x21, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x45,
+  0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x5b, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x5d, 0x3a, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x69, 0x65, 0x63,
+  0x65, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x21, 0x3d,
+  0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x45, 0x76, 0x61, 0x6c, 0x54,
+  0x61, 0x62, 0x6c, 0x65, 0x5b, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2a, 0x36,
+  0x34, 0x2b, 0x73, 0x71, 0x66, 0x72, 0x6f, 0x6d, 0x5d, 0x3a, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x71, 0x75, 0x61,
+  0x72, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x21,
+  0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x45, 0x76, 0x61, 0x6c,
+  0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5b, 0x73, 0x71, 0x66, 0x72,
+  0x6f, 0x6d, 0x5d, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x77,
+  0x6e, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+  0x77, 0x68, 0x69, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d,
+  0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x3d, 0x50, 0x41, 0x57, 0x4e, 0x26, 0x26, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3d, 0x3d, 0x57, 0x48, 0x49, 0x54, 0x45, 0x29, 0x3f, 0x74, 0x72, 0x75,
+  0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28,
+  0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x41, 0x4e,
+  0x4b, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3c, 0x52, 0x41, 0x4e, 0x4b, 0x5f,
+  0x38, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b,
+  0x38, 0x29, 0x29, 0x29, 0x3f, 0x31, 0x35, 0x3a, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x61, 0x69,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b,
+  0x3d, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x46,
+  0x49, 0x4c, 0x45, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3c, 0x46, 0x49, 0x4c,
+  0x45, 0x5f, 0x48, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
   0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
-  0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x3f, 0x33,
-  0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x6e, 0x65, 0x67, 0x61, 0x6d, 0x61, 0x78, 0x65, 0x64, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x29,
-  0x3f, 0x2d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3a, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x75,
-  0x62, 0x6c, 0x65, 0x20, 0x62, 0x69, 0x73, 0x68, 0x6f, 0x70, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d,
-  0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x20, 0x28,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
-  0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
-  0x42, 0x50, 0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51,
-  0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x3d, 0x3d, 0x32, 0x29, 0x3f,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x32, 0x35, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x28, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d,
-  0x5e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72, 0x73, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d, 0x37, 0x29, 0x29, 0x29,
+  0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26,
+  0x26, 0x47, 0x45, 0x54, 0x46, 0x49, 0x4c, 0x45, 0x28, 0x6c, 0x69, 0x64,
+  0x29, 0x3e, 0x46, 0x49, 0x4c, 0x45, 0x5f, 0x41, 0x26, 0x26, 0x28, 0x62,
+  0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53,
+  0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64,
+  0x2d, 0x39, 0x29, 0x29, 0x29, 0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d,
+  0x6e, 0x2c, 0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x70, 0x6f, 0x70,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x28, 0x73, 0x71, 0x74, 0x6f,
+  0x3d, 0x6c, 0x69, 0x64, 0x2d, 0x38, 0x3b, 0x73, 0x71, 0x74, 0x6f, 0x3e,
+  0x37, 0x26, 0x26, 0x74, 0x6d, 0x70, 0x62, 0x3b, 0x73, 0x71, 0x74, 0x6f,
+  0x2d, 0x3d, 0x38, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73,
+  0x6b, 0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41,
+  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x3f,
+  0x33, 0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x77,
+  0x6e, 0x20, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x75, 0x72, 0x65, 0x20,
+  0x62, 0x6c, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d,
+  0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3d,
+  0x3d, 0x50, 0x41, 0x57, 0x4e, 0x26, 0x26, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+  0x3d, 0x3d, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x29, 0x3f, 0x74, 0x72, 0x75,
+  0x65, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28,
+  0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x41, 0x4e,
+  0x4b, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3e, 0x52, 0x41, 0x4e, 0x4b, 0x5f,
+  0x31, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4f, 0x70, 0x70, 0x26, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2d,
+  0x38, 0x29, 0x29, 0x29, 0x3f, 0x31, 0x35, 0x3a, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x61, 0x69,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b,
+  0x3d, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26, 0x26, 0x47, 0x45, 0x54, 0x46,
+  0x49, 0x4c, 0x45, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x3e, 0x46, 0x49, 0x4c,
+  0x45, 0x5f, 0x41, 0x26, 0x26, 0x28, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
+  0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64, 0x2b, 0x37, 0x29, 0x29, 0x29,
+  0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x26,
+  0x26, 0x47, 0x45, 0x54, 0x46, 0x49, 0x4c, 0x45, 0x28, 0x6c, 0x69, 0x64,
+  0x29, 0x3c, 0x46, 0x49, 0x4c, 0x45, 0x5f, 0x48, 0x26, 0x26, 0x28, 0x62,
+  0x62, 0x4d, 0x61, 0x73, 0x6b, 0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53,
+  0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x6c, 0x69, 0x64,
+  0x2b, 0x39, 0x29, 0x29, 0x29, 0x3f, 0x31, 0x30, 0x3a, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d,
+  0x6e, 0x2c, 0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x70, 0x6f, 0x70,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x62, 0x61, 0x73, 0x65, 0x64, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x28, 0x73, 0x71, 0x74, 0x6f,
+  0x3d, 0x6c, 0x69, 0x64, 0x2b, 0x38, 0x3b, 0x73, 0x71, 0x74, 0x6f, 0x3c,
+  0x35, 0x36, 0x26, 0x26, 0x74, 0x6d, 0x70, 0x62, 0x3b, 0x73, 0x71, 0x74,
+  0x6f, 0x2b, 0x3d, 0x38, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x28, 0x62, 0x62, 0x4d, 0x61,
+  0x73, 0x6b, 0x26, 0x62, 0x62, 0x4d, 0x65, 0x26, 0x53, 0x45, 0x54, 0x4d,
+  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29,
+  0x3f, 0x33, 0x30, 0x3a, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x6d, 0x61, 0x78, 0x65, 0x64, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x63, 0x6f, 0x6c, 0x6f,
+  0x72, 0x29, 0x3f, 0x2d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3a, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x64, 0x75, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x69, 0x73, 0x68, 0x6f, 0x70,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64,
+  0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x3d,
+  0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b,
+  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x26, 0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
   0x42, 0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
@@ -4706,303 +5791,514 @@ const char zeta_cl[] = {
   0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x3d, 0x3d, 0x32,
   0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x35, 0x3a, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65,
-  0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72,
-  0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32,
-  0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
-  0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65,
-  0x63, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x78, 0x36, 0x34,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x61, 0x64,
-  0x64, 0x28, 0x26, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x23, 0x65,
-  0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x20,
-  0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x6d,
-  0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70,
-  0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
-  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
-  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
-  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
-  0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d,
-  0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76, 0x61, 0x6c,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x73, 0x63, 0x72, 0x54,
-  0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x23, 0x65, 0x6e,
-  0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
-  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
-  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69,
-  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f, 0x42, 0x41,
-  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d,
+  0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x28, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43,
+  0x4b, 0x5d, 0x5e, 0x62, 0x62, 0x42, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x72,
+  0x73, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x28, 0x7e, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
+  0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x26, 0x7e, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x26, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x29, 0x3d,
+  0x3d, 0x32, 0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x35, 0x3a, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20,
+  0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b,
+  0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74,
+  0x33, 0x32, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x61, 0x74, 0x6f, 0x6d,
+  0x69, 0x63, 0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f,
+  0x4c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x65, 0x63, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x78,
+  0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
+  0x61, 0x64, 0x64, 0x28, 0x26, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a,
+  0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x73, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74,
+  0x65, 0x6d, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x72, 0x54,
+  0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20,
+  0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x76,
+  0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x73, 0x63,
+  0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x23,
+  0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
+  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f,
+  0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
+  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x6e, 0x65, 0x67,
-  0x6d, 0x61, 0x78, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x63, 0x6f, 0x72,
-  0x69, 0x6e, 0x67, 0x20, 0x78, 0x31, 0x20, 0x20, 0x23, 0x23, 0x23, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x6e,
+  0x65, 0x67, 0x6d, 0x61, 0x78, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x78, 0x31, 0x20, 0x20, 0x23, 0x23,
+  0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x6e, 0x65, 0x67, 0x61, 0x6d, 0x61, 0x78, 0x65, 0x64, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x74, 0x6d, 0x29,
-  0x3f, 0x2d, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3a,
-  0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x6d, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x21, 0x71, 0x73,
-  0x26, 0x26, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26, 0x6d,
-  0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x3d, 0x30, 0x29,
-  0x3f, 0x2d, 0x49, 0x4e, 0x46, 0x2b, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x73, 0x74, 0x61, 0x6c, 0x65, 0x6d, 0x61, 0x74, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x3d, 0x20, 0x28, 0x21, 0x71, 0x73, 0x26, 0x26, 0x21, 0x72, 0x6f, 0x6f,
-  0x74, 0x6b, 0x69, 0x63, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x3d, 0x3d, 0x30, 0x29, 0x3f, 0x53, 0x54, 0x41, 0x4c,
-  0x45, 0x4d, 0x41, 0x54, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3a, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x62, 0x79, 0x20,
-  0x33, 0x20, 0x66, 0x6f, 0x6c, 0x64, 0x20, 0x72, 0x65, 0x70, 0x65, 0x74,
-  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69,
-  0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6e, 0x3d,
-  0x70, 0x6c, 0x79, 0x2b, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74,
-  0x2d, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x6d, 0x61, 0x78, 0x65, 0x64, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x74,
+  0x6d, 0x29, 0x3f, 0x2d, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3a, 0x65, 0x76, 0x61, 0x6c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x6d, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x21,
+  0x71, 0x73, 0x26, 0x26, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26,
+  0x26, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x3d,
+  0x30, 0x29, 0x3f, 0x2d, 0x49, 0x4e, 0x46, 0x2b, 0x70, 0x6c, 0x79, 0x3a,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x61, 0x6c, 0x65, 0x6d, 0x61, 0x74,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x3d, 0x20, 0x28, 0x21, 0x71, 0x73, 0x26, 0x26, 0x21, 0x72,
+  0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x3d, 0x30, 0x29, 0x3f, 0x53, 0x54,
+  0x41, 0x4c, 0x45, 0x4d, 0x41, 0x54, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45,
+  0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x62,
+  0x79, 0x20, 0x33, 0x20, 0x66, 0x6f, 0x6c, 0x64, 0x20, 0x72, 0x65, 0x70,
+  0x65, 0x74, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x78, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x2d,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c,
+  0x20, 0x67, 0x61, 0x6d, 0x65, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x73, 0x68, 0x61,
+  0x72, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b,
+  0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x28, 0x6e, 0x3d, 0x70, 0x6c, 0x79, 0x2b, 0x70, 0x6c,
+  0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2d, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x69, 0x64, 0x3d,
-  0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x71, 0x73,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f, 0x76,
-  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x21, 0x71, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6e, 0x3e, 0x3d, 0x30, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x73, 0x64, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x6e, 0x3e, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x6e, 0x3e, 0x3d, 0x70, 0x6c, 0x79, 0x2b,
+  0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2d, 0x28, 0x73, 0x33,
+  0x32, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69,
+  0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6e,
-  0x3e, 0x3d, 0x70, 0x6c, 0x79, 0x2b, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e,
-  0x69, 0x74, 0x2d, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b,
-  0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x2d,
+  0x3d, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x3d, 0x3d, 0x28, 0x28, 0x6e, 0x3e,
+  0x3d, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x29, 0x3f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74,
+  0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x2d, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x2b, 0x31, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6e, 0x2d, 0x3d, 0x32, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x3d, 0x3d, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
-  0x79, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x47, 0x41, 0x4d,
-  0x45, 0x50, 0x4c, 0x59, 0x2b, 0x6e, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x66, 0x69, 0x66,
-  0x74, 0x79, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x75, 0x6c, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
-  0x64, 0x3e, 0x31, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d,
-  0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
-  0x3e, 0x3d, 0x31, 0x30, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53, 0x43,
-  0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4b, 0x78,
-  0x6b, 0x20, 0x64, 0x72, 0x61, 0x77, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x3e, 0x31, 0x26, 0x26, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x7c, 0x62, 0x6f, 0x61, 0x72,
-  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x7c, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x3c, 0x3d,
-  0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x3a, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x6e, 0x5d, 0x29, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53, 0x43, 0x4f, 0x52, 0x45,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x66, 0x69,
+  0x66, 0x74, 0x79, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x75, 0x6c,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x73, 0x64, 0x3e, 0x31, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48,
+  0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64,
+  0x5d, 0x3e, 0x3d, 0x31, 0x30, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20,
+  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53,
+  0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x4b,
+  0x78, 0x6b, 0x20, 0x64, 0x72, 0x61, 0x77, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x3e, 0x31, 0x26, 0x26,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x7c, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x7c, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x29, 0x3c,
+  0x3d, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x3d, 0x20, 0x44, 0x52, 0x41, 0x57, 0x53, 0x43, 0x4f, 0x52, 0x45,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x72, 0x65, 0x65, 0x20, 0x66, 0x6c, 0x6f, 0x77, 0x20, 0x78, 0x31,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x74, 0x72, 0x65, 0x65, 0x20, 0x66, 0x6c, 0x6f, 0x77, 0x20, 0x78,
+  0x31, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x62, 0x6f, 0x75,
-  0x6e, 0x64, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-  0x20, 0x28, 0x73, 0x64, 0x3e, 0x3d, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x65,
-  0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x6c, 0x65,
-  0x61, 0x66, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
-  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d,
-  0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x20, 0x70,
-  0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x71, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72,
-  0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x62, 0x65, 0x74, 0x61, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76,
-  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x30, 0x26, 0x26, 0x71, 0x73,
-  0x26, 0x26, 0x21, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
-  0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54,
-  0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63,
-  0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c,
-  0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x73, 0x6f,
-  0x66, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x62, 0x6f,
+  0x75, 0x6e, 0x64, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x73, 0x64, 0x3e, 0x3d, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
   0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64,
-  0x20, 0x70, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x71, 0x73, 0x65, 0x61,
-  0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76,
-  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x30, 0x26, 0x26, 0x71, 0x73,
-  0x26, 0x26, 0x21, 0x72, 0x6f, 0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
-  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
-  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48,
-  0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74,
+  0x65, 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x20, 0x6f, 0x72, 0x20, 0x6c,
+  0x65, 0x61, 0x66, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
+  0x5d, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x2c, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x20,
+  0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70,
+  0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x6b, 0x69, 0x70, 0x70, 0x65,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x72, 0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x26, 0x26, 0x73,
+  0x64, 0x3d, 0x3d, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f,
+  0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64,
+  0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20,
+  0x53, 0x50, 0x4c, 0x49, 0x54, 0x4b, 0x45, 0x59, 0x28, 0x6d, 0x6f, 0x76,
+  0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20,
+  0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d,
+  0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53,
+  0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x4c, 0x4f, 0x54, 0x2b,
+  0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x30, 0x2c,
+  0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6e, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x29, 0x3f, 0x30, 0x3a, 0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f,
+  0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52,
+  0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x43,
+  0x4c, 0x41, 0x49, 0x4d, 0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65,
+  0x79, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x28, 0x75, 0x33, 0x32, 0x29,
+  0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72,
+  0x2c, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63,
+  0x61, 0x74, 0x65, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x6e,
+  0x67, 0x20, 0x62, 0x72, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21,
+  0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x26, 0x26, 0x6e, 0x3d, 0x3d,
+  0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
+  0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4d,
+  0x4f, 0x56, 0x45, 0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79,
+  0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72,
+  0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6c, 0x69, 0x73,
+  0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+  0x64, 0x75, 0x63, 0x65, 0x20, 0x61, 0x74, 0x20, 0x73, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x20, 0x65, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33,
+  0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26,
+  0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53,
+  0x4e, 0x52, 0x4f, 0x4f, 0x54, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e,
+  0x3c, 0x4d, 0x41, 0x58, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
+  0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x52,
+  0x4f, 0x4f, 0x54, 0x2b, 0x6e, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x33,
+  0x32, 0x29, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20,
+  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x73, 0x6c, 0x6f, 0x74, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6d, 0x6f, 0x76,
+  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x31, 0x26, 0x26, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d,
+  0x3e, 0x3d, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x44, 0x45, 0x50, 0x54, 0x48,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x20,
+  0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
+  0x69, 0x6e, 0x63, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c,
+  0x69, 0x74, 0x5b, 0x52, 0x53, 0x4e, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x5d,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x73, 0x6c, 0x6f, 0x74, 0x3c, 0x4d, 0x41, 0x58, 0x53, 0x50, 0x4c, 0x49,
+  0x54, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52, 0x6f, 0x6f, 0x74, 0x53,
+  0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x50, 0x4c, 0x49, 0x54,
+  0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x2a, 0x34,
+  0x5d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x33, 0x32, 0x29, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x52,
+  0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53,
+  0x50, 0x4c, 0x49, 0x54, 0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c,
+  0x6f, 0x74, 0x2a, 0x34, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75,
+  0x33, 0x32, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78, 0x63, 0x68,
+  0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74,
+  0x5b, 0x52, 0x53, 0x53, 0x4c, 0x4f, 0x54, 0x2b, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x28, 0x75, 0x33, 0x32, 0x29, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x2b, 0x31, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x2c, 0x20, 0x6a, 0x6f, 0x69, 0x6e,
+  0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20,
+  0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x75,
+  0x6e, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x73, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20,
+  0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x2c, 0x20,
+  0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e,
+  0x73, 0x74, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x62, 0x79, 0x20,
+  0x6f, 0x77, 0x6e, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65,
+  0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x73, 0x6c, 0x6f, 0x74, 0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67,
+  0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b,
+  0x52, 0x53, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x2b, 0x28, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x2d, 0x31, 0x29, 0x2a, 0x34, 0x2b,
+  0x32, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3c, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68,
+  0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74,
+  0x5b, 0x52, 0x53, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x2b, 0x28, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x2d, 0x31, 0x29, 0x2a, 0x34,
+  0x2b, 0x31, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28,
+  0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70,
+  0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70,
+  0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4f, 0x50, 0x45, 0x4e, 0x2b, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x30, 0x2c, 0x30,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x26, 0x53, 0x50, 0x53, 0x54, 0x41, 0x54, 0x45,
+  0x29, 0x3d, 0x3d, 0x53, 0x50, 0x4f, 0x50, 0x45, 0x4e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70,
+  0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70,
+  0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4f, 0x50, 0x45, 0x4e, 0x2b, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x28, 0x75, 0x33,
+  0x32, 0x29, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x28,
+  0x75, 0x33, 0x32, 0x29, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x2b, 0x53, 0x50, 0x4a, 0x4f, 0x49, 0x4e, 0x29, 0x3d, 0x3d, 0x28, 0x75,
+  0x33, 0x32, 0x29, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6e, 0x21, 0x3d, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x26, 0x26, 0x28, 0x6e,
+  0x21, 0x3d, 0x30, 0x7c, 0x7c, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65,
   0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a,
-  0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x66, 0x61, 0x69,
-  0x6c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 0x72,
-  0x6f, 0x6d, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c,
-  0x65, 0x2c, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6c,
-  0x70, 0x68, 0x61, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x74, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x21, 0x71, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x20,
-  0x2f, 0x2f, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x72, 0x6f,
-  0x6f, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65,
-  0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d,
-  0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41,
-  0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65,
-  0x78, 0x31, 0x3e, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73,
-  0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
-  0x3b, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e, 0x64,
-  0x65, 0x78, 0x31, 0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x3d,
-  0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x54, 0x54,
-  0x31, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x3b, 0x0a, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x74,
-  0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x68, 0x61,
-  0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x54, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x3e, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x70, 0x6c,
-  0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
-  0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3c, 0x30,
-  0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x70, 0x6c, 0x79, 0x3a,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x74, 0x31,
-  0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x28, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31,
-  0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x5e, 0x28, 0x48,
-  0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x73,
-  0x33, 0x32, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68,
-  0x5b, 0x73, 0x64, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x74, 0x74, 0x31, 0x2e,
-  0x66, 0x6c, 0x61, 0x67, 0x26, 0x30, 0x78, 0x33, 0x29, 0x3e, 0x46, 0x41,
-  0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x49, 0x53, 0x49,
-  0x4e, 0x46, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x49,
+  0x4e, 0x46, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72,
+  0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x73,
+  0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x61,
+  0x6c, 0x70, 0x68, 0x61, 0x2c, 0x20, 0x6e, 0x61, 0x72, 0x72, 0x6f, 0x77,
+  0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x6f, 0x66, 0x20, 0x63,
+  0x68, 0x69, 0x6c, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28,
+  0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x28, 0x28, 0x73, 0x33, 0x32, 0x29,
+  0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67,
+  0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b,
+  0x52, 0x53, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x2c, 0x30, 0x2c, 0x30,
+  0x29, 0x2d, 0x49, 0x4e, 0x46, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
+  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
+  0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41, 0x4c,
+  0x50, 0x48, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
   0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
-  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48,
-  0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
-  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32,
-  0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x75, 0x74, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
-  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32,
-  0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42,
-  0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b,
+  0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
+  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20,
+  0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41,
+  0x5d, 0x2c, 0x2d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x2c, 0x20, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f,
+  0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x20,
+  0x69, 0x69, 0x64, 0x20, 0x70, 0x61, 0x73, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72, 0x6f,
+  0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3d, 0x3d,
+  0x33, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48,
+  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
+  0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21,
+  0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74,
+  0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49,
+  0x49, 0x44, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29,
+  0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67,
+  0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b,
+  0x52, 0x53, 0x53, 0x4c, 0x4f, 0x54, 0x2b, 0x53, 0x50, 0x4c, 0x49, 0x54,
+  0x4b, 0x45, 0x59, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76,
+  0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d,
+  0x32, 0x5d, 0x29, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+  0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x3e, 0x30, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x53, 0x50, 0x4c, 0x49, 0x54,
+  0x4b, 0x45, 0x59, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76,
+  0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d,
+  0x31, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x79, 0x6f, 0x75, 0x6e, 0x67, 0x20,
+  0x62, 0x72, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 0x77, 0x61, 0x69,
+  0x74, 0x2c, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x61, 0x66, 0x74, 0x65,
+  0x72, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f,
+  0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e,
+  0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78,
+  0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c,
+  0x69, 0x74, 0x5b, 0x52, 0x53, 0x4f, 0x50, 0x45, 0x4e, 0x2b, 0x53, 0x50,
+  0x4c, 0x49, 0x54, 0x4b, 0x45, 0x59, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b,
+  0x73, 0x64, 0x2d, 0x32, 0x5d, 0x29, 0x5d, 0x2c, 0x53, 0x50, 0x57, 0x41,
+  0x49, 0x54, 0x2c, 0x53, 0x50, 0x4f, 0x50, 0x45, 0x4e, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20,
+  0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
+  0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f,
+  0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x43, 0x48, 0x49,
+  0x4c, 0x44, 0x2b, 0x28, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f,
+  0x74, 0x2d, 0x31, 0x29, 0x2a, 0x34, 0x30, 0x39, 0x36, 0x2b, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x20, 0x30, 0x2c, 0x20,
+  0x28, 0x75, 0x33, 0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6e, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x5f, 0x69, 0x6e, 0x63, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53,
+  0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x50, 0x4c, 0x49, 0x54,
+  0x2b, 0x28, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x2d,
+  0x31, 0x29, 0x2a, 0x34, 0x2b, 0x32, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x21, 0x3d, 0x30, 0x26, 0x26,
+  0x6e, 0x21, 0x3d, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20,
+  0x49, 0x4e, 0x46, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x67, 0x6e, 0x6f,
+  0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x73, 0x74, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x74, 0x20, 0x69, 0x6e,
+  0x20, 0x71, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+  0x20, 0x62, 0x65, 0x74, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x3e, 0x30, 0x26, 0x26, 0x71, 0x73, 0x26, 0x26, 0x21, 0x72, 0x6f,
+  0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
+  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73,
+  0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68,
+  0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20,
+  0x3d, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
+  0x66, 0x61, 0x69, 0x6c, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f,
   0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x74,
-  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x68, 0x69, 0x74, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52,
-  0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x34, 0x5d, 0x2b,
-  0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x2f, 0x2f, 0x20,
-  0x65, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6f,
-  0x6d, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61,
-  0x62, 0x64, 0x61, 0x64, 0x61, 0x2c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
-  0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x74, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x61, 0x74, 0x20,
+  0x69, 0x6e, 0x20, 0x71, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x61, 0x6c, 0x70, 0x68, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x3e, 0x30, 0x26, 0x26, 0x71, 0x73, 0x26, 0x26, 0x21, 0x72, 0x6f,
+  0x6f, 0x74, 0x6b, 0x69, 0x63, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50,
+  0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
+  0x20, 0x2f, 0x2f, 0x20, 0x66, 0x61, 0x69, 0x6c, 0x20, 0x73, 0x6f, 0x66,
+  0x74, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x68, 0x61,
+  0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x75, 0x70,
+  0x64, 0x61, 0x74, 0x65, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x77,
+  0x69, 0x74, 0x68, 0x20, 0x74, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f,
-  0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x31, 0x0a, 0x20, 0x20,
+  0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x30, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x71,
   0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x6f,
@@ -5012,705 +6308,1194 @@ const char zeta_cl[] = {
   0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4e, 0x55, 0x4c, 0x4c,
   0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49,
-  0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b,
-  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x31, 0x20, 0x2f, 0x2f, 0x20, 0x6f,
-  0x6c, 0x64, 0x65, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x6e, 0x20, 0x73, 0x65,
-  0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x20, 0x66, 0x75, 0x6c, 0x6c, 0x79,
-  0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
-  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x74, 0x74, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x32, 0x3e, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x28, 0x21,
-  0x52, 0x4d, 0x4f, 0x29, 0x7c, 0x7c, 0x28, 0x52, 0x4d, 0x4f, 0x26, 0x26,
-  0x67, 0x69, 0x64, 0x3c, 0x52, 0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52, 0x4b,
-  0x45, 0x52, 0x53, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44,
-  0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x30, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x28, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e, 0x31, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74,
+  0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20, 0x20, 0x20, 0x20,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31,
+  0x20, 0x3d, 0x20, 0x74, 0x74, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x54, 0x54,
+  0x31, 0x2c, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2c,
+  0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x74, 0x20,
+  0x70, 0x72, 0x6f, 0x62, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f,
+  0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36,
+  0x34, 0x2b, 0x37, 0x5d, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x31, 0x2e,
+  0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54, 0x54, 0x4b, 0x45, 0x59, 0x28,
+  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x62,
+  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53,
+  0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x38, 0x5d, 0x2b, 0x2b,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x54,
+  0x54, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54,
+  0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x3e, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x2d, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3c, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x70,
+  0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+  0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54, 0x54,
+  0x4b, 0x45, 0x59, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x74,
+  0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c,
+  0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74,
+  0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x28, 0x73, 0x33, 0x32, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70,
+  0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x74, 0x74,
+  0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x26, 0x30, 0x78, 0x33, 0x29, 0x3e,
+  0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x49,
+  0x53, 0x49, 0x4e, 0x46, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63,
+  0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c,
+  0x50, 0x48, 0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f,
-  0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73,
-  0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
-  0x3b, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x32, 0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x6c, 0x79, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x73, 0x64, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x65,
-  0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
-  0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32,
-  0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x70, 0x6c, 0x79,
-  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69,
-  0x74, 0x2b, 0x31, 0x29, 0x21, 0x3d, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e,
-  0x69, 0x74, 0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
-  0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32,
-  0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x73, 0x64, 0x2c,
-  0x20, 0x30, 0x2c, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x2b, 0x31, 0x29, 0x21, 0x3d, 0x73, 0x65, 0x61,
-  0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f,
-  0x6d, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32, 0x5b,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x70, 0x6c, 0x79, 0x2c,
-  0x20, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2b, 0x31, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54,
-  0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x73,
-  0x64, 0x2c, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65,
-  0x70, 0x74, 0x68, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78,
-  0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x30,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x70,
+  0x68, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x75, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
+  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32,
+  0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x74, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x68, 0x69, 0x74,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54,
+  0x45, 0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x34,
+  0x5d, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x2f,
+  0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x66,
+  0x72, 0x6f, 0x6d, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61, 0x2c, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3e, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x21, 0x71, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x20, 0x2f, 0x2f, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4e, 0x55,
+  0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26,
+  0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65,
+  0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x31, 0x20, 0x2f, 0x2f,
+  0x20, 0x6f, 0x6c, 0x64, 0x65, 0x73, 0x74, 0x20, 0x73, 0x6f, 0x6e, 0x20,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x20, 0x66, 0x75, 0x6c,
+  0x6c, 0x79, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x54,
+  0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x32, 0x3e, 0x31, 0x7c, 0x7c, 0x28,
+  0x54, 0x54, 0x55, 0x4e, 0x49, 0x46, 0x49, 0x45, 0x44, 0x26, 0x26, 0x54,
+  0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e, 0x31, 0x29, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x28, 0x28, 0x21, 0x52, 0x4d, 0x4f, 0x29, 0x7c, 0x7c, 0x28, 0x52, 0x4d,
+  0x4f, 0x26, 0x26, 0x67, 0x69, 0x64, 0x3c, 0x52, 0x41, 0x4e, 0x44, 0x57,
+  0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x72,
+  0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x26, 0x26, 0x73, 0x64,
+  0x3c, 0x3d, 0x33, 0x29, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x63,
+  0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20, 0x76, 0x69, 0x61, 0x20, 0x71,
+  0x75, 0x65, 0x75, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
+  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x30, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
+  0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20,
+  0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68,
+  0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b,
+  0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x3d, 0x20, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28, 0x54, 0x54, 0x49, 0x4e, 0x44,
+  0x45, 0x58, 0x32, 0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x54, 0x54,
+  0x55, 0x4e, 0x49, 0x46, 0x49, 0x45, 0x44, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x20,
+  0x6f, 0x66, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x54, 0x54, 0x31,
+  0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x61, 0x6c, 0x72, 0x65, 0x61, 0x64, 0x79, 0x20, 0x70, 0x72, 0x6f, 0x62,
+  0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x54, 0x54, 0x31, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65,
+  0x74, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+  0x2c, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b,
+  0x2c, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20,
+  0x6f, 0x6e, 0x65, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x70, 0x20, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x42, 0x55, 0x43, 0x4b, 0x45,
+  0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72,
+  0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x75, 0x33, 0x32, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x67, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x28, 0x74, 0x74, 0x67, 0x65, 0x6e, 0x5f, 0x69, 0x6e, 0x69,
+  0x74, 0x2b, 0x28, 0x75, 0x33, 0x32, 0x29, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x26, 0x30, 0x78, 0x46,
+  0x46, 0x46, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x75, 0x33, 0x32, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x6f,
+  0x6c, 0x64, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x31, 0x5b, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c, 0x6f, 0x63, 0x6b, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x33, 0x32,
+  0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65, 0x77, 0x20, 0x3d, 0x20, 0x28,
+  0x28, 0x6c, 0x6f, 0x63, 0x6b, 0x6f, 0x6c, 0x64, 0x3e, 0x3e, 0x31, 0x36,
+  0x29, 0x21, 0x3d, 0x6c, 0x6f, 0x63, 0x6b, 0x67, 0x65, 0x6e, 0x29, 0x3f,
+  0x6c, 0x6f, 0x63, 0x6b, 0x67, 0x65, 0x6e, 0x3c, 0x3c, 0x31, 0x36, 0x3a,
+  0x6c, 0x6f, 0x63, 0x6b, 0x6f, 0x6c, 0x64, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x33, 0x32, 0x20, 0x6c,
+  0x6f, 0x63, 0x6b, 0x63, 0x75, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x54, 0x45,
+  0x52, 0x31, 0x29, 0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65,
+  0x77, 0x26, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3d, 0x3d, 0x30,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65, 0x77, 0x20, 0x7c, 0x3d,
+  0x20, 0x28, 0x75, 0x33, 0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x6f, 0x6e, 0x20, 0x6c, 0x6f, 0x73, 0x74, 0x20, 0x72, 0x61,
+  0x63, 0x65, 0x20, 0x74, 0x61, 0x6b, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x6b,
+  0x20, 0x61, 0x73, 0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x6f,
+  0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65,
+  0x77, 0x21, 0x3d, 0x6c, 0x6f, 0x63, 0x6b, 0x6f, 0x6c, 0x64, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x6b, 0x63, 0x75, 0x72, 0x20, 0x3d, 0x20, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26,
+  0x54, 0x54, 0x31, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e,
+  0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x6f, 0x6c,
+  0x64, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65, 0x77, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65, 0x77, 0x20, 0x3d, 0x20, 0x28,
+  0x6c, 0x6f, 0x63, 0x6b, 0x63, 0x75, 0x72, 0x3d, 0x3d, 0x6c, 0x6f, 0x63,
+  0x6b, 0x6f, 0x6c, 0x64, 0x29, 0x3f, 0x6c, 0x6f, 0x63, 0x6b, 0x6e, 0x65,
+  0x77, 0x3a, 0x6c, 0x6f, 0x63, 0x6b, 0x63, 0x75, 0x72, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
   0x20, 0x28, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
   0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
   0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20,
-  0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d,
+  0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x28, 0x6c, 0x6f, 0x63, 0x6b, 0x6e,
+  0x65, 0x77, 0x26, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x23, 0x65,
+  0x6c, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20,
+  0x54, 0x54, 0x32, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20,
+  0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20,
+  0x67, 0x65, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x6f, 0x6e,
+  0x65, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x42, 0x44, 0x41, 0x44, 0x41, 0x54,
+  0x54, 0x45, 0x20, 0x74, 0x74, 0x32, 0x6f, 0x6c, 0x64, 0x20, 0x3d, 0x20,
+  0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x41, 0x42, 0x44,
+  0x41, 0x44, 0x41, 0x54, 0x54, 0x45, 0x20, 0x74, 0x74, 0x32, 0x6e, 0x65,
+  0x77, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x32, 0x6f, 0x6c, 0x64, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x54, 0x54, 0x32, 0x47, 0x45, 0x4e, 0x28, 0x74, 0x74, 0x32, 0x6e, 0x65,
+  0x77, 0x29, 0x21, 0x3d, 0x28, 0x28, 0x74, 0x74, 0x67, 0x65, 0x6e, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x2b, 0x28, 0x75, 0x33, 0x32, 0x29, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x26,
+  0x30, 0x78, 0x46, 0x46, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x20,
+  0x3d, 0x20, 0x54, 0x54, 0x32, 0x50, 0x41, 0x43, 0x4b, 0x28, 0x54, 0x54,
+  0x32, 0x4b, 0x45, 0x59, 0x28, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x29,
+  0x2c, 0x20, 0x30, 0x2c, 0x20, 0x74, 0x74, 0x67, 0x65, 0x6e, 0x5f, 0x69,
+  0x6e, 0x69, 0x74, 0x2b, 0x28, 0x75, 0x33, 0x32, 0x29, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2c, 0x20, 0x54,
+  0x54, 0x32, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x28, 0x74, 0x74, 0x32, 0x6e,
+  0x65, 0x77, 0x29, 0x2c, 0x20, 0x54, 0x54, 0x32, 0x44, 0x45, 0x50, 0x54,
+  0x48, 0x28, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x29, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74,
+  0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49,
+  0x54, 0x45, 0x52, 0x31, 0x29, 0x26, 0x26, 0x54, 0x54, 0x32, 0x4c, 0x4f,
+  0x43, 0x4b, 0x28, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x29, 0x3d, 0x3d,
+  0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x20, 0x3d, 0x20, 0x54, 0x54,
+  0x32, 0x50, 0x41, 0x43, 0x4b, 0x28, 0x54, 0x54, 0x32, 0x4b, 0x45, 0x59,
+  0x28, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x29, 0x2c, 0x20, 0x67, 0x69,
+  0x64, 0x2b, 0x31, 0x2c, 0x20, 0x54, 0x54, 0x32, 0x47, 0x45, 0x4e, 0x28,
+  0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x29, 0x2c, 0x20, 0x54, 0x54, 0x32,
+  0x53, 0x43, 0x4f, 0x52, 0x45, 0x28, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77,
+  0x29, 0x2c, 0x20, 0x54, 0x54, 0x32, 0x44, 0x45, 0x50, 0x54, 0x48, 0x28,
+  0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x20, 0x3d, 0x20,
+  0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x6e, 0x20, 0x6c, 0x6f,
+  0x73, 0x74, 0x20, 0x72, 0x61, 0x63, 0x65, 0x20, 0x74, 0x61, 0x6b, 0x65,
+  0x20, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x61, 0x73, 0x20, 0x73, 0x65,
+  0x74, 0x20, 0x62, 0x79, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77,
+  0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74,
+  0x32, 0x6e, 0x65, 0x77, 0x21, 0x3d, 0x74, 0x74, 0x32, 0x6f, 0x6c, 0x64,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74,
+  0x32, 0x6e, 0x65, 0x77, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
   0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32,
-  0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c, 0x6f, 0x63,
-  0x6b, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79, 0x20, 0x6c, 0x6f,
-  0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d,
-  0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32, 0x5b, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c, 0x6f, 0x63, 0x6b, 0x2c,
-  0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b,
-  0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-  0x74, 0x32, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54,
-  0x65, 0x6d, 0x70, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x29, 0x74, 0x74, 0x32, 0x2e, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d,
-  0x61, 0x74, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x69,
-  0x6e, 0x20, 0x54, 0x54, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53,
-  0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26,
-  0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x30, 0x29, 0x3f, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x2d, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
+  0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2c, 0x20, 0x74, 0x74,
+  0x32, 0x6f, 0x6c, 0x64, 0x2c, 0x20, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x74, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x74, 0x32, 0x6e,
+  0x65, 0x77, 0x3d, 0x3d, 0x74, 0x74, 0x32, 0x6f, 0x6c, 0x64, 0x29, 0x3f,
+  0x74, 0x74, 0x32, 0x3a, 0x74, 0x74, 0x32, 0x6e, 0x65, 0x77, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76, 0x65, 0x72,
+  0x69, 0x66, 0x79, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x54, 0x45, 0x52,
+  0x31, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x32, 0x4c, 0x4f, 0x43,
+  0x4b, 0x28, 0x74, 0x74, 0x32, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
+  0x20, 0x54, 0x54, 0x32, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x28, 0x74, 0x74,
+  0x32, 0x29, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70,
+  0x6c, 0x79, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x64, 0x2c, 0x20, 0x72,
+  0x65, 0x73, 0x65, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26,
+  0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e,
+  0x70, 0x6c, 0x79, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x70, 0x6c, 0x79, 0x5f,
+  0x69, 0x6e, 0x69, 0x74, 0x2b, 0x31, 0x29, 0x21, 0x3d, 0x70, 0x6c, 0x79,
+  0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26,
+  0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e,
+  0x73, 0x64, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31, 0x29, 0x21, 0x3d,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54,
+  0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x70,
+  0x6c, 0x79, 0x2c, 0x20, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78, 0x63, 0x68, 0x67,
+  0x28, 0x26, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x5d, 0x2e, 0x73, 0x64, 0x2c, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32, 0x5b,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c, 0x6f, 0x63, 0x6b,
+  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e,
+  0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2d, 0x31, 0x5d, 0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67,
+  0x65, 0x74, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26,
+  0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e,
+  0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x67, 0x69, 0x64,
+  0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79,
+  0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x74, 0x6f, 0x6d,
+  0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54,
+  0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c, 0x6f,
+  0x63, 0x6b, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x2c, 0x20, 0x67,
+  0x69, 0x64, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x32, 0x5b,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
+  0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x74, 0x74, 0x32, 0x2e,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
+  0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74,
+  0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20,
+  0x54, 0x54, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
   0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41,
   0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3c, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x2b, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x6c, 0x6f, 0x61, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x75, 0x70, 0x64,
-  0x61, 0x74, 0x65, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x21,
-  0x3d, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x74, 0x74, 0x32,
-  0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x28, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x32,
-  0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68,
-  0x29, 0x74, 0x74, 0x32, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x74, 0x74, 0x32, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3e,
-  0x3d, 0x28, 0x73, 0x31, 0x36, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44,
-  0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21,
-  0x49, 0x53, 0x49, 0x4e, 0x46, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29,
+  0x63, 0x6f, 0x72, 0x65, 0x3e, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x2d, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45,
+  0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3c, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b,
+  0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c,
+  0x6f, 0x61, 0x64, 0x65, 0x64, 0x2c, 0x20, 0x75, 0x70, 0x64, 0x61, 0x74,
+  0x65, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x21, 0x3d, 0x67,
+  0x69, 0x64, 0x2b, 0x31, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x54, 0x54, 0x55,
+  0x4e, 0x49, 0x46, 0x49, 0x45, 0x44, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x66, 0x61, 0x6c,
+  0x73, 0x65, 0x0a, 0x23, 0x65, 0x6c, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x54, 0x54, 0x32, 0x43, 0x4f, 0x4d, 0x50,
+  0x41, 0x43, 0x54, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x54, 0x54, 0x32, 0x4b, 0x45, 0x59,
+  0x28, 0x74, 0x74, 0x32, 0x29, 0x3d, 0x3d, 0x28, 0x75, 0x33, 0x32, 0x29,
+  0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x3e, 0x3e, 0x34, 0x38, 0x29,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41,
-  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x6c,
-  0x70, 0x68, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
-  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d,
-  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x75, 0x74,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
-  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65,
-  0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a,
-  0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x74, 0x68,
-  0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x65,
-  0x64, 0x2c, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x75, 0x70, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20,
-  0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c,
-  0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x21, 0x3d, 0x67, 0x69,
-  0x64, 0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6e,
-  0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
-  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x54, 0x45,
-  0x52, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x5b, 0x67, 0x69, 0x64,
-  0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b, 0x28,
-  0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33,
-  0x32, 0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28,
-  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45,
-  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53,
-  0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a,
+  0x20, 0x26, 0x26, 0x54, 0x54, 0x32, 0x44, 0x45, 0x50, 0x54, 0x48, 0x28,
+  0x74, 0x74, 0x32, 0x29, 0x3e, 0x3d, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64,
+  0x5d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x74, 0x74,
+  0x32, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x28, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74,
+  0x32, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73,
+  0x68, 0x29, 0x74, 0x74, 0x32, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x74, 0x74, 0x32, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x3e, 0x3d, 0x28, 0x73, 0x31, 0x36, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x0a, 0x23, 0x65,
+  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x49, 0x53, 0x49, 0x4e,
+  0x46, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
+  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78,
-  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d, 0x2d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41,
-  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x3b,
-  0x20, 0x2f, 0x2f, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x2f,
-  0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61,
-  0x2c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x68, 0x61, 0x73, 0x68,
-  0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x61, 0x62, 0x20, 0x66,
-  0x6c, 0x6f, 0x77, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
-  0x73, 0x64, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
-  0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45,
-  0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
-  0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x64, 0x6f, 0x77, 0x6e, 0x20, 0x78, 0x36, 0x34, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61,
+  0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b,
+  0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x75, 0x74, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x28, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61,
+  0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b,
+  0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63,
+  0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45,
+  0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69,
+  0x73, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x65, 0x64, 0x2c, 0x20, 0x62,
+  0x61, 0x63, 0x6b, 0x75, 0x70, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x32, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6e, 0x21, 0x3d, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6e, 0x3e, 0x30, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
+  0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f,
+  0x76, 0x65, 0x73, 0x32, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58,
+  0x50, 0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x64, 0x2d, 0x31,
+  0x29, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x47, 0x45,
+  0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65,
+  0x29, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53,
+  0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28,
+  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54,
+  0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d,
+  0x31, 0x5d, 0x2d, 0x2d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
+  0x5d, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
+  0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e,
+  0x64, 0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61, 0x2c, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x2f, 0x2f, 0x20,
+  0x65, 0x6e, 0x64, 0x20, 0x61, 0x62, 0x20, 0x66, 0x6c, 0x6f, 0x77, 0x20,
+  0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
+  0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74,
+  0x6f, 0x72, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20,
+  0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
   0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x64, 0x6f,
-  0x77, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77,
-  0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x6f, 0x77, 0x6e,
+  0x20, 0x78, 0x36, 0x34, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23,
+  0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x20, 0x69,
+  0x6e, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x78,
+  0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65,
+  0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x6c,
+  0x6c, 0x20, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72, 0x65, 0x6e, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78,
+  0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
+  0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73,
+  0x64, 0x5d, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x68, 0x69, 0x6c, 0x64, 0x72,
-  0x65, 0x6e, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49,
-  0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20,
-  0x61, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x61, 0x20, 0x70, 0x72,
-  0x75, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x77, 0x61,
-  0x72, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x65, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68,
-  0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b,
-  0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e,
-  0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
-  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
-  0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20,
+  0x2f, 0x20, 0x61, 0x70, 0x70, 0x6c, 0x79, 0x20, 0x61, 0x6c, 0x70, 0x68,
+  0x61, 0x62, 0x65, 0x74, 0x61, 0x20, 0x70, 0x72, 0x75, 0x6e, 0x69, 0x6e,
+  0x67, 0x20, 0x64, 0x6f, 0x77, 0x6e, 0x77, 0x61, 0x72, 0x64, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
+  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32,
+  0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
+  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42,
+  0x45, 0x54, 0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62, 0x72,
+  0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62,
+  0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x20, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61, 0x2c, 0x20, 0x73, 0x65, 0x74,
+  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d,
+  0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x54, 0x54, 0x49, 0x4e, 0x44,
+  0x45, 0x58, 0x32, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x28, 0x21, 0x52, 0x4d, 0x4f,
+  0x29, 0x7c, 0x7c, 0x28, 0x52, 0x4d, 0x4f, 0x26, 0x26, 0x67, 0x69, 0x64,
+  0x3c, 0x52, 0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
+  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31,
+  0x5d, 0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
+  0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28,
+  0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x32, 0x2d, 0x31, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48,
+  0x41, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d,
+  0x61, 0x74, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x69,
+  0x6e, 0x20, 0x54, 0x54, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x69,
+  0x6e, 0x20, 0x3d, 0x3e, 0x20, 0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63,
+  0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e,
+  0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x70, 0x6c, 0x79,
+  0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20,
+  0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3c, 0x30, 0x29,
+  0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x70, 0x6c, 0x79, 0x3a, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76, 0x65, 0x72, 0x69, 0x66, 0x79,
+  0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66,
+  0x20, 0x54, 0x54, 0x32, 0x43, 0x4f, 0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x32, 0x4c, 0x4f, 0x43, 0x4b,
+  0x28, 0x74, 0x74, 0x32, 0x29, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d,
+  0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68,
+  0x67, 0x28, 0x26, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d,
+  0x70, 0x5d, 0x2e, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x67, 0x69, 0x64,
+  0x2b, 0x31, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3b, 0x0a,
+  0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x3d, 0x3d, 0x67, 0x69, 0x64,
+  0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x49, 0x53, 0x49, 0x4e, 0x46, 0x28,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x51, 0x53, 0x29, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x21, 0x62, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x20,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x61, 0x62, 0x64, 0x61, 0x64, 0x61, 0x2c,
-  0x20, 0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
-  0x69, 0x64, 0x3d, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x74,
-  0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x32, 0x3e, 0x31, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x28,
-  0x21, 0x52, 0x4d, 0x4f, 0x29, 0x7c, 0x7c, 0x28, 0x52, 0x4d, 0x4f, 0x26,
-  0x26, 0x67, 0x69, 0x64, 0x3c, 0x52, 0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52,
-  0x4b, 0x45, 0x52, 0x53, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
-  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a,
+  0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72,
+  0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4e,
+  0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43,
+  0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73,
+  0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x32, 0x43,
+  0x4f, 0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x2c, 0x20, 0x65, 0x6e, 0x74, 0x72,
+  0x79, 0x20, 0x75, 0x6e, 0x63, 0x68, 0x61, 0x6e, 0x67, 0x65, 0x64, 0x20,
+  0x73, 0x69, 0x6e, 0x63, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78,
+  0x63, 0x68, 0x67, 0x28, 0x26, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x5d, 0x2c, 0x20, 0x74, 0x74, 0x32, 0x2c, 0x20, 0x54,
+  0x54, 0x32, 0x50, 0x41, 0x43, 0x4b, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72,
+  0x6b, 0x3e, 0x3e, 0x34, 0x38, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31,
+  0x2c, 0x20, 0x54, 0x54, 0x32, 0x47, 0x45, 0x4e, 0x28, 0x74, 0x74, 0x32,
+  0x29, 0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d,
+  0x29, 0x29, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e,
+  0x68, 0x61, 0x73, 0x68, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x74, 0x74, 0x32, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x3d,
+  0x20, 0x28, 0x54, 0x54, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x20, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x31, 0x36, 0x29, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+  0x74, 0x32, 0x2e, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x67, 0x69, 0x64, 0x2b, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e, 0x70, 0x6c, 0x79,
+  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x2b, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e, 0x73, 0x64, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x54, 0x54, 0x32, 0x5b,
+  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x3d, 0x74, 0x74, 0x32, 0x3b,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x65,
+  0x6c, 0x65, 0x61, 0x73, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x2f,
+  0x2f, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61,
+  0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28,
+  0x26, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d,
+  0x2e, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31,
+  0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x64, 0x2d, 0x2d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c, 0x79, 0x2d, 0x2d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20,
+  0x3d, 0x20, 0x21, 0x73, 0x74, 0x6d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x73,
+  0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x73, 0x69, 0x74, 0x65, 0x20, 0x74,
+  0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x75, 0x6e, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
+  0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73,
+  0x64, 0x5d, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x20, 0x62, 0x69, 0x72,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x73, 0x64, 0x3c, 0x31,
+  0x26, 0x26, 0x21, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f,
+  0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x69, 0x64,
+  0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x2c, 0x30, 0x2c, 0x28, 0x75, 0x33,
+  0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+  0x73, 0x70, 0x6c, 0x69, 0x74, 0x2c, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x20,
+  0x6f, 0x6e, 0x20, 0x6f, 0x70, 0x65, 0x6e, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x20, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x75, 0x6e, 0x63, 0x6c, 0x61, 0x69, 0x6d, 0x65, 0x64, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64,
+  0x3d, 0x3d, 0x30, 0x26, 0x26, 0x73, 0x64, 0x3c, 0x31, 0x26, 0x26, 0x72,
+  0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x20, 0x3d, 0x20,
+  0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74,
+  0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d,
+  0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f,
+  0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4e, 0x53,
+  0x50, 0x4c, 0x49, 0x54, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x6e, 0x3d, 0x30, 0x3b, 0x6e, 0x3c, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x73, 0x6c, 0x6f, 0x74, 0x26, 0x26, 0x6e, 0x3c, 0x4d, 0x41, 0x58, 0x53,
+  0x50, 0x4c, 0x49, 0x54, 0x3b, 0x6e, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69,
-  0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20, 0x20,
-  0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x32,
-  0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b,
-  0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x68, 0x61, 0x6e, 0x64,
-  0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x54, 0x2c, 0x20, 0x6d, 0x61,
-  0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x3d, 0x3e, 0x20, 0x64, 0x69, 0x73,
-  0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x61, 0x74,
-  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54,
-  0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3e, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2b, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x20, 0x3d, 0x20, 0x28, 0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x3c, 0x30, 0x29, 0x3f, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x70,
-  0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x76, 0x65,
-  0x72, 0x69, 0x66, 0x79, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x74,
-  0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26,
-  0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e,
-  0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x2c,
-  0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74,
-  0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6e, 0x3d, 0x3d, 0x67,
-  0x69, 0x64, 0x2b, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x49, 0x53, 0x49, 0x4e,
-  0x46, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21,
-  0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x51, 0x53, 0x29,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x61,
+  0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28,
+  0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52,
+  0x53, 0x4f, 0x50, 0x45, 0x4e, 0x2b, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70,
+  0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x2b,
+  0x6e, 0x2a, 0x34, 0x5d, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x26, 0x53,
+  0x50, 0x53, 0x54, 0x41, 0x54, 0x45, 0x29, 0x3d, 0x3d, 0x53, 0x50, 0x4f,
+  0x50, 0x45, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x61, 0x74, 0x6f, 0x6d,
+  0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f,
+  0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x50,
+  0x4c, 0x49, 0x54, 0x2b, 0x6e, 0x2a, 0x34, 0x2b, 0x32, 0x5d, 0x2c, 0x30,
+  0x2c, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3c, 0x61, 0x74, 0x6f,
+  0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52,
+  0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53,
+  0x50, 0x4c, 0x49, 0x54, 0x2b, 0x6e, 0x2a, 0x34, 0x2b, 0x31, 0x5d, 0x2c,
+  0x30, 0x2c, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x68, 0x65, 0x6c,
+  0x70, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x2c, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x66, 0x69, 0x6e, 0x69,
+  0x73, 0x68, 0x65, 0x64, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67, 0x72,
+  0x6f, 0x75, 0x70, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x73, 0x20,
+  0x74, 0x68, 0x65, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d,
+  0x30, 0x26, 0x26, 0x73, 0x64, 0x3c, 0x31, 0x26, 0x26, 0x72, 0x6f, 0x6f,
+  0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x26, 0x26, 0x21, 0x62, 0x68, 0x65,
+  0x6c, 0x70, 0x65, 0x72, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65,
+  0x6d, 0x5f, 0x66, 0x65, 0x6e, 0x63, 0x65, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x47, 0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
+  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
+  0x69, 0x6e, 0x63, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c,
+  0x69, 0x74, 0x5b, 0x52, 0x53, 0x44, 0x4f, 0x4e, 0x45, 0x5d, 0x29, 0x2b,
+  0x31, 0x3d, 0x3d, 0x28, 0x75, 0x33, 0x32, 0x29, 0x54, 0x4f, 0x54, 0x41,
+  0x4c, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65,
+  0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56,
+  0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6c, 0x61, 0x69,
+  0x6d, 0x65, 0x64, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x2c, 0x20, 0x6e, 0x6f, 0x74,
+  0x20, 0x61, 0x6c, 0x6c, 0x20, 0x6b, 0x65, 0x79, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28,
+  0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d,
+  0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53,
+  0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4e, 0x52, 0x4f, 0x4f, 0x54,
+  0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x2c, 0x4d, 0x41, 0x58, 0x4d, 0x4f,
+  0x56, 0x45, 0x53, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6e, 0x3d, 0x30,
+  0x3b, 0x6e, 0x3c, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74,
+  0x3b, 0x6e, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b,
+  0x65, 0x79, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x52, 0x6f,
+  0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x52, 0x4f,
+  0x4f, 0x54, 0x2b, 0x6e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68,
+  0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74,
+  0x5b, 0x52, 0x53, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x2b, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3b,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65,
-  0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d,
-  0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41,
-  0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-  0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52,
-  0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x74, 0x32, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61,
-  0x73, 0x68, 0x29, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5e, 0x28, 0x48, 0x61,
-  0x73, 0x68, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74,
-  0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x54, 0x54, 0x53, 0x63, 0x6f,
-  0x72, 0x65, 0x29, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x31,
-  0x36, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68,
-  0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32, 0x2e, 0x6c, 0x6f, 0x63, 0x6b,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74,
-  0x32, 0x2e, 0x70, 0x6c, 0x79, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x70,
-  0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x2b, 0x31, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x32,
-  0x2e, 0x73, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x73, 0x65,
-  0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2b, 0x31,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x54, 0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d,
-  0x3d, 0x74, 0x74, 0x32, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x65, 0x6c, 0x65,
-  0x61, 0x73, 0x65, 0x20, 0x6c, 0x6f, 0x63, 0x6b, 0x0a, 0x2f, 0x2f, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f,
-  0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x54,
-  0x54, 0x32, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x2e, 0x6c,
-  0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x2c, 0x20,
-  0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x64, 0x2d, 0x2d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c, 0x79, 0x2d, 0x2d, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20, 0x3d, 0x20,
-  0x21, 0x73, 0x74, 0x6d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x77, 0x69,
-  0x74, 0x63, 0x68, 0x20, 0x73, 0x69, 0x74, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x75, 0x6e, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76,
-  0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
-  0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x20, 0x62, 0x69, 0x72, 0x64, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69,
-  0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x73, 0x64, 0x3c, 0x31, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
-  0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x66, 0x69, 0x6e, 0x69,
-  0x74, 0x6f, 0x2c, 0x30, 0x2c, 0x28, 0x75, 0x33, 0x32, 0x29, 0x67, 0x69,
-  0x64, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x3c, 0x31, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
-  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43,
-  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
-  0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3e, 0x30, 0x26, 0x26, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x2d, 0x49, 0x4e, 0x46, 0x2d, 0x31, 0x3e, 0x62, 0x65, 0x73, 0x74,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x74,
+  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x49, 0x4e, 0x46, 0x2d,
+  0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x52, 0x6f,
+  0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4d, 0x4f,
+  0x56, 0x45, 0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63,
+  0x68, 0x67, 0x28, 0x69, 0x64, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x2c,
+  0x30, 0x2c, 0x28, 0x75, 0x33, 0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x3c, 0x31,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72,
+  0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
+  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x61, 0x6c, 0x70, 0x68,
-  0x61, 0x62, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x6d, 0x61,
-  0x78, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x69, 0x6e, 0x67, 0x2b, 0x2b, 0x20,
-  0x78, 0x31, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x61,
+  0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x61, 0x20, 0x6e, 0x65, 0x67,
+  0x61, 0x6d, 0x61, 0x78, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x69, 0x6e, 0x67,
+  0x2b, 0x2b, 0x20, 0x78, 0x31, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d,
-  0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x38, 0x20, 0x66,
-  0x6c, 0x61, 0x67, 0x20, 0x3d, 0x20, 0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f,
-  0x57, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
-  0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65,
-  0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64,
-  0x2b, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68,
-  0x61, 0x63, 0x6b, 0x2c, 0x20, 0x61, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x61,
-  0x6c, 0x70, 0x68, 0x61, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67,
-  0x2c, 0x20, 0x73, 0x65, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x20, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x20, 0x3e, 0x3d, 0x20, 0x62, 0x65, 0x74, 0x61, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f,
-  0x56, 0x45, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3c, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b,
-  0x42, 0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
-  0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69,
-  0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x65,
-  0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x68, 0x61, 0x63,
-  0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x72, 0x65, 0x73, 0x65,
-  0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e,
-  0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64,
-  0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
-  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
+  0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75,
+  0x38, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x3d, 0x20, 0x46, 0x41, 0x49,
+  0x4c, 0x4c, 0x4f, 0x57, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74,
+  0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68,
+  0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b,
+  0x28, 0x73, 0x64, 0x2b, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50,
+  0x48, 0x41, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x68, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x61, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x73, 0x65, 0x74, 0x74,
+  0x69, 0x6e, 0x67, 0x2c, 0x20, 0x73, 0x65, 0x74, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x77, 0x68, 0x65, 0x6e,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3e, 0x3d, 0x20, 0x62, 0x65,
+  0x74, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4e, 0x55, 0x4c,
+  0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x3c, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72,
   0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x20, 0x20, 0x2f,
   0x2f, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x3d,
-  0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x65, 0x73, 0x65,
-  0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x5d, 0x5e, 0x3d, 0x4c, 0x4d, 0x52, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6e,
-  0x65, 0x67, 0x61, 0x6d, 0x61, 0x78, 0x65, 0x64, 0x20, 0x61, 0x6c, 0x70,
-  0x68, 0x61, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68,
-  0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b,
-  0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41,
-  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-  0x6c, 0x61, 0x67, 0x20, 0x3d, 0x20, 0x45, 0x58, 0x41, 0x43, 0x54, 0x53,
-  0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c,
-  0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x73, 0x64, 0x3d, 0x3d, 0x31, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65,
-  0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x26, 0x26,
-  0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f,
-  0x56, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x2c, 0x20, 0x6d, 0x65, 0x72, 0x67, 0x65, 0x20, 0x70, 0x61, 0x72,
+  0x74, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x6f,
+  0x66, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x2c,
+  0x20, 0x6d, 0x69, 0x6e, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x70, 0x61,
+  0x72, 0x74, 0x69, 0x63, 0x69, 0x70, 0x61, 0x6e, 0x74, 0x73, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x72,
+  0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x26, 0x26, 0x73, 0x64,
+  0x3d, 0x3d, 0x31, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d,
+  0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x26, 0x26, 0x21, 0x49, 0x53,
+  0x49, 0x4e, 0x46, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6c, 0x69,
+  0x74, 0x6b, 0x65, 0x79, 0x20, 0x3d, 0x20, 0x53, 0x50, 0x4c, 0x49, 0x54,
+  0x4b, 0x45, 0x59, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33,
+  0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63,
+  0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c, 0x69,
+  0x74, 0x5b, 0x52, 0x53, 0x53, 0x4c, 0x4f, 0x54, 0x2b, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+  0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65,
+  0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x6f, 0x77, 0x6e, 0x65, 0x72, 0x20, 0x63, 0x6c,
+  0x6f, 0x73, 0x65, 0x73, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x20, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x2c, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x73, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x64, 0x20, 0x62, 0x65, 0x66, 0x6f,
+  0x72, 0x65, 0x20, 0x63, 0x6c, 0x6f, 0x73, 0x65, 0x20, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x61, 0x72, 0x74, 0x73,
+  0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x2c, 0x20, 0x6c, 0x61, 0x74, 0x65,
+  0x72, 0x20, 0x6a, 0x6f, 0x69, 0x6e, 0x73, 0x20, 0x66, 0x61, 0x69, 0x6c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x6c, 0x6f, 0x74,
+  0x3e, 0x30, 0x26, 0x26, 0x21, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6d, 0x70, 0x62, 0x20, 0x3d, 0x20, 0x28, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f,
+  0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x4f, 0x50, 0x45,
+  0x4e, 0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c,
+  0x53, 0x50, 0x43, 0x4c, 0x4f, 0x53, 0x45, 0x44, 0x29, 0x3e, 0x3d, 0x53,
+  0x50, 0x4a, 0x4f, 0x49, 0x4e, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a,
+  0x74, 0x6d, 0x70, 0x62, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d,
+  0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x53,
+  0x63, 0x6f, 0x72, 0x65, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d,
+  0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53,
+  0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x43, 0x4f, 0x52, 0x45,
+  0x2b, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x6b, 0x65, 0x79, 0x5d, 0x2c, 0x28,
+  0x75, 0x33, 0x32, 0x29, 0x6e, 0x2c, 0x28, 0x75, 0x33, 0x32, 0x29, 0x28,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x49, 0x4e, 0x46, 0x2b, 0x31, 0x29,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x74, 0x6d,
+  0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x21, 0x3d, 0x6e, 0x26, 0x26, 0x74,
+  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x2b, 0x49, 0x4e, 0x46, 0x2b, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70,
+  0x61, 0x72, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x2c, 0x20, 0x6e, 0x6f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x61, 0x6c,
+  0x70, 0x68, 0x61, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x62, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46,
+  0x3b, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72, 0x65,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+  0x73, 0x20, 0x68, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74,
+  0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x29, 0x26,
+  0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50,
+  0x48, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e,
+  0x46, 0x3b, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x67, 0x6e, 0x6f, 0x72,
+  0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
+  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61,
+  0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x5e, 0x3d, 0x4c, 0x4d, 0x52,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x6e, 0x65, 0x67, 0x61, 0x6d, 0x61, 0x78, 0x65,
+  0x64, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63,
+  0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c,
+  0x50, 0x48, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
+  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73,
+  0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3d, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x3d, 0x20, 0x45,
+  0x58, 0x41, 0x43, 0x54, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x73,
+  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64, 0x3d, 0x3d, 0x31, 0x26,
+  0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e,
+  0x4f, 0x4e, 0x45, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4e,
+  0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73,
+  0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x2c, 0x20,
+  0x70, 0x75, 0x62, 0x6c, 0x69, 0x73, 0x68, 0x20, 0x72, 0x61, 0x69, 0x73,
+  0x65, 0x64, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x74, 0x6f, 0x20,
+  0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x77, 0x6f, 0x72, 0x6b, 0x2d, 0x67,
+  0x72, 0x6f, 0x75, 0x70, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x3d, 0x20, 0x28, 0x72,
+  0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x29, 0x3f, 0x28, 0x73,
+  0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78,
+  0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74, 0x53, 0x70, 0x6c,
+  0x69, 0x74, 0x5b, 0x52, 0x53, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x2c,
+  0x30, 0x2c, 0x30, 0x29, 0x3a, 0x49, 0x4e, 0x46, 0x2a, 0x32, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6e, 0x3c, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x2b, 0x49, 0x4e, 0x46, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20,
+  0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x61, 0x74, 0x6f, 0x6d, 0x5f,
+  0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f,
+  0x74, 0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x41, 0x4c, 0x50,
+  0x48, 0x41, 0x5d, 0x2c, 0x28, 0x75, 0x33, 0x32, 0x29, 0x6e, 0x2c, 0x28,
+  0x75, 0x33, 0x32, 0x29, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x49,
+  0x4e, 0x46, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-  0x20, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42,
-  0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x3d, 0x20, 0x46,
-  0x41, 0x49, 0x4c, 0x48, 0x49, 0x47, 0x48, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
+  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32,
+  0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x3d,
+  0x20, 0x46, 0x41, 0x49, 0x4c, 0x48, 0x49, 0x47, 0x48, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69,
+  0x69, 0x64, 0x2c, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e,
+  0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x5d, 0x26, 0x49, 0x49, 0x44, 0x29, 0x26, 0x26, 0x66, 0x6c, 0x61, 0x67,
+  0x3e, 0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x69, 0x64,
-  0x2c, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
-  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26,
-  0x49, 0x49, 0x44, 0x29, 0x26, 0x26, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x46,
-  0x41, 0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x49,
-  0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x20,
-  0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x69, 0x64, 0x20, 0x68,
-  0x61, 0x63, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x72, 0x65,
-  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
-  0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x20,
-  0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x20, 0x68, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x20,
+  0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74,
+  0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32,
+  0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63,
   0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41,
-  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
-  0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54,
-  0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42,
+  0x45, 0x54, 0x41, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64,
-  0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x66, 0x6f, 0x72, 0x77,
-  0x61, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65,
-  0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x69, 0x74,
-  0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
-  0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73,
-  0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
-  0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49,
+  0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74,
+  0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x66, 0x6f,
+  0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c,
+  0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x6e, 0x65, 0x77, 0x20,
+  0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45,
+  0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76,
+  0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f,
-  0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f,
+  0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
-  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d,
-  0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
-  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
-  0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x42,
-  0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
-  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
-  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
-  0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41,
-  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48,
+  0x41, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32,
+  0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41,
+  0x5d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32,
+  0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d, 0x31, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f,
-  0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f,
-  0x64, 0x65, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x65, 0x74, 0x20, 0x69, 0x69, 0x64, 0x20, 0x64, 0x6f, 0x6e, 0x65, 0x20,
-  0x66, 0x6c, 0x61, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
-  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d,
+  0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x73, 0x65, 0x74, 0x20, 0x69, 0x69, 0x64, 0x20, 0x64, 0x6f, 0x6e,
+  0x65, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f,
+  0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45,
-  0x20, 0x7c, 0x20, 0x49, 0x49, 0x44, 0x44, 0x4f, 0x4e, 0x45, 0x20, 0x7c,
-  0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x20, 0x7c, 0x20, 0x49, 0x49, 0x44, 0x44, 0x4f, 0x4e, 0x45,
+  0x20, 0x7c, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x61,
-  0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x20, 0x20, 0x20,
-  0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20,
+  0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x20,
+  0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x68,
-  0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
-  0x6c, 0x61, 0x67, 0x3e, 0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f, 0x57, 0x0a,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74, 0x6f,
+  0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x46, 0x41, 0x49, 0x4c, 0x4c, 0x4f,
+  0x57, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f,
+  0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f, 0x76,
+  0x65, 0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45,
-  0x4e, 0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21,
-  0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x51, 0x53,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53,
-  0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64,
-  0x5d, 0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45,
-  0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64,
-  0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41,
-  0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x29, 0x20, 0x2f, 0x2f,
-  0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x3f, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c,
+  0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
+  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26,
+  0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b,
+  0x73, 0x64, 0x5d, 0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45,
+  0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d,
+  0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x53,
+  0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x29, 0x20,
+  0x2f, 0x2f, 0x20, 0x54, 0x4f, 0x44, 0x4f, 0x3a, 0x20, 0x3f, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b,
+  0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62, 0x66,
+  0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62, 0x72,
+  0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x54,
+  0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e, 0x31, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x21, 0x28, 0x72, 0x6f, 0x6f, 0x74, 0x65, 0x78, 0x63, 0x6c, 0x75,
+  0x64, 0x65, 0x26, 0x26, 0x73, 0x64, 0x3d, 0x3d, 0x31, 0x29, 0x20, 0x2f,
+  0x2f, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+  0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6f, 0x66, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28,
+  0x72, 0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x26, 0x26, 0x73,
+  0x64, 0x3d, 0x3d, 0x32, 0x26, 0x26, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63,
+  0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x52, 0x6f, 0x6f, 0x74,
+  0x53, 0x70, 0x6c, 0x69, 0x74, 0x5b, 0x52, 0x53, 0x53, 0x4c, 0x4f, 0x54,
+  0x2b, 0x53, 0x50, 0x4c, 0x49, 0x54, 0x4b, 0x45, 0x59, 0x28, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f,
+  0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x29, 0x5d, 0x2c, 0x30,
+  0x2c, 0x30, 0x29, 0x3e, 0x30, 0x29, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x61,
+  0x72, 0x74, 0x69, 0x61, 0x6c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48,
+  0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73,
+  0x64, 0x5d, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x68, 0x61,
+  0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x54, 0x2c, 0x20,
+  0x6d, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x3d, 0x3e, 0x20, 0x64,
+  0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d,
+  0x61, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49,
+  0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29,
+  0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x30, 0x29, 0x3f, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2b, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x49,
+  0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29,
+  0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3c, 0x30, 0x29, 0x3f, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2d, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x54, 0x54, 0x4d, 0x6f,
+  0x76, 0x65, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28,
+  0x54, 0x54, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x74, 0x74, 0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x20, 0x7c, 0x20,
+  0x28, 0x74, 0x74, 0x61, 0x67, 0x65, 0x26, 0x30, 0x78, 0x33, 0x46, 0x29,
+  0x3c, 0x3c, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x6c,
   0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64,
-  0x5d, 0x3e, 0x3d, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62, 0x66, 0x6f, 0x72,
-  0x77, 0x61, 0x72, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62, 0x72, 0x65, 0x73,
-  0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x74, 0x74, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x31, 0x3e, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68,
-  0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b,
-  0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x31, 0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x68,
-  0x61, 0x6e, 0x64, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x54, 0x54, 0x2c,
-  0x20, 0x6d, 0x61, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x3d, 0x3e, 0x20,
-  0x64, 0x69, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x6d, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28,
-  0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x30, 0x29, 0x3f,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2b, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28,
-  0x49, 0x53, 0x4d, 0x41, 0x54, 0x45, 0x28, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x29, 0x26, 0x26, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3c, 0x30, 0x29, 0x3f,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d, 0x70, 0x6c, 0x79, 0x3a, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x20, 0x74,
-  0x72, 0x69, 0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x76, 0x6f,
-  0x69, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x72, 0x61, 0x63, 0x65, 0x20, 0x63,
-  0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61,
-  0x73, 0x6b, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e,
-  0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x5e, 0x28,
-  0x48, 0x61, 0x73, 0x68, 0x29, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5e, 0x28,
-  0x48, 0x61, 0x73, 0x68, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x6c, 0x6f, 0x74, 0x20, 0x31, 0x2c, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x20, 0x74, 0x72, 0x69, 0x63,
+  0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x76, 0x6f, 0x69, 0x64, 0x69,
+  0x6e, 0x67, 0x20, 0x72, 0x61, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x6e, 0x64,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73,
+  0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x4b,
+  0x45, 0x59, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x74, 0x74,
+  0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74,
+  0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74, 0x31,
+  0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x62,
+  0x75, 0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
   0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
   0x70, 0x6c, 0x79, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74,
-  0x31, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x31, 0x5b, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x5d, 0x3b, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x28, 0x28, 0x75, 0x38, 0x29, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x74, 0x74, 0x31, 0x2e,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x75, 0x38, 0x29, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e,
-  0x3d, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73,
-  0x68, 0x3d, 0x3d, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e, 0x28,
-  0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29,
-  0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5e, 0x28, 0x48,
-  0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74,
-  0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x3e, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x74, 0x74,
-  0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x74,
-  0x74, 0x61, 0x67, 0x65, 0x21, 0x3d, 0x28, 0x74, 0x74, 0x31, 0x2e, 0x66,
-  0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x74, 0x74, 0x61, 0x67, 0x65, 0x21, 0x3d, 0x28, 0x74, 0x74,
-  0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32, 0x29, 0x2b, 0x32,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x20, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x54, 0x54, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74,
-  0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x28, 0x54, 0x54, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e,
-  0x66, 0x6c, 0x61, 0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
-  0x66, 0x6c, 0x61, 0x67, 0x20, 0x7c, 0x20, 0x28, 0x74, 0x74, 0x61, 0x67,
-  0x65, 0x26, 0x30, 0x78, 0x33, 0x46, 0x29, 0x3c, 0x3c, 0x32, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x38, 0x29, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x54, 0x54, 0x31, 0x5b, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x5d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x31, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65,
+  0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79,
+  0x20, 0x73, 0x6c, 0x6f, 0x74, 0x73, 0x2c, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x68, 0x61, 0x73, 0x68, 0x66, 0x75, 0x6c, 0x6c, 0x20, 0x65, 0x73, 0x74,
+  0x69, 0x6d, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x73, 0x61,
+  0x76, 0x65, 0x28, 0x54, 0x54, 0x31, 0x2c, 0x20, 0x74, 0x74, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x31, 0x2c, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
+  0x2c, 0x20, 0x74, 0x74, 0x31, 0x2c, 0x20, 0x74, 0x74, 0x61, 0x67, 0x65,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b,
+  0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x36, 0x5d, 0x2b, 0x2b, 0x3b,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x20, 0x2f,
   0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x73, 0x61, 0x76, 0x65, 0x20, 0x74,
   0x6f, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
@@ -5806,1028 +7591,1508 @@ const char zeta_cl[] = {
   0x70, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x73, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x78, 0x69, 0x74, 0x20,
   0x3d, 0x20, 0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78,
-  0x63, 0x68, 0x67, 0x28, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x2c, 0x30,
-  0x2c, 0x30, 0x29, 0x3e, 0x30, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a,
-  0x62, 0x65, 0x78, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d,
-  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x65, 0x78, 0x69, 0x74,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61,
-  0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62,
-  0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72,
-  0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f,
-  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x63, 0x68, 0x67, 0x28, 0x69, 0x64, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f,
+  0x2c, 0x30, 0x2c, 0x30, 0x29, 0x3e, 0x30, 0x29, 0x3f, 0x74, 0x72, 0x75,
+  0x65, 0x3a, 0x62, 0x65, 0x78, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x70, 0x20, 0x66,
+  0x6c, 0x61, 0x67, 0x20, 0x73, 0x65, 0x74, 0x20, 0x62, 0x79, 0x20, 0x68,
+  0x6f, 0x73, 0x74, 0x2c, 0x20, 0x77, 0x61, 0x6c, 0x6c, 0x20, 0x63, 0x6c,
+  0x6f, 0x63, 0x6b, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x72, 0x6f, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x65, 0x78, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x2a, 0x73, 0x74, 0x6f,
+  0x70, 0x66, 0x6c, 0x61, 0x67, 0x3e, 0x30, 0x29, 0x3f, 0x74, 0x72, 0x75,
+  0x65, 0x3a, 0x62, 0x65, 0x78, 0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73,
+  0x6c, 0x69, 0x63, 0x65, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x62, 0x75,
+  0x64, 0x67, 0x65, 0x74, 0x2c, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70,
+  0x6f, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x6e, 0x65, 0x78, 0x74,
+  0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x65,
+  0x6e, 0x74, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x73, 0x75, 0x73, 0x70, 0x65, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x28, 0x73,
+  0x6c, 0x69, 0x63, 0x65, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x3e, 0x30,
+  0x26, 0x26, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b, 0x67,
+  0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x31, 0x5d, 0x2d, 0x73, 0x6c, 0x69,
+  0x63, 0x65, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3e, 0x3d, 0x73, 0x6c, 0x69,
+  0x63, 0x65, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x29, 0x3f, 0x74, 0x72,
+  0x75, 0x65, 0x3a, 0x62, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6e, 0x64, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
+  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x62, 0x65, 0x78, 0x69, 0x74, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72,
+  0x64, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e,
+  0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47,
+  0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x70, 0x69, 0x63,
+  0x6b, 0x65, 0x72, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23,
+  0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23,
-  0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d,
-  0x6f, 0x76, 0x65, 0x2c, 0x20, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c,
-  0x20, 0x6c, 0x6d, 0x72, 0x2d, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69,
-  0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x75, 0x6c,
-  0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x62, 0x73, 0x65, 0x72, 0x76,
-  0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
-  0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
-  0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f,
-  0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d,
-  0x26, 0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x5d, 0x26, 0x4b, 0x49, 0x43, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x45, 0x58, 0x54, 0x29, 0x0a, 0x20,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x74,
+  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x20, 0x6c, 0x6d, 0x72, 0x2d, 0x72,
+  0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x6f, 0x62, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x62,
+  0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3e,
+  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48,
+  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x3d,
+  0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x51, 0x53, 0x29, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21,
   0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74,
-  0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44,
-  0x44, 0x4f, 0x4e, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b,
-  0x73, 0x64, 0x5d, 0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45,
-  0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64,
-  0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41,
-  0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
-  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x34, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x4e,
-  0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
-  0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x72,
-  0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61,
-  0x72, 0x63, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
-  0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20, 0x73, 0x6d,
-  0x70, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f,
-  0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c,
-  0x65, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64,
-  0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x74, 0x74, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x31, 0x3e, 0x31, 0x26, 0x26, 0x74, 0x74, 0x69,
-  0x6e, 0x64, 0x65, 0x78, 0x32, 0x3c, 0x3d, 0x31, 0x29, 0x26, 0x26, 0x67,
-  0x69, 0x64, 0x3e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x52, 0x4d, 0x4f, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f,
-  0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3e, 0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x52,
-  0x4d, 0x4f, 0x26, 0x26, 0x67, 0x69, 0x64, 0x3e, 0x3d, 0x52, 0x41, 0x4e,
-  0x44, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x51, 0x53,
+  0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4b, 0x49, 0x43,
   0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
   0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26,
-  0x4b, 0x49, 0x43, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x45, 0x58, 0x54, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
   0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x5d, 0x26, 0x45, 0x58, 0x54, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x44, 0x4f, 0x4e, 0x45, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4e, 0x55,
+  0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26,
+  0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64,
+  0x5d, 0x3e, 0x3d, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x3d, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56,
+  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x74, 0x65,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74,
+  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65,
+  0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c,
+  0x61, 0x7a, 0x79, 0x20, 0x73, 0x6d, 0x70, 0x2c, 0x20, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f,
+  0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x28, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x73, 0x6c, 0x6f, 0x74,
+  0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x28, 0x28, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e,
+  0x31, 0x26, 0x26, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x32, 0x3c,
+  0x3d, 0x31, 0x26, 0x26, 0x21, 0x54, 0x54, 0x55, 0x4e, 0x49, 0x46, 0x49,
+  0x45, 0x44, 0x29, 0x26, 0x26, 0x67, 0x69, 0x64, 0x3e, 0x30, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7c, 0x7c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x52, 0x4d, 0x4f, 0x2c,
+  0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3e,
+  0x20, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x28, 0x52, 0x4d, 0x4f, 0x26, 0x26, 0x54, 0x4f,
+  0x54, 0x41, 0x4c, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x3e, 0x52,
+  0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52, 0x4b, 0x45, 0x52, 0x53, 0x26, 0x26,
+  0x67, 0x69, 0x64, 0x3e, 0x3d, 0x52, 0x41, 0x4e, 0x44, 0x57, 0x4f, 0x52,
+  0x4b, 0x45, 0x52, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64,
-  0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f,
-  0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20,
+  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x51, 0x53, 0x29, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d,
-  0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x53,
-  0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-  0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52,
-  0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70,
-  0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x72,
-  0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x65, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78,
-  0x5b, 0x73, 0x64, 0x5d, 0x3e, 0x3d, 0x52, 0x41, 0x4e, 0x44, 0x42, 0x52,
-  0x4f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f,
-  0x6d, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69,
-  0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c,
-  0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61,
+  0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x4b, 0x49, 0x43, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x45,
+  0x58, 0x54, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64,
+  0x5d, 0x26, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x45,
+  0x41, 0x52, 0x43, 0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b,
+  0x73, 0x64, 0x5d, 0x26, 0x4c, 0x4d, 0x52, 0x53, 0x45, 0x41, 0x52, 0x43,
+  0x48, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d,
+  0x26, 0x49, 0x49, 0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73,
+  0x64, 0x5d, 0x3e, 0x30, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
+  0x75, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54,
+  0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d,
+  0x3e, 0x3d, 0x52, 0x41, 0x4e, 0x44, 0x42, 0x52, 0x4f, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65,
+  0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x78, 0x36,
-  0x34, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x20, 0x23, 0x23, 0x23, 0x23,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23,
+  0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x70,
+  0x69, 0x63, 0x6b, 0x65, 0x72, 0x20, 0x78, 0x36, 0x34, 0x20, 0x49, 0x54,
+  0x45, 0x52, 0x31, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x65,
-  0x72, 0x2c, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x73, 0x20, 0x78, 0x36, 0x34, 0x20, 0x70, 0x61, 0x72,
-  0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x67, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x66,
-  0x72, 0x6f, 0x6d, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x73,
-  0x74, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d,
-  0x6f, 0x76, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-  0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x31, 0x5b, 0x67, 0x69,
-  0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b,
-  0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c,
-  0x69, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76,
-  0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d,
-  0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67,
-  0x65, 0x74, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x4d, 0x6f, 0x76, 0x65, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x6d,
-  0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x4b, 0x69, 0x6c, 0x6c, 0x65, 0x72,
-  0x73, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59,
-  0x2b, 0x73, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x6f,
-  0x76, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x3d, 0x20, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72,
-  0x73, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2a, 0x36, 0x34, 0x2b,
-  0x28, 0x73, 0x33, 0x32, 0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52,
-  0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2a, 0x36, 0x34, 0x2b,
-  0x28, 0x73, 0x33, 0x32, 0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f,
-  0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73,
-  0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x62,
-  0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20,
-  0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56,
-  0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
-  0x5b, 0x73, 0x64, 0x5d, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62,
-  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e, 0x64,
-  0x65, 0x78, 0x31, 0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31,
-  0x3e, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x54, 0x54,
-  0x31, 0x5b, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x5d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x31,
-  0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x28, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31,
-  0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x5e, 0x28, 0x48,
-  0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e,
-  0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d,
-  0x20, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
-  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d,
-  0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49,
-  0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x20,
-  0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64, 0x29, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x69, 0x63, 0x6b,
-  0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66,
-  0x72, 0x6f, 0x6d, 0x20, 0x62, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x62,
-  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26, 0x26, 0x21, 0x62, 0x72, 0x65,
-  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x26, 0x26, 0x6c, 0x6d, 0x6f, 0x76,
-  0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x66, 0x74,
-  0x33, 0x32, 0x20, 0x50, 0x52, 0x4e, 0x47, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70, 0x72, 0x6e,
-  0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70, 0x72, 0x6e,
-  0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70, 0x72, 0x6e,
-  0x20, 0x3c, 0x3c, 0x20, 0x35, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x70, 0x6f,
-  0x70, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x26, 0x62, 0x62, 0x4d,
-  0x6f, 0x76, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x74,
-  0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x67, 0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x63, 0x61,
-  0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54,
-  0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c,
-  0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
-  0x66, 0x6f, 0x72, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73, 0x73, 0x61,
-  0x6e, 0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54,
-  0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29,
-  0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x73, 0x74, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x69, 0x64,
-  0x2d, 0x73, 0x71, 0x74, 0x6f, 0x21, 0x3d, 0x38, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x6c, 0x69, 0x64, 0x2d, 0x73, 0x71, 0x74, 0x6f, 0x21, 0x3d,
-  0x31, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x70, 0x63, 0x70, 0x74,
-  0x3d, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x28, 0x73, 0x74,
-  0x6d, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x2b, 0x38, 0x3a, 0x73, 0x71, 0x74,
-  0x6f, 0x2d, 0x38, 0x29, 0x3a, 0x73, 0x71, 0x63, 0x70, 0x74, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20,
-  0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
-  0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x73, 0x74, 0x6d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x26, 0x26, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x6c, 0x69, 0x64,
-  0x21, 0x3d, 0x38, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x71, 0x74,
-  0x6f, 0x2d, 0x6c, 0x69, 0x64, 0x21, 0x3d, 0x31, 0x36, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x70, 0x63, 0x70, 0x74, 0x3d, 0x3d, 0x50, 0x4e, 0x4f,
-  0x4e, 0x45, 0x29, 0x3f, 0x28, 0x73, 0x74, 0x6d, 0x3f, 0x73, 0x71, 0x74,
-  0x6f, 0x2b, 0x38, 0x3a, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x38, 0x29, 0x3a,
-  0x73, 0x71, 0x63, 0x70, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54,
-  0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c,
-  0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x70,
-  0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x20,
-  0x70, 0x72, 0x6f, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x71,
-  0x75, 0x65, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70,
-  0x74, 0x6f, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50,
-  0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d,
-  0x3d, 0x50, 0x41, 0x57, 0x4e, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x52,
-  0x41, 0x4e, 0x4b, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x73, 0x74, 0x6d,
-  0x29, 0x3d, 0x3d, 0x52, 0x41, 0x4e, 0x4b, 0x5f, 0x38, 0x29, 0x3f, 0x0a,
+  0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x2c, 0x20, 0x65,
+  0x78, 0x74, 0x72, 0x61, 0x63, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x20, 0x78, 0x36, 0x34, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65,
+  0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73,
+  0x20, 0x3d, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d,
+  0x6f, 0x76, 0x65, 0x73, 0x31, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41,
+  0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36,
+  0x34, 0x2b, 0x28, 0x73, 0x33, 0x32, 0x29, 0x6c, 0x69, 0x64, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6b,
+  0x69, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65,
+  0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x3d, 0x20, 0x4b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x73, 0x5b, 0x67, 0x69,
+  0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2b, 0x73, 0x64, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d,
+  0x20, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x5b, 0x67, 0x69,
+  0x64, 0x2a, 0x36, 0x34, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d,
+  0x6f, 0x76, 0x65, 0x29, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76,
+  0x65, 0x29, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x69,
+  0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x4d, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x74, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e,
+  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
+  0x6b, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73,
+  0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
+  0x3b, 0x20, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e, 0x31,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x6c, 0x6f,
+  0x61, 0x64, 0x28, 0x54, 0x54, 0x31, 0x2c, 0x20, 0x74, 0x74, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x31, 0x2c, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54,
+  0x54, 0x4b, 0x45, 0x59, 0x28, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x2c,
+  0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65,
+  0x2c, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74,
+  0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74,
+  0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x3d,
+  0x20, 0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f,
+  0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45,
+  0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69,
+  0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70,
+  0x69, 0x63, 0x6b, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x62, 0x69, 0x74, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c,
+  0x65, 0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26, 0x26, 0x21,
+  0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x26, 0x26, 0x6c,
+  0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x73, 0x68,
+  0x69, 0x66, 0x74, 0x33, 0x32, 0x20, 0x50, 0x52, 0x4e, 0x47, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20,
+  0x70, 0x72, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20,
+  0x70, 0x72, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20,
+  0x70, 0x72, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x20, 0x3d,
+  0x20, 0x70, 0x6f, 0x70, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x26,
+  0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20,
+  0x73, 0x71, 0x74, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65,
+  0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20,
+  0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x2c, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61,
+  0x73, 0x73, 0x61, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72,
+  0x65, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x28,
+  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72,
+  0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x50, 0x49, 0x45, 0x43,
-  0x45, 0x28, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x2c, 0x47, 0x45, 0x54, 0x43,
-  0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x29,
+  0x20, 0x26, 0x26, 0x73, 0x74, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x6c, 0x69, 0x64, 0x2d, 0x73, 0x71, 0x74, 0x6f, 0x21, 0x3d, 0x38, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x69, 0x64, 0x2d, 0x73, 0x71, 0x74,
+  0x6f, 0x21, 0x3d, 0x31, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x70,
+  0x63, 0x70, 0x74, 0x3d, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f,
+  0x28, 0x73, 0x74, 0x6d, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x2b, 0x38, 0x3a,
+  0x73, 0x71, 0x74, 0x6f, 0x2d, 0x38, 0x29, 0x3a, 0x73, 0x71, 0x63, 0x70,
+  0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63,
+  0x70, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
+  0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50,
+  0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x73, 0x74,
+  0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x71, 0x74, 0x6f, 0x2d,
+  0x6c, 0x69, 0x64, 0x21, 0x3d, 0x38, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x73, 0x71, 0x74, 0x6f, 0x2d, 0x6c, 0x69, 0x64, 0x21, 0x3d, 0x31, 0x36,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3a, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x61, 0x6b,
-  0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x3d, 0x20,
-  0x4d, 0x41, 0x4b, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x28, 0x28, 0x4d, 0x6f,
-  0x76, 0x65, 0x29, 0x6c, 0x69, 0x64, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x73, 0x71, 0x63, 0x70, 0x74, 0x2c, 0x20, 0x28, 0x4d, 0x6f,
-  0x76, 0x65, 0x29, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2c, 0x20, 0x28, 0x4d,
-  0x6f, 0x76, 0x65, 0x29, 0x70, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d, 0x6f,
-  0x76, 0x65, 0x29, 0x70, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x77, 0x6f, 0x6f, 0x64, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x73,
-  0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73,
-  0x2c, 0x20, 0x70, 0x74, 0x6f, 0x2d, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20,
-  0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c,
-  0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b,
-  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x70, 0x63, 0x70, 0x74, 0x3d, 0x3d,
+  0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x28, 0x73, 0x74, 0x6d, 0x3f,
+  0x73, 0x71, 0x74, 0x6f, 0x2b, 0x38, 0x3a, 0x73, 0x71, 0x74, 0x6f, 0x2d,
+  0x38, 0x29, 0x3a, 0x73, 0x71, 0x63, 0x70, 0x74, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20,
+  0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x2c, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x61,
+  0x77, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e,
+  0x2c, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x26, 0x26, 0x47, 0x45,
+  0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x2c,
+  0x73, 0x74, 0x6d, 0x29, 0x3d, 0x3d, 0x52, 0x41, 0x4e, 0x4b, 0x5f, 0x38,
+  0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x50,
+  0x49, 0x45, 0x43, 0x45, 0x28, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x2c, 0x47,
+  0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x6d, 0x61, 0x6b, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x20, 0x3d, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x28,
+  0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x6c, 0x69, 0x64, 0x2c, 0x20, 0x28,
+  0x4d, 0x6f, 0x76, 0x65, 0x29, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x20, 0x28,
+  0x4d, 0x6f, 0x76, 0x65, 0x29, 0x73, 0x71, 0x63, 0x70, 0x74, 0x2c, 0x20,
+  0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2c,
+  0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x74, 0x6f, 0x2c, 0x20,
+  0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x63, 0x70, 0x74, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x76,
+  0x61, 0x6c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x6f, 0x64, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63,
+  0x65, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x74, 0x61, 0x62,
+  0x6c, 0x65, 0x73, 0x2c, 0x20, 0x70, 0x74, 0x6f, 0x2d, 0x70, 0x66, 0x72,
+  0x6f, 0x6d, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45,
+  0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
+  0x70, 0x74, 0x6f, 0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b,
+  0x45, 0x76, 0x61, 0x6c, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x47, 0x45,
+  0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f, 0x29, 0x2a,
+  0x36, 0x34, 0x2b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x73, 0x71,
+  0x74, 0x6f, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x73, 0x71, 0x74, 0x6f,
+  0x29, 0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76,
+  0x61, 0x6c, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5b, 0x28, 0x28,
+  0x73, 0x74, 0x6d, 0x29, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x3a, 0x46, 0x4c,
+  0x4f, 0x50, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x5d, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x2d, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69,
+  0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x47, 0x45,
+  0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d,
   0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61,
   0x6c, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54,
-  0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f, 0x29, 0x2a, 0x36, 0x34, 0x2b,
-  0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x3a,
-  0x46, 0x4c, 0x4f, 0x50, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x5d,
+  0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x2a, 0x36,
+  0x34, 0x2b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x6c, 0x69, 0x64,
+  0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x5d,
   0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x43,
   0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5b, 0x28, 0x28, 0x73, 0x74, 0x6d,
-  0x29, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28,
-  0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2d, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65,
-  0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54,
-  0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x5d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x54, 0x61,
-  0x62, 0x6c, 0x65, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45,
-  0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x2a, 0x36, 0x34, 0x2b, 0x28,
-  0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x6c, 0x69, 0x64, 0x3a, 0x46, 0x4c,
-  0x4f, 0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x5d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x43, 0x6f, 0x6e, 0x74,
-  0x72, 0x6f, 0x6c, 0x5b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x6c,
-  0x69, 0x64, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x6c, 0x69, 0x64, 0x29,
-  0x29, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x4d, 0x56, 0x56, 0x2d, 0x4c, 0x56, 0x41, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
-  0x70, 0x63, 0x70, 0x74, 0x29, 0x21, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45,
-  0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x76, 0x61,
-  0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
-  0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x63,
-  0x70, 0x74, 0x29, 0x5d, 0x2a, 0x31, 0x36, 0x2d, 0x45, 0x76, 0x61, 0x6c,
-  0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b,
-  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f,
-  0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x74, 0x6d, 0x70,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68,
-  0x65, 0x75, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d,
-  0x6f, 0x76, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x73, 0x65, 0x63,
-  0x6f, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20,
-  0x71, 0x75, 0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69,
-  0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x51, 0x55,
-  0x45, 0x45, 0x4e, 0x5d, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65,
-  0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x50, 0x41, 0x57,
-  0x4e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65,
-  0x63, 0x6b, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x68, 0x65, 0x75, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6b,
-  0x69, 0x6c, 0x6c, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74,
+  0x29, 0x3f, 0x6c, 0x69, 0x64, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x6c,
+  0x69, 0x64, 0x29, 0x29, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x4d, 0x56, 0x56, 0x2d, 0x4c, 0x56, 0x41, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
+  0x50, 0x45, 0x28, 0x70, 0x63, 0x70, 0x74, 0x29, 0x21, 0x3d, 0x50, 0x4e,
+  0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c,
+  0x75, 0x65, 0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45,
+  0x28, 0x70, 0x63, 0x70, 0x74, 0x29, 0x5d, 0x2a, 0x31, 0x36, 0x2d, 0x45,
+  0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
+  0x70, 0x74, 0x6f, 0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a,
+  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x68, 0x65, 0x75, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74,
   0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20,
-  0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x71, 0x75, 0x69, 0x65,
-  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x5d,
-  0x2b, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x73, 0x5b, 0x50, 0x41, 0x57, 0x4e, 0x5d, 0x2a, 0x32,
-  0x3b, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x7a, 0x79,
-  0x20, 0x73, 0x6d, 0x70, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d,
-  0x69, 0x7a, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x72, 0x64,
-  0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x72, 0x6e, 0x25, 0x49, 0x4e, 0x46,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x20, 0x69, 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x5d, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x20, 0x61, 0x73, 0x20, 0x32, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x67,
-  0x68, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45,
-  0x53, 0x43, 0x4f, 0x52, 0x45, 0x2d, 0x32, 0x30, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x69,
-  0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x69, 0x74, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b,
-  0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x35, 0x5d, 0x2b, 0x2b, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
-  0x74, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65,
+  0x73, 0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65,
+  0x73, 0x74, 0x20, 0x71, 0x75, 0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d,
+  0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61,
+  0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73,
+  0x5b, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x5d, 0x2b, 0x45, 0x76, 0x61, 0x6c,
+  0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b,
+  0x50, 0x41, 0x57, 0x4e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x65, 0x75, 0x72, 0x69, 0x73,
+  0x74, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65,
   0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x61, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x49,
-  0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x2d,
-  0x31, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x54, 0x54, 0x68, 0x69, 0x74, 0x73, 0x20, 0x63,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b,
-  0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x33, 0x5d, 0x2b, 0x2b, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x69, 0x67, 0x68,
-  0x65, 0x73, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x28,
-  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65,
-  0x3a, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d,
-  0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3a,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x65, 0x78, 0x74,
-  0x65, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
-  0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-  0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65,
-  0x63, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x65,
-  0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6d, 0x61, 0x78, 0x28,
-  0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x20,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-  0x20, 0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63,
-  0x68, 0x67, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x2c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x29, 0x3d, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x26, 0x26, 0x21,
-  0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x26, 0x26, 0x6d,
-  0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e,
-  0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f,
-  0x76, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x23,
-  0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69, 0x6e, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b,
-  0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36,
-  0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36,
-  0x34, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x73,
-  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65,
-  0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6c, 0x6d, 0x6f, 0x76,
-  0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
-  0x20, 0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f,
-  0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f,
-  0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69,
-  0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20,
-  0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73, 0x63, 0x72, 0x54, 0x6d,
-  0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20,
-  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x62, 0x62,
-  0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x23, 0x65,
-  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46,
-  0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20,
+  0x61, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x71,
+  0x75, 0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65,
+  0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x51, 0x55, 0x45,
+  0x45, 0x4e, 0x5d, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63,
+  0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x50, 0x41, 0x57, 0x4e,
+  0x5d, 0x2a, 0x32, 0x3b, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c,
+  0x61, 0x7a, 0x79, 0x20, 0x73, 0x6d, 0x70, 0x2c, 0x20, 0x72, 0x61, 0x6e,
+  0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x6f, 0x72, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69,
+  0x7a, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x72, 0x6e, 0x25,
+  0x49, 0x4e, 0x46, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x20, 0x69, 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x32, 0x6e, 0x64, 0x20,
+  0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x4d,
+  0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x2d, 0x32, 0x30, 0x30,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x69, 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x69,
+  0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45,
+  0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x35, 0x5d,
+  0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65,
+  0x63, 0x6b, 0x20, 0x74, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x6d,
+  0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73,
+  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x3d, 0x20, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f,
+  0x52, 0x45, 0x2d, 0x31, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x54, 0x54, 0x68, 0x69, 0x74,
+  0x73, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45,
+  0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x33, 0x5d,
+  0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68,
+  0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e,
+  0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x6d,
+  0x6f, 0x76, 0x65, 0x3a, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20,
+  0x28, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f,
+  0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f,
+  0x6d, 0x69, 0x63, 0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66,
+  0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f,
+  0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
+  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64,
+  0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x78, 0x36,
+  0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6d,
+  0x61, 0x78, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
   0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
-  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x41, 0x42, 0x44,
-  0x41, 0x44, 0x41, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x64,
-  0x65, 0x20, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6c, 0x6d, 0x6f, 0x76,
-  0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x26,
-  0x26, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x54,
-  0x45, 0x52, 0x31, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e,
-  0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64,
-  0x5d, 0x5e, 0x3d, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
-  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x7c,
-  0x3d, 0x49, 0x54, 0x45, 0x52, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x20,
-  0x78, 0x36, 0x34, 0x20, 0x49, 0x54, 0x45, 0x52, 0x32, 0x20, 0x23, 0x23,
-  0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d,
+  0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x29, 0x3d, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x26, 0x26, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x26, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45,
+  0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x6d,
+  0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70,
+  0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20,
+  0x28, 0x75, 0x36, 0x34, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20,
+  0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6c,
+  0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45,
+  0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d,
+  0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73, 0x63,
+  0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74,
+  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6d, 0x6f, 0x76, 0x65,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65,
+  0x29, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b,
+  0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46,
+  0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d,
+  0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65,
+  0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f,
+  0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x41, 0x42, 0x44, 0x41, 0x44, 0x41, 0x20, 0x69, 0x74, 0x65, 0x72, 0x20,
+  0x6d, 0x6f, 0x64, 0x65, 0x20, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6c,
+  0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x26, 0x26, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f,
+  0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d,
+  0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x5d, 0x5e, 0x3d, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
+  0x64, 0x5d, 0x7c, 0x3d, 0x49, 0x54, 0x45, 0x52, 0x32, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x70, 0x69, 0x63, 0x6b,
+  0x65, 0x72, 0x20, 0x78, 0x36, 0x34, 0x20, 0x49, 0x54, 0x45, 0x52, 0x32,
+  0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x70, 0x69, 0x63,
-  0x6b, 0x65, 0x72, 0x2c, 0x20, 0x65, 0x78, 0x74, 0x72, 0x61, 0x63, 0x74,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x78, 0x36, 0x34, 0x20, 0x70,
-  0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
-  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c,
-  0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x5b,
-  0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36,
-  0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32,
-  0x29, 0x6c, 0x69, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56,
-  0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e,
-  0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x20,
-  0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66, 0x72,
-  0x6f, 0x6d, 0x20, 0x62, 0x69, 0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x62, 0x62,
-  0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26, 0x26, 0x21, 0x62, 0x72, 0x65, 0x73,
-  0x65, 0x61, 0x72, 0x63, 0x68, 0x26, 0x26, 0x6c, 0x6d, 0x6f, 0x76, 0x65,
-  0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x73, 0x68, 0x69, 0x66, 0x74, 0x33,
-  0x32, 0x20, 0x50, 0x52, 0x4e, 0x47, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70, 0x72, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x31, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70, 0x72, 0x6e, 0x20,
-  0x3e, 0x3e, 0x20, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70, 0x72, 0x6e, 0x20,
-  0x3c, 0x3c, 0x20, 0x35, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x20, 0x3d, 0x20, 0x70, 0x6f, 0x70,
-  0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x26, 0x62, 0x62, 0x4d, 0x6f,
-  0x76, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x73, 0x71, 0x74, 0x6f,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67,
-  0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x63, 0x61, 0x70,
-  0x74, 0x75, 0x72, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50,
-  0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20,
-  0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73, 0x73, 0x61, 0x6e,
-  0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x20, 0x73, 0x71,
-  0x75, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50,
-  0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d,
-  0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73,
-  0x74, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x69, 0x64, 0x2d,
-  0x73, 0x71, 0x74, 0x6f, 0x21, 0x3d, 0x38, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x6c, 0x69, 0x64, 0x2d, 0x73, 0x71, 0x74, 0x6f, 0x21, 0x3d, 0x31,
-  0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x70, 0x63, 0x70, 0x74, 0x3d,
-  0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x28, 0x73, 0x74, 0x6d,
-  0x3f, 0x73, 0x71, 0x74, 0x6f, 0x2b, 0x38, 0x3a, 0x73, 0x71, 0x74, 0x6f,
-  0x2d, 0x38, 0x29, 0x3a, 0x73, 0x71, 0x63, 0x70, 0x74, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d,
-  0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70,
-  0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x73, 0x74, 0x6d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x6c, 0x69, 0x64, 0x21,
-  0x3d, 0x38, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x71, 0x74, 0x6f,
-  0x2d, 0x6c, 0x69, 0x64, 0x21, 0x3d, 0x31, 0x36, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x70, 0x63, 0x70, 0x74, 0x3d, 0x3d, 0x50, 0x4e, 0x4f, 0x4e,
-  0x45, 0x29, 0x3f, 0x28, 0x73, 0x74, 0x6d, 0x3f, 0x73, 0x71, 0x74, 0x6f,
-  0x2b, 0x38, 0x3a, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x38, 0x29, 0x3a, 0x73,
-  0x71, 0x63, 0x70, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50,
-  0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20,
-  0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x70, 0x66,
-  0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x61, 0x77, 0x6e, 0x20, 0x70,
-  0x72, 0x6f, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x71, 0x75,
-  0x65, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74,
-  0x6f, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54,
-  0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d,
-  0x50, 0x41, 0x57, 0x4e, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41,
-  0x4e, 0x4b, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x73, 0x74, 0x6d, 0x29,
-  0x3d, 0x3d, 0x52, 0x41, 0x4e, 0x4b, 0x5f, 0x38, 0x29, 0x3f, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x50, 0x49, 0x45, 0x43, 0x45,
-  0x28, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f,
-  0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x29, 0x0a,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x70, 0x69, 0x63, 0x6b, 0x65, 0x72, 0x2c, 0x20, 0x65, 0x78, 0x74, 0x72,
+  0x61, 0x63, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x78, 0x36,
+  0x34, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x73, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x20, 0x3d, 0x20,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65,
+  0x73, 0x32, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28,
+  0x73, 0x33, 0x32, 0x29, 0x6c, 0x69, 0x64, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52,
+  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43,
+  0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6c, 0x69, 0x64,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70, 0x69,
+  0x63, 0x6b, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x62, 0x69, 0x74, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65,
+  0x28, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x26, 0x26, 0x21, 0x62,
+  0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x26, 0x26, 0x6c, 0x6d,
+  0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e,
+  0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x78, 0x6f, 0x72, 0x73, 0x68, 0x69,
+  0x66, 0x74, 0x33, 0x32, 0x20, 0x50, 0x52, 0x4e, 0x47, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70,
+  0x72, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70,
+  0x72, 0x6e, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6e, 0x20, 0x5e, 0x3d, 0x20, 0x70,
+  0x72, 0x6e, 0x20, 0x3c, 0x3c, 0x20, 0x35, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x20, 0x3d, 0x20,
+  0x70, 0x6f, 0x70, 0x66, 0x69, 0x72, 0x73, 0x74, 0x31, 0x28, 0x26, 0x62,
+  0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x73,
+  0x71, 0x74, 0x6f, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20,
+  0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x47,
+  0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x2c, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73,
+  0x73, 0x61, 0x6e, 0x74, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72, 0x65,
+  0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x3a, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x61, 0x6b, 0x65,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x4d,
-  0x41, 0x4b, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x28, 0x28, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x6c, 0x69, 0x64, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65,
-  0x29, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65,
-  0x29, 0x73, 0x71, 0x63, 0x70, 0x74, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2c, 0x20, 0x28, 0x4d, 0x6f,
-  0x76, 0x65, 0x29, 0x70, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x70, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x76, 0x61, 0x6c, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x77, 0x6f, 0x6f, 0x64, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20,
-  0x61, 0x6e, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x73, 0x71,
-  0x75, 0x61, 0x72, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x2c,
-  0x20, 0x70, 0x74, 0x6f, 0x2d, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x20,
-  0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50,
-  0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x47,
-  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f, 0x29,
+  0x26, 0x26, 0x73, 0x74, 0x6d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c,
+  0x69, 0x64, 0x2d, 0x73, 0x71, 0x74, 0x6f, 0x21, 0x3d, 0x38, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x6c, 0x69, 0x64, 0x2d, 0x73, 0x71, 0x74, 0x6f,
+  0x21, 0x3d, 0x31, 0x36, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x70, 0x63,
+  0x70, 0x74, 0x3d, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x28,
+  0x73, 0x74, 0x6d, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x2b, 0x38, 0x3a, 0x73,
+  0x71, 0x74, 0x6f, 0x2d, 0x38, 0x29, 0x3a, 0x73, 0x71, 0x63, 0x70, 0x74,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x63, 0x70,
+  0x74, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50,
+  0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x3d, 0x3d, 0x50, 0x41,
+  0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x73, 0x74, 0x6d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x6c,
+  0x69, 0x64, 0x21, 0x3d, 0x38, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73,
+  0x71, 0x74, 0x6f, 0x2d, 0x6c, 0x69, 0x64, 0x21, 0x3d, 0x31, 0x36, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x26, 0x26, 0x70, 0x63, 0x70, 0x74, 0x3d, 0x3d, 0x50,
+  0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x3f, 0x28, 0x73, 0x74, 0x6d, 0x3f, 0x73,
+  0x71, 0x74, 0x6f, 0x2b, 0x38, 0x3a, 0x73, 0x71, 0x74, 0x6f, 0x2d, 0x38,
+  0x29, 0x3a, 0x73, 0x71, 0x63, 0x70, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x70, 0x63, 0x70, 0x74, 0x20, 0x20, 0x3d, 0x20, 0x47,
+  0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72,
+  0x64, 0x2c, 0x20, 0x73, 0x71, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x3d,
+  0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x61, 0x77,
+  0x6e, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x6f, 0x74, 0x69, 0x6f, 0x6e, 0x2c,
+  0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x70, 0x74, 0x6f, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45,
+  0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d,
+  0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x26, 0x26, 0x47, 0x45, 0x54,
+  0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x73,
+  0x74, 0x6d, 0x29, 0x3d, 0x3d, 0x52, 0x41, 0x4e, 0x4b, 0x5f, 0x38, 0x29,
+  0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x50, 0x49,
+  0x45, 0x43, 0x45, 0x28, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x2c, 0x47, 0x45,
+  0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d,
+  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x70, 0x66, 0x72, 0x6f, 0x6d,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d,
+  0x61, 0x6b, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20,
+  0x3d, 0x20, 0x4d, 0x41, 0x4b, 0x45, 0x4d, 0x4f, 0x56, 0x45, 0x28, 0x28,
+  0x4d, 0x6f, 0x76, 0x65, 0x29, 0x6c, 0x69, 0x64, 0x2c, 0x20, 0x28, 0x4d,
+  0x6f, 0x76, 0x65, 0x29, 0x73, 0x71, 0x74, 0x6f, 0x2c, 0x20, 0x28, 0x4d,
+  0x6f, 0x76, 0x65, 0x29, 0x73, 0x71, 0x63, 0x70, 0x74, 0x2c, 0x20, 0x28,
+  0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x2c, 0x20,
+  0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x74, 0x6f, 0x2c, 0x20, 0x28,
+  0x4d, 0x6f, 0x76, 0x65, 0x29, 0x70, 0x63, 0x70, 0x74, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x76, 0x61,
+  0x6c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x77, 0x6f, 0x6f, 0x64, 0x20, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65,
+  0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c,
+  0x65, 0x73, 0x2c, 0x20, 0x70, 0x74, 0x6f, 0x2d, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x20, 0x20, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
+  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76,
+  0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65,
+  0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70,
+  0x74, 0x6f, 0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45,
+  0x76, 0x61, 0x6c, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x47, 0x45, 0x54,
+  0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f, 0x29, 0x2a, 0x36,
+  0x34, 0x2b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x73, 0x71, 0x74,
+  0x6f, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29,
+  0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61,
+  0x6c, 0x43, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5b, 0x28, 0x28, 0x73,
+  0x74, 0x6d, 0x29, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x3a, 0x46, 0x4c, 0x4f,
+  0x50, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x5d, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x2d, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65,
+  0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x47, 0x45, 0x54,
+  0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29,
   0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c,
   0x54, 0x61, 0x62, 0x6c, 0x65, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
-  0x50, 0x45, 0x28, 0x70, 0x74, 0x6f, 0x29, 0x2a, 0x36, 0x34, 0x2b, 0x28,
-  0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x73, 0x71, 0x74, 0x6f, 0x3a, 0x46,
-  0x4c, 0x4f, 0x50, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x5d, 0x0a,
+  0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x2a, 0x36, 0x34,
+  0x2b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x6c, 0x69, 0x64, 0x3a,
+  0x46, 0x4c, 0x4f, 0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x5d, 0x0a,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x43, 0x6f,
   0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29,
-  0x3f, 0x73, 0x71, 0x74, 0x6f, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x73,
-  0x71, 0x74, 0x6f, 0x29, 0x29, 0x5d, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2d,
-  0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56,
-  0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
-  0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x5d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x54, 0x61, 0x62,
-  0x6c, 0x65, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
-  0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x28,
-  0x73, 0x74, 0x6d, 0x29, 0x3f, 0x6c, 0x69, 0x64, 0x3a, 0x46, 0x4c, 0x4f,
-  0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x43, 0x6f, 0x6e, 0x74, 0x72,
-  0x6f, 0x6c, 0x5b, 0x28, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x3f, 0x6c, 0x69,
-  0x64, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x6c, 0x69, 0x64, 0x29, 0x29,
-  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x4d, 0x56, 0x56, 0x2d, 0x4c, 0x56, 0x41, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
-  0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70,
-  0x63, 0x70, 0x74, 0x29, 0x21, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x29,
-  0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45, 0x76, 0x61, 0x6c,
-  0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b,
-  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x63, 0x70,
-  0x74, 0x29, 0x5d, 0x2a, 0x31, 0x36, 0x2d, 0x45, 0x76, 0x61, 0x6c, 0x50,
-  0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x47,
-  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x74, 0x6f, 0x29,
-  0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x74, 0x6d, 0x70, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x63, 0x6f, 0x75,
-  0x6e, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x65,
-  0x75, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
-  0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f,
-  0x76, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x73, 0x65, 0x63, 0x6f,
-  0x6e, 0x64, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x71,
-  0x75, 0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65,
-  0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x51, 0x55, 0x45,
-  0x45, 0x4e, 0x5d, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63,
-  0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x50, 0x41, 0x57, 0x4e,
-  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63,
-  0x6b, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x68, 0x65, 0x75, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6b, 0x69,
-  0x6c, 0x6c, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74, 0x6d,
+  0x3f, 0x6c, 0x69, 0x64, 0x3a, 0x46, 0x4c, 0x4f, 0x50, 0x28, 0x6c, 0x69,
+  0x64, 0x29, 0x29, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x4d, 0x56, 0x56, 0x2d, 0x4c, 0x56, 0x41, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50,
+  0x45, 0x28, 0x70, 0x63, 0x70, 0x74, 0x29, 0x21, 0x3d, 0x50, 0x4e, 0x4f,
+  0x4e, 0x45, 0x29, 0x3f, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x45,
+  0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75,
+  0x65, 0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
+  0x70, 0x63, 0x70, 0x74, 0x29, 0x5d, 0x2a, 0x31, 0x36, 0x2d, 0x45, 0x76,
+  0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65,
+  0x73, 0x5b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70,
+  0x74, 0x6f, 0x29, 0x5d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3a, 0x74,
+  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x68, 0x65, 0x75, 0x72, 0x69, 0x73, 0x74, 0x69, 0x63, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x63, 0x6f, 0x75,
+  0x6e, 0x74, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x74, 0x6d,
   0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x68,
-  0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x71, 0x75, 0x69, 0x65, 0x74,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
-  0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61,
-  0x6c, 0x75, 0x65, 0x73, 0x5b, 0x51, 0x55, 0x45, 0x45, 0x4e, 0x5d, 0x2b,
-  0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c,
-  0x75, 0x65, 0x73, 0x5b, 0x50, 0x41, 0x57, 0x4e, 0x5d, 0x2a, 0x32, 0x3b,
-  0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x7a, 0x79, 0x20,
-  0x73, 0x6d, 0x70, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69,
-  0x7a, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f, 0x72, 0x64, 0x65,
-  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2b, 0x3d, 0x20, 0x28, 0x70, 0x72, 0x6e, 0x25, 0x49, 0x4e, 0x46, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b,
-  0x20, 0x69, 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b, 0x73, 0x64,
-  0x5d, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x20, 0x61, 0x73, 0x20, 0x32, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x67, 0x68,
-  0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53,
-  0x43, 0x4f, 0x52, 0x45, 0x2d, 0x32, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x69, 0x64,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x69, 0x74, 0x20, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b, 0x67,
-  0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x35, 0x5d, 0x2b, 0x2b, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x20, 0x74,
-  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3d,
+  0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x73,
+  0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73,
+  0x74, 0x20, 0x71, 0x75, 0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c,
+  0x50, 0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b,
+  0x51, 0x55, 0x45, 0x45, 0x4e, 0x5d, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x50,
+  0x69, 0x65, 0x63, 0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x50,
+  0x41, 0x57, 0x4e, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63,
+  0x68, 0x65, 0x63, 0x6b, 0x20, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x65, 0x75, 0x72, 0x69, 0x73, 0x74,
+  0x69, 0x63, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x6b, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x6d, 0x6f, 0x76, 0x65, 0x3d,
   0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61,
-  0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74,
-  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x49, 0x4e,
-  0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x2d, 0x31,
-  0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x54, 0x54, 0x68, 0x69, 0x74, 0x73, 0x20, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b, 0x67,
-  0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x33, 0x5d, 0x2b, 0x2b, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65,
-  0x73, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x74,
-  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x3a,
-  0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x6d, 0x70,
-  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x29, 0x3f, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3a, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
-  0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x65, 0x78, 0x74, 0x65,
+  0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x71, 0x75,
+  0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x3d, 0x20, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63,
+  0x65, 0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x51, 0x55, 0x45, 0x45,
+  0x4e, 0x5d, 0x2b, 0x45, 0x76, 0x61, 0x6c, 0x50, 0x69, 0x65, 0x63, 0x65,
+  0x56, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x5b, 0x50, 0x41, 0x57, 0x4e, 0x5d,
+  0x2a, 0x32, 0x3b, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x61,
+  0x7a, 0x79, 0x20, 0x73, 0x6d, 0x70, 0x2c, 0x20, 0x72, 0x61, 0x6e, 0x64,
+  0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x6f,
+  0x72, 0x64, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a,
+  0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x2b, 0x3d, 0x20, 0x28, 0x70, 0x72, 0x6e, 0x25, 0x49,
+  0x4e, 0x46, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68,
+  0x65, 0x63, 0x6b, 0x20, 0x69, 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76,
+  0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x20, 0x61, 0x73, 0x20, 0x32, 0x6e, 0x64, 0x20, 0x68,
+  0x69, 0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x49, 0x4e, 0x46, 0x4d, 0x4f,
+  0x56, 0x45, 0x53, 0x43, 0x4f, 0x52, 0x45, 0x2d, 0x32, 0x30, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x69, 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x68, 0x69, 0x74,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52,
+  0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x35, 0x5d, 0x2b,
+  0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x68, 0x65, 0x63,
+  0x6b, 0x20, 0x74, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x6d, 0x6f,
+  0x76, 0x65, 0x3d, 0x3d, 0x74, 0x6d, 0x70, 0x6d, 0x6f, 0x76, 0x65, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x61, 0x73, 0x20, 0x68, 0x69, 0x67, 0x68, 0x65, 0x73, 0x74,
+  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
+  0x20, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52,
+  0x45, 0x2d, 0x31, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x54, 0x54, 0x68, 0x69, 0x74, 0x73,
+  0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52,
+  0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x33, 0x5d, 0x2b,
+  0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x68, 0x69,
+  0x67, 0x68, 0x65, 0x73, 0x74, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d,
+  0x20, 0x28, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x6d, 0x6f,
+  0x76, 0x65, 0x3a, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28,
+  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x3d, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x29, 0x3f, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x3a, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x69, 0x6e, 0x74, 0x33, 0x32, 0x5f, 0x65,
+  0x78, 0x74, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d,
+  0x69, 0x63, 0x73, 0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69,
+  0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f,
+  0x4c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c,
+  0x6c, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x78, 0x36, 0x34,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6d, 0x61,
+  0x78, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x2c, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x66, 0x20, 0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70,
+  0x78, 0x63, 0x68, 0x67, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x2c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x73, 0x63,
+  0x6f, 0x72, 0x65, 0x29, 0x3d, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x26,
+  0x26, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x26,
+  0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e,
+  0x4f, 0x4e, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b,
+  0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69,
+  0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x6d, 0x70,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70, 0x36,
+  0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d,
+  0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28,
+  0x75, 0x36, 0x34, 0x29, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x62,
+  0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72,
+  0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
+  0x76, 0x65, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6c, 0x6d,
+  0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e,
+  0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53,
+  0x43, 0x4f, 0x52, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30,
+  0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73, 0x63, 0x72,
+  0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6d,
+  0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3e, 0x6d, 0x6f, 0x76, 0x65, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
+  0x3d, 0x20, 0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29,
+  0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
+  0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x3d, 0x20,
+  0x48, 0x41, 0x53, 0x48, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
+  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
+  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x75, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x75, 0x70, 0x20,
+  0x69, 0x6e, 0x20, 0x74, 0x72, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69,
+  0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6c, 0x65,
+  0x61, 0x72, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+  0x20, 0x62, 0x62, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65,
+  0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x26, 0x26,
+  0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61,
+  0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x54, 0x45, 0x52,
+  0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76,
+  0x65, 0x73, 0x31, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50,
+  0x4c, 0x59, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b,
+  0x28, 0x73, 0x33, 0x32, 0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52,
+  0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x5d, 0x26, 0x3d, 0x43,
+  0x4c, 0x52, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54,
+  0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65,
+  0x73, 0x32, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c,
+  0x59, 0x2a, 0x36, 0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28,
+  0x73, 0x33, 0x32, 0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f,
+  0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x5d, 0x26, 0x3d, 0x43, 0x4c,
+  0x52, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53,
+  0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e,
+  0x6f, 0x64, 0x65, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54,
+  0x45, 0x52, 0x53, 0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x31,
+  0x5d, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65,
+  0x74, 0x20, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64,
+  0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x2b, 0x2b,
+  0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x63, 0x20, 0x61, 0x6e, 0x79,
+  0x77, 0x61, 0x79, 0x2c, 0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x20,
+  0x66, 0x69, 0x72, 0x73, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73,
+  0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x6d, 0x6f, 0x76,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6d, 0x6f,
+  0x76, 0x65, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d,
+  0x20, 0x3d, 0x20, 0x21, 0x73, 0x74, 0x6d, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
+  0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x20, 0x73, 0x69, 0x74, 0x65, 0x20,
+  0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x64, 0x2b, 0x2b, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65,
+  0x72, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6c, 0x79, 0x2b, 0x2b, 0x3b,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x63,
+  0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x70, 0x6c, 0x79, 0x20, 0x63, 0x6f,
+  0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x68, 0x61,
+  0x73, 0x68, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x48, 0x41, 0x53, 0x48,
+  0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74,
+  0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x20, 0x68, 0x61, 0x73, 0x68, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x3d, 0x20,
+  0x47, 0x45, 0x54, 0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61,
+  0x72, 0x64, 0x2c, 0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f,
+  0x6d, 0x29, 0x29, 0x3f, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b,
+  0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72,
+  0x6f, 0x6d, 0x29, 0x2a, 0x36, 0x2b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
+  0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x2d, 0x31, 0x5d,
+  0x3a, 0x48, 0x41, 0x53, 0x48, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20,
+  0x28, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x6c, 0x69,
+  0x64, 0x29, 0x7c, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e,
+  0x28, 0x36, 0x34, 0x2d, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x29, 0x3b, 0x20,
+  0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6c, 0x65,
+  0x66, 0x74, 0x20, 0x36, 0x34, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68,
+  0x72, 0x5f, 0x69, 0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65,
   0x6e, 0x64, 0x65, 0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73,
   0x20, 0x26, 0x26, 0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64,
   0x20, 0x4f, 0x4c, 0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20,
   0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
-  0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x62, 0x65, 0x73,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x6d, 0x61, 0x78, 0x28, 0x26,
-  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x20, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
-  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
-  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
-  0x28, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68,
-  0x67, 0x28, 0x26, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x2c, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x2c, 0x73, 0x63, 0x6f, 0x72, 0x65,
-  0x29, 0x3d, 0x3d, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x26, 0x26, 0x21, 0x62,
-  0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x26, 0x26, 0x6d, 0x6f,
-  0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x23, 0x65,
-  0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x74, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c,
-  0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34,
-  0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34,
-  0x29, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
-  0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
-  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x61,
-  0x6e, 0x64, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20,
-  0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
-  0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x6c, 0x6d, 0x6f, 0x76, 0x65,
-  0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20,
-  0x2d, 0x49, 0x4e, 0x46, 0x4d, 0x4f, 0x56, 0x45, 0x53, 0x43, 0x4f, 0x52,
-  0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c,
-  0x36, 0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x28,
-  0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x73, 0x63, 0x72, 0x54, 0x6d, 0x70,
-  0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x73, 0x63,
-  0x6f, 0x72, 0x65, 0x3e, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72,
-  0x65, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d,
-  0x6f, 0x76, 0x65, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x74,
-  0x6d, 0x70, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65,
-  0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x62, 0x62, 0x54,
-  0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x23, 0x65, 0x6e,
-  0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x41,
-  0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x20, 0x3d, 0x20, 0x48, 0x41, 0x53,
-  0x48, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x65, 0x73, 0x20, 0x78, 0x36, 0x34,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78, 0x6f,
+  0x72, 0x28, 0x26, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73,
+  0x2c, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61,
+  0x63, 0x6b, 0x73, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20,
+  0x68, 0x61, 0x73, 0x68, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x20, 0x74, 0x65, 0x6d, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20,
+  0x3d, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20,
+  0x68, 0x61, 0x73, 0x68, 0x65, 0x73, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36,
+  0x34, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x5e, 0x3d,
+  0x20, 0x62, 0x62, 0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b,
+  0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x75, 0x70, 0x20, 0x78,
+  0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69,
+  0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x20,
+  0x70, 0x61, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20,
+  0x3d, 0x20, 0x28, 0x20, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45,
+  0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28,
+  0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65,
+  0x29, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47,
+  0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65,
+  0x29, 0x29, 0x29, 0x2d, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b,
+  0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d,
+  0x6f, 0x76, 0x65, 0x29, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f,
+  0x52, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d,
+  0x6f, 0x76, 0x65, 0x29, 0x29, 0x29, 0x3d, 0x3d, 0x32, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x29, 0x3f, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x3a, 0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29,
+  0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x28, 0x28, 0x5a, 0x6f,
+  0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x36, 0x5d, 0x3c, 0x3c, 0x47,
+  0x45, 0x54, 0x46, 0x49, 0x4c, 0x45, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29,
+  0x29, 0x7c, 0x28, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31,
+  0x36, 0x5d, 0x3e, 0x3e, 0x28, 0x36, 0x34, 0x2d, 0x47, 0x45, 0x54, 0x46,
+  0x49, 0x4c, 0x45, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x29, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
+  0x69, 0x74, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74,
+  0x6d, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x30, 0x78, 0x31,
+  0x55, 0x4c, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72,
+  0x69, 0x67, 0x68, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x43, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x7c, 0x3d,
+  0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47,
+  0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76,
+  0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53,
+  0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
+  0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x43, 0x50, 0x54, 0x28,
+  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x20,
+  0x70, 0x61, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x72, 0x67,
+  0x65, 0x74, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x20, 0x69, 0x6e,
+  0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64,
+  0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x73, 0x71, 0x65, 0x70, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x20,
+  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54,
+  0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29,
+  0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x47,
+  0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
+  0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47, 0x45,
+  0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
+  0x29, 0x29, 0x2d, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28,
+  0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52,
+  0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x29, 0x29, 0x3d, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x29, 0x3f, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x3a, 0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d,
+  0x20, 0x30, 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x46,
+  0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x71, 0x65, 0x70, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x26, 0x3d, 0x20, 0x43, 0x4c, 0x52, 0x4d, 0x41,
+  0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x65, 0x70, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f,
+  0x72, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43,
+  0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
+  0x20, 0x3d, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x75, 0x74, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x63, 0x61, 0x73,
+  0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x7e, 0x62,
+  0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x57,
+  0x48, 0x49, 0x54, 0x45, 0x51, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e, 0x3d, 0x20,
+  0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x32, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+  0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43,
+  0x52, 0x57, 0x48, 0x49, 0x54, 0x45, 0x4b, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e,
+  0x3d, 0x20, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x33,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53,
+  0x4d, 0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x51, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
+  0x6b, 0x5e, 0x3d, 0x20, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b,
+  0x31, 0x34, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29,
+  0x26, 0x53, 0x4d, 0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x4b, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
+  0x6f, 0x72, 0x6b, 0x5e, 0x3d, 0x20, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73,
+  0x74, 0x5b, 0x31, 0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20,
+  0x68, 0x61, 0x73, 0x68, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f,
+  0x56, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x30, 0x78,
+  0x31, 0x55, 0x4c, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x7a, 0x6f,
+  0x62, 0x72, 0x69, 0x73, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x20,
+  0x69, 0x6e, 0x2d, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x68, 0x69,
+  0x73, 0x74, 0x6f, 0x72, 0x79, 0x20, 0x73, 0x74, 0x61, 0x79, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x6d, 0x65, 0x6d,
+  0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f,
+  0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x62, 0x62, 0x57, 0x6f, 0x72,
+  0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x68, 0x61, 0x6c, 0x66, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6c, 0x6f,
+  0x63, 0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+  0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d,
+  0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d,
+  0x31, 0x5d, 0x2b, 0x31, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x63,
+  0x72, 0x65, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x68, 0x6d, 0x63,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
+  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54,
+  0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29,
+  0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x29, 0x29, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x70, 0x61, 0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73,
+  0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54,
+  0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x43, 0x50, 0x54, 0x28,
+  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x21, 0x3d, 0x50, 0x4e, 0x4f, 0x4e,
+  0x45, 0x29, 0x29, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75,
+  0x72, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f,
+  0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x61, 0x73,
+  0x74, 0x6c, 0x65, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x73, 0x69, 0x64,
+  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
+  0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45,
+  0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
+  0x29, 0x3d, 0x3d, 0x4b, 0x49, 0x4e, 0x47, 0x29, 0x26, 0x26, 0x28, 0x47,
+  0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76,
+  0x65, 0x29, 0x2d, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d,
+  0x6f, 0x76, 0x65, 0x29, 0x3d, 0x3d, 0x32, 0x29, 0x29, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48,
+  0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64,
+  0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x6b,
+  0x69, 0x6e, 0x67, 0x73, 0x69, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54,
+  0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d,
+  0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3d, 0x3d, 0x4b, 0x49, 0x4e,
+  0x47, 0x29, 0x26, 0x26, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f,
+  0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2d, 0x47, 0x45, 0x54, 0x53, 0x51,
+  0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3d, 0x3d,
+  0x32, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74,
+  0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
+  0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6f,
+  0x72, 0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b,
+  0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e,
+  0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73,
+  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d,
+  0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65,
+  0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64,
+  0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
+  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41,
+  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61,
+  0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31,
+  0x29, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b,
+  0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68,
+  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68,
+  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d, 0x31, 0x3b, 0x20, 0x2f, 0x2f,
+  0x20, 0x64, 0x65, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64,
+  0x65, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64,
+  0x65, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45,
+  0x20, 0x7c, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20,
+  0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61,
+  0x6c, 0x70, 0x68, 0x61, 0x20, 0x62, 0x65, 0x74, 0x61, 0x20, 0x77, 0x69,
+  0x6e, 0x64, 0x6f, 0x77, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x49, 0x49, 0x44,
+  0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x32, 0x20, 0x2f, 0x2f, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21,
+  0x62, 0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f,
+  0x76, 0x65, 0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
+  0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x26, 0x26, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f,
+  0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54,
+  0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d,
+  0x31, 0x5d, 0x3d, 0x3d, 0x31, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x69, 0x64,
+  0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x66, 0x69, 0x72,
+  0x73, 0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x4d, 0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b,
+  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e,
+  0x35, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
+  0x26, 0x49, 0x49, 0x44, 0x29, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x44, 0x4f, 0x4e,
+  0x45, 0x29, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f,
+  0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d,
+  0x31, 0x5d, 0x26, 0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20,
+  0x49, 0x49, 0x44, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x28, 0x73,
+  0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
+  0x5d, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32,
+  0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2b,
+  0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42,
+  0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f,
+  0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54,
+  0x41, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2b,
+  0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x49, 0x44,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64,
+  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x49, 0x49,
+  0x44, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65,
+  0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63,
+  0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x2d, 0x31,
+  0x5d, 0x2f, 0x35, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x65, 0x77, 0x20,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x62, 0x65, 0x74,
+  0x61, 0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4e, 0x55, 0x4c,
+  0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65,
+  0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d, 0x2d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73,
+  0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x4d,
+  0x4f, 0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
+  0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x2d, 0x3d, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x52,
+  0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x72,
+  0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
+  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41,
+  0x5d, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
+  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
+  0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b,
+  0x42, 0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68,
+  0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
+  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
+  0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x42, 0x45,
+  0x54, 0x41, 0x5d, 0x2b, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x32, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x6e, 0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d,
+  0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56,
+  0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e,
+  0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
+  0x47, 0x45, 0x54, 0x50, 0x43, 0x50, 0x54, 0x28, 0x6d, 0x6f, 0x76, 0x65,
+  0x29, 0x29, 0x3d, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x71, 0x75, 0x69, 0x65, 0x74, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c,
+  0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74,
+  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x49, 0x44,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65,
+  0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
+  0x26, 0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e,
+  0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64,
+  0x2d, 0x31, 0x5d, 0x26, 0x4b, 0x49, 0x43, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
+  0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x45, 0x58, 0x54, 0x29,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
+  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64,
+  0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x32, 0x20, 0x2f,
+  0x2f, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x6d,
+  0x6f, 0x76, 0x65, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65,
+  0x64, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
+  0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b,
+  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x63, 0x6f, 0x75, 0x6e,
+  0x74, 0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42,
+  0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x29, 0x3e, 0x3d, 0x32, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x63,
+  0x6f, 0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x5e, 0x28,
+  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d,
+  0x7c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32,
+  0x5d, 0x7c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50,
+  0x33, 0x5d, 0x29, 0x29, 0x3e, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x3d, 0x20, 0x4c,
+  0x4d, 0x52, 0x52, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
+  0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b,
+  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x4c, 0x4d, 0x52,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
+  0x63, 0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64,
+  0x65, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x4c,
+  0x4d, 0x52, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x62, 0x65, 0x73,
+  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x77, 0x61, 0x79,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73,
+  0x64, 0x3d, 0x3d, 0x32, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54,
+  0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d,
+  0x31, 0x5d, 0x3d, 0x3d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x3d, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76,
+  0x65, 0x75, 0x70, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62,
   0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c,
   0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
-  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72,
+  0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f,
+  0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
+  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x65,
+  0x6e, 0x64, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x69,
+  0x6e, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x75, 0x70,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23,
-  0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x70, 0x76, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
   0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20,
-  0x74, 0x72, 0x65, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x20, 0x3d, 0x20, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d,
-  0x30, 0x26, 0x26, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72, 0x63,
-  0x68, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x62, 0x62,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4e,
-  0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x26, 0x26, 0x6d, 0x6f, 0x76,
-  0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x5d, 0x26, 0x49, 0x54, 0x45, 0x52, 0x31, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c,
-  0x6f, 0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x31,
-  0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a,
-  0x36, 0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33,
-  0x32, 0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28,
-  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x5d, 0x26, 0x3d, 0x43, 0x4c, 0x52, 0x4d,
-  0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54,
-  0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6c, 0x6f,
-  0x62, 0x61, 0x6c, 0x62, 0x62, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x32, 0x5b,
-  0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59, 0x2a, 0x36,
-  0x34, 0x2b, 0x73, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x28, 0x73, 0x33, 0x32,
-  0x29, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d,
-  0x6f, 0x76, 0x65, 0x29, 0x5d, 0x26, 0x3d, 0x43, 0x4c, 0x52, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f,
-  0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x6f, 0x64, 0x65,
-  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x45, 0x52, 0x53,
-  0x5b, 0x67, 0x69, 0x64, 0x2a, 0x36, 0x34, 0x2b, 0x31, 0x5d, 0x2b, 0x2b,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x68,
-  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e,
-  0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x5d, 0x2b, 0x2b, 0x3b, 0x20, 0x2f,
-  0x2f, 0x20, 0x69, 0x6e, 0x63, 0x20, 0x61, 0x6e, 0x79, 0x77, 0x61, 0x79,
-  0x2c, 0x20, 0x73, 0x61, 0x66, 0x65, 0x74, 0x79, 0x20, 0x66, 0x69, 0x72,
-  0x73, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
-  0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x78, 0x36, 0x34,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x28,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20, 0x3d, 0x20,
-  0x21, 0x73, 0x74, 0x6d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x77, 0x69,
-  0x74, 0x63, 0x68, 0x20, 0x73, 0x69, 0x74, 0x65, 0x20, 0x74, 0x6f, 0x20,
-  0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x64, 0x2b,
-  0x2b, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x69, 0x6e, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x70, 0x6c, 0x79, 0x2b, 0x2b, 0x3b, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x63, 0x72, 0x65, 0x61,
-  0x73, 0x65, 0x20, 0x70, 0x6c, 0x79, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x65, 0x72, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63,
-  0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20,
-  0x78, 0x36, 0x34, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x3d, 0x20, 0x48, 0x41, 0x53, 0x48, 0x4e, 0x4f, 0x4e,
-  0x45, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6d,
-  0x70, 0x74, 0x79, 0x20, 0x68, 0x61, 0x73, 0x68, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x3d, 0x20, 0x47, 0x45, 0x54,
-  0x50, 0x49, 0x45, 0x43, 0x45, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c,
-  0x6c, 0x69, 0x64, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x28, 0x47, 0x45, 0x54, 0x50,
-  0x54, 0x59, 0x50, 0x45, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x29,
-  0x3f, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x47, 0x45, 0x54,
-  0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29,
-  0x2a, 0x36, 0x2b, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
-  0x70, 0x66, 0x72, 0x6f, 0x6d, 0x29, 0x2d, 0x31, 0x5d, 0x3a, 0x48, 0x41,
-  0x53, 0x48, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x3c, 0x3c, 0x6c, 0x69, 0x64, 0x29, 0x7c,
-  0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x28, 0x36, 0x34,
-  0x2d, 0x6c, 0x69, 0x64, 0x29, 0x29, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
-  0x72, 0x6f, 0x74, 0x61, 0x74, 0x65, 0x20, 0x6c, 0x65, 0x66, 0x74, 0x20,
-  0x36, 0x34, 0x0a, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69,
-  0x6e, 0x65, 0x64, 0x20, 0x63, 0x6c, 0x5f, 0x6b, 0x68, 0x72, 0x5f, 0x69,
-  0x6e, 0x74, 0x36, 0x34, 0x5f, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x65,
-  0x64, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x73, 0x20, 0x26, 0x26,
-  0x20, 0x21, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x20, 0x4f, 0x4c,
-  0x44, 0x53, 0x43, 0x48, 0x4f, 0x4f, 0x4c, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x68,
-  0x61, 0x73, 0x68, 0x65, 0x73, 0x20, 0x78, 0x36, 0x34, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x78, 0x6f, 0x72, 0x28, 0x26,
-  0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x0a, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43,
+  0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d,
+  0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x62,
+  0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47,
+  0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
+  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6d,
+  0x61, 0x72, 0x6b, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x73, 0x6c, 0x69,
+  0x63, 0x65, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x0a, 0x20, 0x20, 0x69, 0x66,
   0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x20, 0x3d, 0x20, 0x62, 0x62, 0x41, 0x74, 0x74, 0x61, 0x63, 0x6b, 0x73,
-  0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20, 0x68, 0x61, 0x73,
-  0x68, 0x20, 0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x20, 0x74,
-  0x65, 0x6d, 0x70, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x6d,
-  0x70, 0x36, 0x34, 0x5b, 0x6c, 0x69, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f,
-  0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45,
-  0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x68, 0x61, 0x73,
-  0x68, 0x65, 0x73, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
-  0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e,
-  0x74, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x36, 0x34, 0x3b, 0x69,
-  0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x62, 0x62,
-  0x54, 0x6d, 0x70, 0x36, 0x34, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x23, 0x65,
-  0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x75, 0x70, 0x20, 0x78, 0x31, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d,
-  0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73,
-  0x73, 0x61, 0x6e, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x74, 0x6f, 0x20, 0x3d, 0x20, 0x28,
-  0x20, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45,
-  0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x47, 0x45, 0x54,
-  0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2c, 0x47,
-  0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47, 0x45, 0x54, 0x50,
-  0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x29,
-  0x2d, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x47, 0x45,
-  0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65,
-  0x29, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47,
-  0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65,
-  0x29, 0x29, 0x29, 0x3d, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3f, 0x47,
-  0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x3a, 0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x20, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x28, 0x28, 0x5a, 0x6f, 0x62, 0x72, 0x69,
-  0x73, 0x74, 0x5b, 0x31, 0x36, 0x5d, 0x3c, 0x3c, 0x47, 0x45, 0x54, 0x46,
-  0x49, 0x4c, 0x45, 0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x7c, 0x28,
-  0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x36, 0x5d, 0x3e,
-  0x3e, 0x28, 0x36, 0x34, 0x2d, 0x47, 0x45, 0x54, 0x46, 0x49, 0x4c, 0x45,
-  0x28, 0x73, 0x71, 0x74, 0x6f, 0x29, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x69, 0x74, 0x65,
-  0x20, 0x74, 0x6f, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x74, 0x6d, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f,
-  0x72, 0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x30, 0x78, 0x31, 0x55, 0x4c, 0x3b,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76,
-  0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68,
-  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x43, 0x72, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64,
-  0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45,
+  0x20, 0x20, 0x43, 0x68, 0x65, 0x63, 0x6b, 0x70, 0x6f, 0x69, 0x6e, 0x74,
+  0x73, 0x5b, 0x63, 0x70, 0x2b, 0x43, 0x50, 0x53, 0x54, 0x41, 0x54, 0x45,
+  0x5d, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x73, 0x75, 0x73, 0x70, 0x65, 0x6e,
+  0x64, 0x65, 0x64, 0x29, 0x3f, 0x43, 0x50, 0x53, 0x55, 0x53, 0x50, 0x45,
+  0x4e, 0x44, 0x45, 0x44, 0x3a, 0x43, 0x50, 0x44, 0x4f, 0x4e, 0x45, 0x3b,
+  0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63,
+  0x74, 0x20, 0x70, 0x76, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x67, 0x75, 0x69,
+  0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x0a, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30, 0x26, 0x26, 0x61, 0x74,
+  0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63, 0x68, 0x67, 0x28, 0x69,
+  0x64, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x2c, 0x28, 0x75, 0x33, 0x32,
+  0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x2c, 0x28, 0x75, 0x33, 0x32, 0x29,
+  0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3d, 0x3d, 0x28, 0x75, 0x33, 0x32,
+  0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x69,
+  0x6e, 0x69, 0x74, 0x20, 0x71, 0x75, 0x61, 0x64, 0x62, 0x69, 0x74, 0x62,
+  0x6f, 0x61, 0x72, 0x64, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x20, 0x70, 0x6c,
+  0x75, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x61, 0x72, 0x64,
+  0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x20, 0x3d,
+  0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c,
+  0x41, 0x43, 0x4b, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42,
+  0x42, 0x50, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42,
+  0x42, 0x50, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f,
+  0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42,
+  0x42, 0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42,
+  0x42, 0x48, 0x41, 0x53, 0x48, 0x5d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x68,
+  0x61, 0x73, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61,
+  0x73, 0x6b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42, 0x50,
+  0x4d, 0x56, 0x44, 0x5d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x62, 0x62, 0x20,
+  0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74,
+  0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x28, 0x62, 0x6f, 0x6f, 0x6c, 0x29, 0x73, 0x74, 0x6d, 0x5f, 0x69, 0x6e,
+  0x69, 0x74, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x76, 0x6f,
+  0x75, 0x74, 0x5b, 0x30, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x62, 0x65,
+  0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x6e, 0x3c, 0x4d, 0x41, 0x58,
+  0x50, 0x4c, 0x59, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x76, 0x6f, 0x75, 0x74, 0x5b,
+  0x6e, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x6f,
+  0x6d, 0x6f, 0x76, 0x65, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20,
+  0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20, 0x3d, 0x20, 0x21,
+  0x73, 0x74, 0x6d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
+  0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20,
+  0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20,
+  0x66, 0x6f, 0x72, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72,
+  0x69, 0x67, 0x68, 0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45,
   0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53,
-  0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41,
-  0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f,
-  0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x20, 0x7c,
-  0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28,
-  0x47, 0x45, 0x54, 0x53, 0x51, 0x43, 0x50, 0x54, 0x28, 0x6d, 0x6f, 0x76,
+  0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
+  0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53,
+  0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54,
+  0x53, 0x51, 0x54, 0x4f, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
+  0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45,
+  0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53,
+  0x51, 0x43, 0x50, 0x54, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
   0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
   0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x65, 0x6e, 0x20, 0x70, 0x61, 0x73,
   0x73, 0x61, 0x6e, 0x74, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20,
@@ -6836,532 +9101,404 @@ const char zeta_cl[] = {
   0x61, 0x67, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x71,
   0x65, 0x70, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x20, 0x47, 0x45, 0x54,
   0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52,
-  0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3d, 0x3d, 0x50,
-  0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x47,
-  0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x47, 0x45, 0x54, 0x53,
-  0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2c, 0x47, 0x45,
-  0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46,
-  0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x29, 0x2d,
+  0x4f, 0x4d, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29,
+  0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57, 0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x26, 0x26, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28,
+  0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x62, 0x65, 0x73, 0x74,
+  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c,
+  0x4f, 0x52, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28,
+  0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x29, 0x2d,
   0x47, 0x45, 0x54, 0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x47, 0x45, 0x54,
-  0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47, 0x45,
-  0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x29, 0x29, 0x3d, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3f, 0x47,
-  0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
+  0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d,
+  0x6f, 0x76, 0x65, 0x29, 0x2c, 0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f,
+  0x52, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x62,
+  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x29, 0x3d, 0x3d,
+  0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x3f, 0x47, 0x45, 0x54, 0x53, 0x51,
+  0x54, 0x4f, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29,
   0x3a, 0x30, 0x78, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x20, 0x7c, 0x3d, 0x20, 0x30, 0x78,
+  0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x7c, 0x3d, 0x20, 0x30, 0x78,
   0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x46, 0x46, 0x46, 0x46, 0x30, 0x30,
   0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x69, 0x66, 0x20, 0x28, 0x73, 0x71, 0x65, 0x70, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
   0x20, 0x26, 0x3d, 0x20, 0x43, 0x4c, 0x52, 0x4d, 0x41, 0x53, 0x4b, 0x42,
   0x42, 0x28, 0x73, 0x71, 0x65, 0x70, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x20,
-  0x69, 0x6e, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x43, 0x72, 0x48, 0x69,
-  0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x3d, 0x20,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65,
-  0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65,
-  0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x7e, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x57, 0x48, 0x49, 0x54,
-  0x45, 0x51, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e, 0x3d, 0x20, 0x5a, 0x6f, 0x62,
-  0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x7e, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52, 0x57, 0x48,
-  0x49, 0x54, 0x45, 0x4b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e, 0x3d, 0x20, 0x5a,
-  0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x33, 0x5d, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x7e,
-  0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d, 0x43, 0x52,
-  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x51, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x5e, 0x3d,
-  0x20, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31, 0x34, 0x5d,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28,
-  0x28, 0x7e, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x29, 0x26, 0x53, 0x4d,
-  0x43, 0x52, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x4b, 0x29, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x5e, 0x3d, 0x20, 0x5a, 0x6f, 0x62, 0x72, 0x69, 0x73, 0x74, 0x5b, 0x31,
-  0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x68, 0x61, 0x73,
-  0x68, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6d, 0x6f, 0x76,
-  0x65, 0x3d, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57,
-  0x6f, 0x72, 0x6b, 0x20, 0x5e, 0x3d, 0x20, 0x30, 0x78, 0x31, 0x55, 0x4c,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x65, 0x74, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x7a, 0x6f, 0x62, 0x72, 0x69,
-  0x73, 0x74, 0x20, 0x68, 0x61, 0x73, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x61, 0x73, 0x68, 0x48,
-  0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x3d, 0x62,
-  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x48, 0x61, 0x73, 0x68, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
-  0x5b, 0x67, 0x69, 0x64, 0x2a, 0x4d, 0x41, 0x58, 0x47, 0x41, 0x4d, 0x45,
-  0x50, 0x4c, 0x59, 0x2b, 0x70, 0x6c, 0x79, 0x2b, 0x70, 0x6c, 0x79, 0x5f,
-  0x69, 0x6e, 0x69, 0x74, 0x5d, 0x3d, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x68,
-  0x61, 0x6c, 0x66, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x63, 0x6c, 0x6f, 0x63,
-  0x6b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b,
-  0x73, 0x64, 0x5d, 0x3d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43,
-  0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x2d, 0x31,
-  0x5d, 0x2b, 0x31, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x6e, 0x63, 0x72,
-  0x65, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x68, 0x6d, 0x63, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x47,
-  0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50,
-  0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3d,
-  0x3d, 0x50, 0x41, 0x57, 0x4e, 0x29, 0x29, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x70, 0x61, 0x77, 0x6e, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48,
-  0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64,
-  0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
-  0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x43, 0x50, 0x54, 0x28, 0x6d,
-  0x6f, 0x76, 0x65, 0x29, 0x29, 0x21, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45,
-  0x29, 0x29, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x61, 0x70, 0x74, 0x75, 0x72,
-  0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72,
-  0x79, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x61, 0x73, 0x74,
-  0x6c, 0x65, 0x20, 0x71, 0x75, 0x65, 0x65, 0x6e, 0x73, 0x69, 0x64, 0x65,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28,
-  0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47, 0x45, 0x54,
-  0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29,
-  0x3d, 0x3d, 0x4b, 0x49, 0x4e, 0x47, 0x29, 0x26, 0x26, 0x28, 0x47, 0x45,
-  0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65,
-  0x29, 0x2d, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x6d, 0x6f,
-  0x76, 0x65, 0x29, 0x3d, 0x3d, 0x32, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d,
-  0x43, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d,
+  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74,
+  0x65, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d,
+  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x68, 0x61, 0x73, 0x68,
+  0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x73, 0x74, 0x6d, 0x2c,
+  0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x29, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46,
+  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
+  0x6c, 0x6f, 0x61, 0x64, 0x20, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20,
+  0x66, 0x72, 0x6f, 0x6d, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x74, 0x61,
+  0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
+  0x20, 0x28, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e, 0x31,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20,
+  0x74, 0x74, 0x6c, 0x6f, 0x61, 0x64, 0x28, 0x54, 0x54, 0x31, 0x2c, 0x20,
+  0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2c, 0x20, 0x62, 0x62,
+  0x57, 0x6f, 0x72, 0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x31, 0x2e, 0x68,
+  0x61, 0x73, 0x68, 0x3d, 0x3d, 0x54, 0x54, 0x4b, 0x45, 0x59, 0x28, 0x62,
+  0x62, 0x57, 0x6f, 0x72, 0x6b, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65,
+  0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x3d,
+  0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x74, 0x74, 0x31, 0x2e,
+  0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76, 0x65, 0x29, 0x74, 0x74,
+  0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
+  0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x7c,
+  0x7c, 0x49, 0x53, 0x49, 0x4e, 0x46, 0x28, 0x62, 0x65, 0x73, 0x74, 0x73,
+  0x63, 0x6f, 0x72, 0x65, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x70,
+  0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x2c, 0x20, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x73,
+  0x68, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x74, 0x61,
+  0x6c, 0x73, 0x20, 0x74, 0x6f, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x2c, 0x20,
+  0x70, 0x6c, 0x61, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79,
+  0x2c, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x20, 0x62,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x6c, 0x69, 0x76, 0x65, 0x73, 0x20,
+  0x69, 0x6e, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x6d, 0x65, 0x6d, 0x6f,
+  0x72, 0x79, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x70,
+  0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x28, 0x6e, 0x3d, 0x30, 0x3b, 0x6e, 0x3c, 0x50, 0x52,
+  0x4f, 0x47, 0x4e, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x3b, 0x6e, 0x2b, 0x2b,
+  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70,
   0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x6b, 0x69,
-  0x6e, 0x67, 0x73, 0x69, 0x64, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59,
-  0x50, 0x45, 0x28, 0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28,
-  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3d, 0x3d, 0x4b, 0x49, 0x4e, 0x47,
-  0x29, 0x26, 0x26, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28,
-  0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2d, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46,
-  0x52, 0x4f, 0x4d, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3d, 0x3d, 0x32,
-  0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x48, 0x4d, 0x43, 0x48, 0x69, 0x73, 0x74, 0x6f,
-  0x72, 0x79, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65,
-  0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x6e, 0x65, 0x78, 0x74, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
-  0x6f, 0x76, 0x65, 0x48, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5b, 0x73,
-  0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
-  0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x49, 0x49, 0x44, 0x4d, 0x6f, 0x76, 0x65, 0x73, 0x5b,
-  0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x4d, 0x4f,
-  0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d, 0x6f, 0x76, 0x65, 0x43,
-  0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x36, 0x34, 0x20, 0x69,
+  0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x54, 0x4f, 0x54, 0x41, 0x4c, 0x57, 0x4f,
+  0x52, 0x4b, 0x45, 0x52, 0x53, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54,
+  0x65, 0x6d, 0x70, 0x20, 0x2b, 0x3d, 0x20, 0x43, 0x4f, 0x55, 0x4e, 0x54,
+  0x45, 0x52, 0x53, 0x5b, 0x69, 0x2a, 0x36, 0x34, 0x2b, 0x6e, 0x2b, 0x31,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x50,
+  0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5b, 0x50, 0x52, 0x4f, 0x47,
+  0x43, 0x4f, 0x55, 0x4e, 0x54, 0x2b, 0x28, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2a, 0x50, 0x52, 0x4f, 0x47,
+  0x4e, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x2b, 0x6e, 0x29, 0x2a, 0x32, 0x5d,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x33, 0x32, 0x29, 0x62, 0x62,
+  0x54, 0x65, 0x6d, 0x70, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5b, 0x50,
+  0x52, 0x4f, 0x47, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x2b, 0x28, 0x73, 0x65,
+  0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2a, 0x50,
+  0x52, 0x4f, 0x47, 0x4e, 0x43, 0x4f, 0x55, 0x4e, 0x54, 0x2b, 0x6e, 0x29,
+  0x2a, 0x32, 0x2b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x33, 0x32,
+  0x29, 0x28, 0x62, 0x62, 0x54, 0x65, 0x6d, 0x70, 0x3e, 0x3e, 0x33, 0x32,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x65, 0x6d, 0x5f, 0x66, 0x65, 0x6e,
+  0x63, 0x65, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f, 0x42, 0x41,
+  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2a, 0x28, 0x76, 0x6f,
+  0x6c, 0x61, 0x74, 0x69, 0x6c, 0x65, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x33, 0x32, 0x20, 0x2a, 0x29, 0x26, 0x50,
+  0x72, 0x6f, 0x67, 0x72, 0x65, 0x73, 0x73, 0x5b, 0x50, 0x52, 0x4f, 0x47,
+  0x50, 0x56, 0x2b, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x2a, 0x50, 0x52, 0x4f, 0x47, 0x53, 0x4c, 0x4f, 0x54,
+  0x5d, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20,
+  0x63, 0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x70, 0x76, 0x0a, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65,
+  0x6e, 0x74, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x2c, 0x20, 0x6e,
+  0x65, 0x78, 0x74, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x75, 0x6e,
+  0x74, 0x69, 0x6c, 0x20, 0x6d, 0x61, 0x78, 0x20, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x2c, 0x20, 0x6e, 0x6f, 0x64, 0x65, 0x20, 0x6c, 0x69, 0x6d, 0x69,
+  0x74, 0x20, 0x6f, 0x72, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x20, 0x73, 0x74,
+  0x6f, 0x70, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64,
+  0x3d, 0x3d, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x6e, 0x65, 0x78, 0x74, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20,
+  0x3d, 0x20, 0x28, 0x70, 0x65, 0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e,
+  0x74, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62,
+  0x73, 0x75, 0x73, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x0a, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65,
-  0x78, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x30,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63,
-  0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c,
-  0x50, 0x48, 0x41, 0x5d, 0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53,
-  0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29,
-  0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
-  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
-  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
-  0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41,
-  0x4c, 0x50, 0x48, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b,
-  0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d,
-  0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b,
-  0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d, 0x31, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
-  0x64, 0x65, 0x63, 0x72, 0x65, 0x61, 0x73, 0x65, 0x20, 0x64, 0x65, 0x70,
-  0x74, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68,
+  0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3c, 0x73, 0x65, 0x61, 0x72, 0x63,
+  0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x43, 0x4f, 0x55,
+  0x4e, 0x54, 0x45, 0x52, 0x53, 0x5b, 0x31, 0x5d, 0x3c, 0x3d, 0x6d, 0x61,
+  0x78, 0x5f, 0x6e, 0x6f, 0x64, 0x65, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x26, 0x26, 0x2a, 0x73, 0x74, 0x6f, 0x70, 0x66, 0x6c, 0x61,
+  0x67, 0x3d, 0x3d, 0x30, 0x29, 0x3f, 0x74, 0x72, 0x75, 0x65, 0x3a, 0x66,
+  0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x2c,
+  0x20, 0x72, 0x65, 0x72, 0x75, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+  0x6f, 0x66, 0x20, 0x73, 0x61, 0x6d, 0x65, 0x20, 0x64, 0x65, 0x70, 0x74,
+  0x68, 0x20, 0x61, 0x73, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x62, 0x6e, 0x65, 0x78, 0x74, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x20, 0x3d, 0x20, 0x28, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x70,
+  0x6c, 0x69, 0x74, 0x26, 0x26, 0x62, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72,
+  0x26, 0x26, 0x73, 0x64, 0x3c, 0x31, 0x26, 0x26, 0x21, 0x62, 0x73, 0x75,
+  0x73, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x29, 0x3f, 0x74, 0x72, 0x75,
+  0x65, 0x3a, 0x62, 0x6e, 0x65, 0x78, 0x74, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72,
+  0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41,
+  0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28,
+  0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x4d,
+  0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20, 0x73, 0x70, 0x6c,
+  0x69, 0x74, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x70, 0x65, 0x72, 0x20, 0x6c, 0x61,
+  0x75, 0x6e, 0x63, 0x68, 0x2c, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x70, 0x65,
+  0x72, 0x73, 0x69, 0x73, 0x74, 0x65, 0x6e, 0x74, 0x0a, 0x20, 0x20, 0x73,
+  0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20,
+  0x3d, 0x20, 0x28, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x70, 0x6c, 0x69, 0x74,
+  0x29, 0x3f, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x3a, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x5f, 0x64, 0x65,
+  0x70, 0x74, 0x68, 0x2b, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x20, 0x77,
+  0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x62, 0x6e, 0x65, 0x78, 0x74, 0x64,
+  0x65, 0x70, 0x74, 0x68, 0x29, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e,
+  0x64, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+  0x64, 0x65, 0x65, 0x70, 0x65, 0x6e, 0x69, 0x6e, 0x67, 0x0a, 0x7d, 0x20,
+  0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65,
+  0x6c, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x61, 0x5f,
+  0x67, 0x70, 0x75, 0x0a, 0x0a, 0x2f, 0x2f, 0x20, 0x7a, 0x65, 0x72, 0x6f,
+  0x20, 0x6f, 0x75, 0x74, 0x20, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x20,
+  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x75, 0x73, 0x65, 0x64,
+  0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x20, 0x68, 0x61,
+  0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x73, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65,
+  0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x67, 0x61, 0x6d, 0x65, 0x0a, 0x5f,
+  0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64,
+  0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x5f, 0x62, 0x75, 0x66, 0x66, 0x65,
+  0x72, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x53, 0x54, 0x41, 0x54, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x20,
-  0x7c, 0x20, 0x49, 0x54, 0x45, 0x52, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20, 0x76,
-  0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x6c,
-  0x70, 0x68, 0x61, 0x20, 0x62, 0x65, 0x74, 0x61, 0x20, 0x77, 0x69, 0x6e,
-  0x64, 0x6f, 0x77, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x49, 0x49, 0x44, 0x20,
-  0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x69, 0x66, 0x20, 0x28, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61,
-  0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x73, 0x64, 0x3e, 0x32, 0x20, 0x2f, 0x2f, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x62,
-  0x72, 0x61, 0x6e, 0x64, 0x6f, 0x6d, 0x69, 0x7a, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f, 0x76,
-  0x65, 0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d,
-  0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f, 0x4e,
-  0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26,
-  0x26, 0x74, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56,
-  0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f,
-  0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31,
-  0x5d, 0x3d, 0x3d, 0x31, 0x20, 0x2f, 0x2f, 0x20, 0x69, 0x69, 0x64, 0x20,
-  0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x20, 0x66, 0x69, 0x72, 0x73,
-  0x74, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4d,
-  0x6f, 0x76, 0x65, 0x43, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x5b, 0x73,
-  0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44,
-  0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x35,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26,
-  0x49, 0x49, 0x44, 0x29, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x44, 0x4f, 0x4e, 0x45,
-  0x29, 0x20, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64,
-  0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31,
-  0x5d, 0x26, 0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2d, 0x31, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x49,
-  0x49, 0x44, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65,
-  0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x28, 0x73, 0x64,
-  0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d,
-  0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
-  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
-  0x65, 0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b,
-  0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2b, 0x49,
-  0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61, 0x42, 0x65,
-  0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a,
-  0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41,
-  0x6c, 0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72,
-  0x65, 0x73, 0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41,
-  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x2b, 0x49,
-  0x4e, 0x46, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53, 0x65,
-  0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64, 0x5d,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x75, 0x33, 0x32, 0x20, 0x2a, 0x62, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x6f, 0x66,
+  0x66, 0x73, 0x65, 0x74, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x73,
+  0x69, 0x7a, 0x65, 0x0a, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f,
+  0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x69, 0x20, 0x3d, 0x20,
+  0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2b, 0x28, 0x75, 0x36, 0x34, 0x29,
+  0x67, 0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69,
+  0x64, 0x28, 0x30, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x69, 0x3c, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x5b, 0x69, 0x5d, 0x20, 0x3d,
+  0x20, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x20, 0x54, 0x54, 0x31, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x54, 0x54, 0x32, 0x20, 0x61, 0x74, 0x20, 0x65, 0x76, 0x65, 0x6e, 0x20,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x68, 0x6f, 0x73, 0x74, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x61, 0x6e,
+  0x63, 0x79, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63,
+  0x73, 0x2c, 0x20, 0x70, 0x65, 0x72, 0x0a, 0x2f, 0x2f, 0x20, 0x73, 0x61,
+  0x6d, 0x70, 0x6c, 0x65, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x66, 0x6c,
+  0x61, 0x67, 0x2c, 0x20, 0x61, 0x67, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x70,
+  0x6c, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x74,
+  0x61, 0x62, 0x6c, 0x65, 0x2c, 0x20, 0x2d, 0x31, 0x20, 0x69, 0x66, 0x20,
+  0x6e, 0x6f, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2c, 0x0a, 0x2f,
+  0x2f, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x54, 0x54, 0x32,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x20, 0x67, 0x65, 0x6e, 0x65,
+  0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x6d, 0x61, 0x70, 0x70,
+  0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x70, 0x6c, 0x69, 0x65, 0x73, 0x20,
+  0x62, 0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x2c, 0x0a, 0x2f, 0x2f, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x69, 0x64, 0x65, 0x72, 0x20, 0x61, 0x6c, 0x73,
+  0x6f, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x0a, 0x5f, 0x5f,
+  0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20,
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x74, 0x74, 0x28, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x54, 0x54, 0x31, 0x45,
+  0x20, 0x2a, 0x54, 0x54, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c,
+  0x6f, 0x62, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x41,
+  0x42, 0x44, 0x41, 0x44, 0x41, 0x54, 0x54, 0x45, 0x20, 0x2a, 0x54, 0x54,
+  0x32, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x49, 0x49, 0x44,
-  0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70,
-  0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20,
+  0x73, 0x33, 0x32, 0x20, 0x2a, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x63, 0x61,
-  0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d,
-  0x2f, 0x35, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x64,
-  0x65, 0x70, 0x74, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73,
-  0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x61, 0x6e,
-  0x64, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x20, 0x62, 0x65, 0x74, 0x61,
-  0x20, 0x77, 0x69, 0x6e, 0x64, 0x6f, 0x77, 0x20, 0x66, 0x6f, 0x72, 0x20,
-  0x6e, 0x75, 0x6c, 0x6c, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x73, 0x65, 0x61,
-  0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66,
-  0x20, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4e, 0x55, 0x4c, 0x4c,
-  0x4d, 0x4f, 0x56, 0x45, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78,
-  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x2d, 0x2d, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x53,
-  0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65, 0x5b, 0x73, 0x64,
-  0x5d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f,
-  0x56, 0x45, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44,
-  0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2d, 0x3d, 0x20, 0x4e, 0x55, 0x4c, 0x4c, 0x52, 0x3b,
-  0x20, 0x2f, 0x2f, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x72, 0x65,
-  0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70,
-  0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2a, 0x32, 0x2b, 0x41, 0x4c, 0x50, 0x48, 0x41, 0x5d,
-  0x20, 0x20, 0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c,
-  0x70, 0x68, 0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65,
-  0x73, 0x5b, 0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x42,
-  0x45, 0x54, 0x41, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68, 0x61,
-  0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54, 0x41, 0x5d, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x2d, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x41, 0x6c, 0x70, 0x68,
-  0x61, 0x42, 0x65, 0x74, 0x61, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x73, 0x5b,
-  0x28, 0x73, 0x64, 0x2d, 0x31, 0x29, 0x2a, 0x32, 0x2b, 0x42, 0x45, 0x54,
-  0x41, 0x5d, 0x2b, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x73, 0x65, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x20, 0x66,
-  0x6f, 0x72, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x73,
-  0x65, 0x61, 0x72, 0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x69, 0x66, 0x20, 0x28, 0x21, 0x62, 0x72, 0x65, 0x73, 0x65, 0x61, 0x72,
-  0x63, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x73, 0x64, 0x3e, 0x32, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6e,
-  0x6f, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6d, 0x6f,
-  0x76, 0x65, 0x21, 0x3d, 0x4e, 0x55, 0x4c, 0x4c, 0x4d, 0x4f, 0x56, 0x45,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x6d, 0x6f, 0x76, 0x65, 0x21, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e, 0x4f,
-  0x4e, 0x45, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x26, 0x26, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28, 0x47,
-  0x45, 0x54, 0x50, 0x43, 0x50, 0x54, 0x28, 0x6d, 0x6f, 0x76, 0x65, 0x29,
-  0x29, 0x3d, 0x3d, 0x50, 0x4e, 0x4f, 0x4e, 0x45, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x2f, 0x2f, 0x20, 0x71, 0x75, 0x69, 0x65, 0x74, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x73, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f,
-  0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65,
-  0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x49, 0x49, 0x44, 0x29,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53,
-  0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26,
-  0x51, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x4e, 0x6f,
-  0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73, 0x64, 0x2d,
-  0x31, 0x5d, 0x26, 0x4b, 0x49, 0x43, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x21, 0x28, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73,
-  0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x26, 0x45, 0x58, 0x54, 0x29, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x6c,
-  0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f, 0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65,
-  0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x32, 0x20, 0x2f, 0x2f,
-  0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x73, 0x20, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x65, 0x64,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26,
-  0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73,
-  0x64, 0x2d, 0x31, 0x5d, 0x3e, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x63, 0x6f, 0x75, 0x6e, 0x74,
-  0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42,
-  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x29, 0x3e, 0x3d, 0x32, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x63, 0x6f,
-  0x75, 0x6e, 0x74, 0x31, 0x73, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b,
-  0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x5e, 0x28, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x7c,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d,
-  0x7c, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33,
-  0x5d, 0x29, 0x29, 0x3e, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x44, 0x65, 0x70, 0x74, 0x68, 0x5b, 0x73, 0x64, 0x5d, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x3d, 0x20, 0x4c, 0x4d,
-  0x52, 0x52, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68,
-  0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c,
-  0x4e, 0x6f, 0x64, 0x65, 0x53, 0x74, 0x61, 0x74, 0x65, 0x73, 0x5b, 0x73,
-  0x64, 0x2d, 0x31, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x4c, 0x4d, 0x52, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x63,
-  0x61, 0x6c, 0x53, 0x65, 0x61, 0x72, 0x63, 0x68, 0x4d, 0x6f, 0x64, 0x65,
-  0x5b, 0x73, 0x64, 0x5d, 0x20, 0x20, 0x20, 0x7c, 0x3d, 0x20, 0x4c, 0x4d,
-  0x52, 0x53, 0x45, 0x41, 0x52, 0x43, 0x48, 0x3b, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f,
-  0x2f, 0x20, 0x67, 0x65, 0x74, 0x20, 0x61, 0x20, 0x62, 0x65, 0x73, 0x74,
-  0x6d, 0x6f, 0x76, 0x65, 0x20, 0x61, 0x6e, 0x79, 0x77, 0x61, 0x79, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x64,
-  0x3d, 0x3d, 0x32, 0x26, 0x26, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x54, 0x6f,
-  0x64, 0x6f, 0x49, 0x6e, 0x64, 0x65, 0x78, 0x5b, 0x73, 0x64, 0x2d, 0x31,
-  0x5d, 0x3d, 0x3d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d,
-  0x20, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d,
-  0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65,
-  0x75, 0x70, 0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x4c, 0x4f,
-  0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43,
-  0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x72, 0x72,
-  0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c, 0x4f, 0x42,
-  0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e, 0x43, 0x45,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x65, 0x6e,
-  0x64, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x6d, 0x61, 0x69, 0x6e,
-  0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
-  0x20, 0x23, 0x23, 0x23, 0x23, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63,
-  0x6f, 0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x70, 0x76, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x23, 0x23, 0x23, 0x23, 0x0a, 0x20, 0x20,
-  0x2f, 0x2f, 0x20, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0a,
-  0x20, 0x20, 0x62, 0x61, 0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c,
-  0x4b, 0x5f, 0x4c, 0x4f, 0x43, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f,
-  0x46, 0x45, 0x4e, 0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x61,
-  0x72, 0x72, 0x69, 0x65, 0x72, 0x28, 0x43, 0x4c, 0x4b, 0x5f, 0x47, 0x4c,
-  0x4f, 0x42, 0x41, 0x4c, 0x5f, 0x4d, 0x45, 0x4d, 0x5f, 0x46, 0x45, 0x4e,
-  0x43, 0x45, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x63, 0x6f,
-  0x6c, 0x6c, 0x65, 0x63, 0x74, 0x20, 0x70, 0x76, 0x20, 0x66, 0x6f, 0x72,
-  0x20, 0x67, 0x75, 0x69, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x0a,
-  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6c, 0x69, 0x64, 0x3d, 0x3d, 0x30,
-  0x26, 0x26, 0x61, 0x74, 0x6f, 0x6d, 0x5f, 0x63, 0x6d, 0x70, 0x78, 0x63,
-  0x68, 0x67, 0x28, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x6f, 0x2c, 0x28, 0x75,
-  0x33, 0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x2c, 0x28, 0x75, 0x33,
-  0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x3d, 0x3d, 0x28, 0x75,
-  0x33, 0x32, 0x29, 0x67, 0x69, 0x64, 0x2b, 0x31, 0x29, 0x0a, 0x20, 0x20,
-  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x67, 0x65, 0x74,
-  0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x71, 0x75, 0x61, 0x64, 0x62, 0x69,
-  0x74, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x20, 0x70, 0x6c, 0x75, 0x73, 0x20,
-  0x70, 0x6c, 0x75, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x61,
-  0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d,
-  0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42, 0x42,
-  0x42, 0x4c, 0x41, 0x43, 0x4b, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x31, 0x5d,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x32, 0x5d,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x6f, 0x61, 0x72, 0x64, 0x5b, 0x51, 0x42, 0x42, 0x50, 0x33, 0x5d,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b,
-  0x51, 0x42, 0x42, 0x50, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b,
-  0x51, 0x42, 0x42, 0x48, 0x41, 0x53, 0x48, 0x5d, 0x3b, 0x20, 0x2f, 0x2f,
-  0x20, 0x68, 0x61, 0x73, 0x68, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x4d, 0x61, 0x73, 0x6b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x3d, 0x20, 0x42, 0x4f, 0x41, 0x52, 0x44, 0x5b, 0x51, 0x42,
-  0x42, 0x50, 0x4d, 0x56, 0x44, 0x5d, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x62,
-  0x62, 0x20, 0x63, 0x61, 0x73, 0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67,
-  0x68, 0x74, 0x73, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x54, 0x65,
-  0x6d, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x3d, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72, 0x6b, 0x26, 0x28, 0x74, 0x74,
-  0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2d, 0x31, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x73, 0x74, 0x6d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x28, 0x62, 0x6f,
-  0x6f, 0x6c, 0x29, 0x73, 0x74, 0x6d, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x3b,
-  0x0a, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x31,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x50, 0x56, 0x5b, 0x30, 0x5d, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
-  0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x62, 0x65, 0x73, 0x74, 0x73,
-  0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x77, 0x68,
-  0x69, 0x6c, 0x65, 0x28, 0x6e, 0x3c, 0x4d, 0x41, 0x58, 0x50, 0x4c, 0x59,
-  0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x50, 0x56, 0x5b, 0x6e, 0x5d, 0x20, 0x3d, 0x20, 0x62,
-  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x64, 0x6f, 0x6d, 0x6f, 0x76, 0x65, 0x28, 0x62,
-  0x6f, 0x61, 0x72, 0x64, 0x2c, 0x20, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
-  0x76, 0x65, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x74, 0x6d, 0x20, 0x3d, 0x20, 0x21, 0x73, 0x74, 0x6d, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20,
-  0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x64, 0x20,
-  0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x63, 0x61,
-  0x73, 0x74, 0x6c, 0x65, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20,
-  0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d, 0x28,
-  0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
-  0x20, 0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b,
-  0x42, 0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x62,
-  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20,
-  0x20, 0x7c, 0x3d, 0x20, 0x53, 0x45, 0x54, 0x4d, 0x41, 0x53, 0x4b, 0x42,
-  0x42, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x43, 0x50, 0x54, 0x28, 0x62,
-  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x73, 0x65, 0x74, 0x20,
-  0x65, 0x6e, 0x20, 0x70, 0x61, 0x73, 0x73, 0x61, 0x6e, 0x74, 0x20, 0x74,
-  0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
-  0x20, 0x69, 0x6e, 0x20, 0x70, 0x69, 0x65, 0x63, 0x65, 0x20, 0x6d, 0x6f,
-  0x76, 0x65, 0x64, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x73, 0x71, 0x65, 0x70, 0x20, 0x20, 0x20, 0x3d,
-  0x20, 0x28, 0x20, 0x47, 0x45, 0x54, 0x50, 0x54, 0x59, 0x50, 0x45, 0x28,
-  0x47, 0x45, 0x54, 0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x62, 0x65, 0x73,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x29, 0x3d, 0x3d, 0x50, 0x41, 0x57,
-  0x4e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x26, 0x26, 0x47, 0x45, 0x54,
-  0x52, 0x52, 0x41, 0x4e, 0x4b, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54,
-  0x4f, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2c,
-  0x47, 0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47, 0x45, 0x54,
-  0x50, 0x46, 0x52, 0x4f, 0x4d, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
-  0x76, 0x65, 0x29, 0x29, 0x29, 0x2d, 0x47, 0x45, 0x54, 0x52, 0x52, 0x41,
-  0x4e, 0x4b, 0x28, 0x47, 0x45, 0x54, 0x53, 0x51, 0x46, 0x52, 0x4f, 0x4d,
-  0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x2c, 0x47,
-  0x45, 0x54, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x28, 0x47, 0x45, 0x54, 0x50,
-  0x46, 0x52, 0x4f, 0x4d, 0x28, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76,
-  0x65, 0x29, 0x29, 0x29, 0x3d, 0x3d, 0x32, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29,
-  0x3f, 0x47, 0x45, 0x54, 0x53, 0x51, 0x54, 0x4f, 0x28, 0x62, 0x65, 0x73,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x29, 0x3a, 0x30, 0x78, 0x30, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b,
-  0x20, 0x7c, 0x3d, 0x20, 0x30, 0x78, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-  0x46, 0x46, 0x46, 0x46, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x0a,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x73, 0x71,
-  0x65, 0x70, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x62, 0x62, 0x4d, 0x61, 0x73, 0x6b, 0x20, 0x26, 0x3d, 0x20, 0x43, 0x4c,
-  0x52, 0x4d, 0x41, 0x53, 0x4b, 0x42, 0x42, 0x28, 0x73, 0x71, 0x65, 0x70,
-  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20,
-  0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x65, 0x20, 0x68, 0x61, 0x73, 0x68,
-  0x20, 0x78, 0x31, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x57, 0x6f, 0x72, 0x6b, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75,
-  0x74, 0x65, 0x68, 0x61, 0x73, 0x68, 0x28, 0x62, 0x6f, 0x61, 0x72, 0x64,
-  0x2c, 0x20, 0x73, 0x74, 0x6d, 0x2c, 0x20, 0x62, 0x62, 0x4d, 0x61, 0x73,
-  0x6b, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x20, 0x3d, 0x20, 0x62, 0x62, 0x57, 0x6f, 0x72,
-  0x6b, 0x26, 0x28, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2d,
-  0x31, 0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62,
-  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x4d, 0x4f,
-  0x56, 0x45, 0x4e, 0x4f, 0x4e, 0x45, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20,
-  0x3d, 0x20, 0x2d, 0x49, 0x4e, 0x46, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x74,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x68,
-  0x61, 0x73, 0x68, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x0a, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x69, 0x6e,
-  0x64, 0x65, 0x78, 0x31, 0x3e, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x31, 0x5b, 0x62, 0x62,
-  0x54, 0x65, 0x6d, 0x70, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x74, 0x31, 0x2e, 0x68,
-  0x61, 0x73, 0x68, 0x3d, 0x3d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x62, 0x62, 0x57,
-  0x6f, 0x72, 0x6b, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74,
-  0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x5e, 0x28,
-  0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x31,
-  0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73, 0x74, 0x73, 0x63, 0x6f,
-  0x72, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x53, 0x63, 0x6f, 0x72, 0x65, 0x29,
-  0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x3b, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x65, 0x73,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3d, 0x20, 0x28, 0x4d, 0x6f, 0x76,
-  0x65, 0x29, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
-  0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x62, 0x65, 0x73,
-  0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3d, 0x3d, 0x4d, 0x4f, 0x56, 0x45, 0x4e,
-  0x4f, 0x4e, 0x45, 0x7c, 0x7c, 0x49, 0x53, 0x49, 0x4e, 0x46, 0x28, 0x62,
-  0x65, 0x73, 0x74, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x29, 0x29, 0x0a, 0x20,
-  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b,
-  0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6e, 0x2b, 0x2b,
-  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x7d, 0x20,
-  0x2f, 0x2f, 0x20, 0x65, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6c, 0x65,
-  0x63, 0x74, 0x20, 0x70, 0x76, 0x0a, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x65,
-  0x6e, 0x64, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x20, 0x61, 0x6c,
-  0x70, 0x68, 0x61, 0x62, 0x65, 0x74, 0x61, 0x5f, 0x67, 0x70, 0x75, 0x0a,
-  0x0a
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+  0x36, 0x34, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36,
+  0x34, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x32, 0x2c, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x73, 0x33, 0x32,
+  0x20, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74, 0x0a, 0x29, 0x0a,
+  0x7b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36,
+  0x34, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x67,
+  0x65, 0x74, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64,
+  0x28, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+  0x20, 0x75, 0x36, 0x34, 0x20, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x31,
+  0x20, 0x3d, 0x20, 0x28, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31,
+  0x3e, 0x54, 0x54, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x29, 0x3f,
+  0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x2f, 0x54, 0x54, 0x53,
+  0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x3a, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x73, 0x74,
+  0x72, 0x69, 0x64, 0x65, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x54, 0x54, 0x49,
+  0x4e, 0x44, 0x45, 0x58, 0x32, 0x3e, 0x54, 0x54, 0x53, 0x41, 0x4d, 0x50,
+  0x4c, 0x45, 0x53, 0x29, 0x3f, 0x54, 0x54, 0x49, 0x4e, 0x44, 0x45, 0x58,
+  0x32, 0x2f, 0x54, 0x54, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x3a,
+  0x31, 0x3b, 0x0a, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+  0x6c, 0x20, 0x73, 0x33, 0x32, 0x20, 0x2a, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+  0x65, 0x20, 0x3d, 0x20, 0x26, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73,
+  0x5b, 0x69, 0x2a, 0x54, 0x54, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53,
+  0x49, 0x5a, 0x45, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x54, 0x54, 0x31, 0x45,
+  0x20, 0x74, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x41, 0x42, 0x44, 0x41,
+  0x44, 0x41, 0x54, 0x54, 0x45, 0x20, 0x74, 0x74, 0x32, 0x3b, 0x0a, 0x0a,
+  0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x3e, 0x3d, 0x54, 0x54, 0x53,
+  0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x66,
+  0x6f, 0x72, 0x20, 0x28, 0x73, 0x33, 0x32, 0x20, 0x6a, 0x3d, 0x30, 0x3b,
+  0x6a, 0x3c, 0x54, 0x54, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x53, 0x49,
+  0x5a, 0x45, 0x3b, 0x6a, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x6a, 0x5d, 0x20, 0x3d, 0x20,
+  0x2d, 0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x72, 0x6f,
+  0x74, 0x61, 0x74, 0x65, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68,
+  0x20, 0x73, 0x6c, 0x6f, 0x74, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x62, 0x75,
+  0x63, 0x6b, 0x65, 0x74, 0x2c, 0x20, 0x73, 0x6c, 0x6f, 0x74, 0x20, 0x30,
+  0x20, 0x61, 0x6c, 0x6f, 0x6e, 0x65, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x73,
+  0x74, 0x61, 0x74, 0x65, 0x73, 0x20, 0x6f, 0x63, 0x63, 0x75, 0x70, 0x61,
+  0x6e, 0x63, 0x79, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x54, 0x54,
+  0x49, 0x4e, 0x44, 0x45, 0x58, 0x31, 0x3e, 0x31, 0x26, 0x26, 0x69, 0x2a,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x31, 0x3c, 0x54, 0x54, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x31, 0x5b,
+  0x69, 0x2a, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x31, 0x2b, 0x28, 0x28,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x31, 0x3e, 0x3d, 0x54, 0x54, 0x42,
+  0x55, 0x43, 0x4b, 0x45, 0x54, 0x29, 0x3f, 0x69, 0x25, 0x54, 0x54, 0x42,
+  0x55, 0x43, 0x4b, 0x45, 0x54, 0x3a, 0x30, 0x29, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x30, 0x5d,
+  0x20, 0x3d, 0x20, 0x28, 0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73, 0x68,
+  0x21, 0x3d, 0x30, 0x7c, 0x7c, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x21, 0x3d, 0x30, 0x29, 0x3f, 0x31, 0x3a, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x31,
+  0x5d, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x28, 0x28, 0x28,
+  0x75, 0x33, 0x32, 0x29, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x2d, 0x28, 0x75, 0x33, 0x32, 0x29, 0x28, 0x74, 0x74, 0x31, 0x2e, 0x66,
+  0x6c, 0x61, 0x67, 0x3e, 0x3e, 0x32, 0x29, 0x29, 0x26, 0x30, 0x78, 0x33,
+  0x46, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70,
+  0x6c, 0x65, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32,
+  0x29, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x54, 0x54,
+  0x49, 0x4e, 0x44, 0x45, 0x58, 0x32, 0x3e, 0x31, 0x26, 0x26, 0x69, 0x2a,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x32, 0x3c, 0x54, 0x54, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x74, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x32, 0x5b,
+  0x69, 0x2a, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x32, 0x5d, 0x3b, 0x0a,
+  0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x54, 0x54, 0x32, 0x43, 0x4f,
+  0x4d, 0x50, 0x41, 0x43, 0x54, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x73, 0x61,
+  0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x28, 0x74,
+  0x74, 0x32, 0x21, 0x3d, 0x30, 0x29, 0x3f, 0x31, 0x3a, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x34,
+  0x5d, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x54, 0x54, 0x32,
+  0x47, 0x45, 0x4e, 0x28, 0x74, 0x74, 0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x35, 0x5d, 0x20,
+  0x3d, 0x20, 0x54, 0x54, 0x32, 0x44, 0x45, 0x50, 0x54, 0x48, 0x28, 0x74,
+  0x74, 0x32, 0x29, 0x3b, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x33, 0x5d,
+  0x20, 0x3d, 0x20, 0x28, 0x74, 0x74, 0x32, 0x2e, 0x68, 0x61, 0x73, 0x68,
+  0x21, 0x3d, 0x30, 0x7c, 0x7c, 0x74, 0x74, 0x32, 0x2e, 0x64, 0x65, 0x70,
+  0x74, 0x68, 0x21, 0x3d, 0x30, 0x29, 0x3f, 0x31, 0x3a, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x34,
+  0x5d, 0x20, 0x3d, 0x20, 0x70, 0x6c, 0x79, 0x5f, 0x69, 0x6e, 0x69, 0x74,
+  0x2b, 0x31, 0x2d, 0x74, 0x74, 0x32, 0x2e, 0x70, 0x6c, 0x79, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5b, 0x35,
+  0x5d, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x33, 0x32, 0x29, 0x74, 0x74, 0x32,
+  0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a, 0x23, 0x65, 0x6e, 0x64,
+  0x69, 0x66, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x2f, 0x2f, 0x20,
+  0x6d, 0x65, 0x72, 0x67, 0x65, 0x20, 0x54, 0x54, 0x20, 0x65, 0x6e, 0x74,
+  0x72, 0x69, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x68, 0x6f, 0x73, 0x74,
+  0x20, 0x68, 0x65, 0x6c, 0x70, 0x65, 0x72, 0x20, 0x74, 0x68, 0x72, 0x65,
+  0x61, 0x64, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x20, 0x54, 0x54, 0x31,
+  0x2c, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x73, 0x65, 0x61,
+  0x72, 0x63, 0x68, 0x20, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x0a, 0x2f,
+  0x2f, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x69, 0x6e, 0x20, 0x73, 0x61,
+  0x6d, 0x65, 0x20, 0x69, 0x6e, 0x2d, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x20,
+  0x71, 0x75, 0x65, 0x75, 0x65, 0x2c, 0x20, 0x72, 0x65, 0x70, 0x6c, 0x61,
+  0x63, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x73, 0x63, 0x68, 0x65, 0x6d,
+  0x65, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x62, 0x65,
+  0x74, 0x61, 0x5f, 0x67, 0x70, 0x75, 0x0a, 0x5f, 0x5f, 0x6b, 0x65, 0x72,
+  0x6e, 0x65, 0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x65, 0x72,
+  0x67, 0x65, 0x5f, 0x74, 0x74, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67, 0x6c, 0x6f,
+  0x62, 0x61, 0x6c, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x2a, 0x54, 0x54,
+  0x31, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x5f, 0x67,
+  0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20,
+  0x54, 0x54, 0x45, 0x20, 0x2a, 0x65, 0x6e, 0x74, 0x72, 0x69, 0x65, 0x73,
+  0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75,
+  0x36, 0x34, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x2c, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20, 0x74,
+  0x74, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x31, 0x0a, 0x29, 0x0a, 0x7b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x36, 0x34, 0x20,
+  0x69, 0x20, 0x3d, 0x20, 0x28, 0x75, 0x36, 0x34, 0x29, 0x67, 0x65, 0x74,
+  0x5f, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x28, 0x30,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x48, 0x61, 0x73, 0x68, 0x20, 0x68, 0x61,
+  0x73, 0x68, 0x3b, 0x0a, 0x20, 0x20, 0x54, 0x54, 0x45, 0x20, 0x74, 0x74,
+  0x65, 0x3b, 0x0a, 0x20, 0x20, 0x54, 0x54, 0x31, 0x45, 0x20, 0x74, 0x74,
+  0x31, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x3e,
+  0x3d, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x7c, 0x7c, 0x54, 0x54, 0x49, 0x4e,
+  0x44, 0x45, 0x58, 0x31, 0x3c, 0x3d, 0x31, 0x29, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x0a, 0x20, 0x20,
+  0x74, 0x74, 0x65, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x65, 0x6e, 0x74, 0x72,
+  0x69, 0x65, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2f,
+  0x20, 0x72, 0x65, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x70, 0x6f, 0x73,
+  0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x76,
+  0x69, 0x61, 0x20, 0x78, 0x6f, 0x72, 0x20, 0x74, 0x72, 0x69, 0x63, 0x6b,
+  0x0a, 0x20, 0x20, 0x68, 0x61, 0x73, 0x68, 0x20, 0x20, 0x3d, 0x20, 0x74,
+  0x74, 0x65, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x5e, 0x28, 0x48, 0x61, 0x73,
+  0x68, 0x29, 0x74, 0x74, 0x65, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d, 0x6f,
+  0x76, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68, 0x29, 0x74, 0x74, 0x65,
+  0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x5e, 0x28, 0x48, 0x61, 0x73, 0x68,
+  0x29, 0x74, 0x74, 0x65, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a,
+  0x0a, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74, 0x6d,
+  0x6f, 0x76, 0x65, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x65, 0x2e, 0x62,
+  0x65, 0x73, 0x74, 0x6d, 0x6f, 0x76, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x74,
+  0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x3d, 0x20, 0x74, 0x74, 0x65, 0x2e, 0x73, 0x63, 0x6f, 0x72, 0x65,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e, 0x66, 0x6c, 0x61, 0x67,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20, 0x74, 0x74, 0x65, 0x2e,
+  0x66, 0x6c, 0x61, 0x67, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x74, 0x31, 0x2e,
+  0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3d, 0x20,
+  0x74, 0x74, 0x65, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x74, 0x31, 0x2e, 0x68, 0x61, 0x73, 0x68, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x54, 0x54, 0x4b, 0x45, 0x59, 0x28, 0x68,
+  0x61, 0x73, 0x68, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x62, 0x65, 0x73, 0x74,
+  0x6d, 0x6f, 0x76, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x73, 0x63, 0x6f,
+  0x72, 0x65, 0x2c, 0x74, 0x74, 0x31, 0x2e, 0x64, 0x65, 0x70, 0x74, 0x68,
+  0x29, 0x3b, 0x0a, 0x0a, 0x20, 0x20, 0x74, 0x74, 0x73, 0x61, 0x76, 0x65,
+  0x28, 0x54, 0x54, 0x31, 0x2c, 0x20, 0x74, 0x74, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x31, 0x2c, 0x20, 0x68, 0x61, 0x73, 0x68, 0x2c, 0x20, 0x74, 0x74,
+  0x31, 0x2c, 0x20, 0x74, 0x74, 0x65, 0x2e, 0x66, 0x6c, 0x61, 0x67, 0x3e,
+  0x3e, 0x32, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
 };
-const size_t zeta_cl_len = 88357;
+const size_t zeta_cl_len = 114007;